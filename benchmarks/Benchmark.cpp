@@ -0,0 +1,267 @@
+#include "Benchmark.h"
+
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <new>
+
+// Number of heap allocations made by current thread.
+// Counted per thread, so that allocations made by background threads, like the logger thread, are not counted to benchmarks.
+static thread_local size_t t_allocationsCount = 0;
+
+// Replace global operator new and operator delete, so that we can count heap allocations
+void* operator new(size_t size)
+{
+	t_allocationsCount++;
+	if (void* memory = std::malloc(size > 0 ? size : 1))
+	{
+		return memory;
+	}
+	throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+	return ::operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept
+{
+	std::free(memory);
+}
+
+namespace Benchmarks
+{
+
+#if !defined(__GNUC__)
+	const void* volatile g_doNotOptimizeSink = nullptr;
+#endif
+
+	size_t getAllocationsCount()
+	{
+		return t_allocationsCount;
+	}
+
+	// Returns the name of a given status, as written in JSON files
+	static const char* getStatusName(BenchmarkResult::Status status)
+	{
+		switch (status)
+		{
+			case BenchmarkResult::Status::Ok:       return "ok";
+			case BenchmarkResult::Status::Skipped:  return "skipped";
+			case BenchmarkResult::Status::Failed:   return "failed";
+		}
+		return "failed";
+	}
+
+	// Escapes a given string so that it can be written inside of a JSON string
+	static std::string escapeJsonString(const std::string& str)
+	{
+		std::string result;
+		result.reserve(str.size());
+		for (const char c : str)
+		{
+			if (c == '"' || c == '\\')
+			{
+				result += '\\';
+				result += c;
+			}
+			else if (c == '\n')
+			{
+				result += "\\n";
+			}
+			else
+			{
+				result += c;
+			}
+		}
+		return result;
+	}
+
+	// Reads a JSON string starting at a given position, which must be the opening quote,
+	// and moves the position right after the closing quote.
+	// @return false if there is no valid string at given position
+	static bool readJsonString(const std::string& json, size_t& pos, std::string& str)
+	{
+		if (pos >= json.size() || json[pos] != '"')
+		{
+			return false;
+		}
+		str.clear();
+		for (pos++; pos < json.size(); pos++)
+		{
+			if (json[pos] == '\\' && pos + 1 < json.size())
+			{
+				pos++;
+				str += (json[pos] == 'n') ? '\n' : json[pos];
+			}
+			else if (json[pos] == '"')
+			{
+				pos++;
+				return true;
+			}
+			else
+			{
+				str += json[pos];
+			}
+		}
+		return false;
+	}
+
+	// Finds the value of a given key inside of a JSON object spanning from a given position to a given end position,
+	// and returns the position where the value starts, or std::string::npos if key is not found.
+	static size_t findJsonValue(const std::string& json, const std::string& key, size_t pos, size_t endPos)
+	{
+		const std::string quotedKey = "\"" + key + "\"";
+		size_t keyPos = json.find(quotedKey, pos);
+		if (keyPos == std::string::npos || keyPos >= endPos)
+		{
+			return std::string::npos;
+		}
+		size_t valuePos = json.find(':', keyPos + quotedKey.size());
+		if (valuePos == std::string::npos || valuePos >= endPos)
+		{
+			return std::string::npos;
+		}
+		valuePos = json.find_first_not_of(" \t\r\n", valuePos + 1);
+		return (valuePos < endPos) ? valuePos : std::string::npos;
+	}
+
+	// Finds the end of a JSON object starting at a given position, which must be the opening brace,
+	// skipping braces inside of strings, and returns the position of the closing brace, or std::string::npos if there is none.
+	static size_t findJsonObjectEnd(const std::string& json, size_t pos)
+	{
+		bool isInString = false;
+		for (pos++; pos < json.size(); pos++)
+		{
+			if (isInString && json[pos] == '\\')
+			{
+				pos++;
+			}
+			else if (json[pos] == '"')
+			{
+				isInString = !isInString;
+			}
+			else if (!isInString && json[pos] == '}')
+			{
+				return pos;
+			}
+		}
+		return std::string::npos;
+	}
+
+	void BenchmarkRun::skip(const std::string& reason)
+	{
+		m_result.status = BenchmarkResult::Status::Skipped;
+		m_result.message = reason;
+	}
+
+	void BenchmarkRun::fail(const std::string& reason)
+	{
+		m_result.status = BenchmarkResult::Status::Failed;
+		m_result.message = reason;
+	}
+
+	void BenchmarkRun::finish(std::vector<double>& samplesNs, long long iterations, size_t allocationsCount)
+	{
+		std::sort(samplesNs.begin(), samplesNs.end());
+		const double medianNs = samplesNs[samplesNs.size() / 2];
+		const double minNs = samplesNs.front();
+
+		m_result.status = BenchmarkResult::Status::Ok;
+		m_result.iterations = iterations;
+		m_result.nsPerIteration = medianNs / double(iterations);
+		m_result.minNsPerIteration = minNs / double(iterations);
+		m_result.allocationsPerIteration = double(allocationsCount) / (double(iterations) * double(samplesNs.size()));
+	}
+
+	bool writeResultsToJson(const std::vector<BenchmarkResult>& results, const std::string& filepath)
+	{
+		std::ofstream file(filepath);
+		if (!file.is_open())
+		{
+			return false;
+		}
+
+		file << "{\n  \"benchmarks\": [";
+		for (size_t i = 0; i < results.size(); i++)
+		{
+			const BenchmarkResult& result = results[i];
+			file << (i > 0 ? ",\n" : "\n");
+			file << "    {\n";
+			file << "      \"name\": \"" << escapeJsonString(result.name) << "\",\n";
+			file << "      \"status\": \"" << getStatusName(result.status) << "\",\n";
+			file << "      \"nsPerIteration\": " << result.nsPerIteration << ",\n";
+			file << "      \"minNsPerIteration\": " << result.minNsPerIteration << ",\n";
+			file << "      \"allocationsPerIteration\": " << result.allocationsPerIteration << ",\n";
+			file << "      \"iterations\": " << result.iterations << ",\n";
+			file << "      \"message\": \"" << escapeJsonString(result.message) << "\"\n";
+			file << "    }";
+		}
+		file << "\n  ]\n}\n";
+
+		return file.good();
+	}
+
+	bool readBaselineFromJson(const std::string& filepath, std::unordered_map<std::string, double>& nsPerIteration)
+	{
+		std::ifstream file(filepath);
+		if (!file.is_open())
+		{
+			return false;
+		}
+		std::stringstream stream;
+		stream << file.rdbuf();
+		const std::string json = stream.str();
+
+		// Traverse all objects in the "benchmarks" array.
+		// This is NOT a general JSON parser. It only reads files written by writeResultsToJson().
+		size_t pos = json.find("\"benchmarks\"");
+		if (pos == std::string::npos)
+		{
+			return false;
+		}
+		while ((pos = json.find('{', pos)) != std::string::npos)
+		{
+			const size_t endPos = findJsonObjectEnd(json, pos);
+			if (endPos == std::string::npos)
+			{
+				return false;
+			}
+
+			std::string name;
+			std::string status;
+			size_t namePos = findJsonValue(json, "name", pos, endPos);
+			size_t statusPos = findJsonValue(json, "status", pos, endPos);
+			const size_t nsPos = findJsonValue(json, "nsPerIteration", pos, endPos);
+			if (!readJsonString(json, namePos, name) || !readJsonString(json, statusPos, status) || nsPos == std::string::npos)
+			{
+				return false;
+			}
+			if (status == "ok")
+			{
+				nsPerIteration[name] = std::strtod(json.c_str() + nsPos, nullptr);
+			}
+
+			pos = endPos + 1;
+		}
+
+		return true;
+	}
+
+} // namespace Benchmarks
\ No newline at end of file
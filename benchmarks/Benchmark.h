@@ -0,0 +1,179 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <chrono>
+#include <atomic>
+#include <cstddef>
+#include <algorithm>
+#include <unordered_map>
+
+namespace Benchmarks
+{
+
+	// Returns number of heap allocations made by current thread since the program started.
+	// Counted by the global operator new, which is replaced in the benchmarks executable.
+	size_t getAllocationsCount();
+
+#if !defined(__GNUC__)
+	// Pointer that values are written to by doNotOptimize(), on compilers without GCC-style inline assembly.
+	// Defined in one translation unit, so the compiler can't prove that it's never read.
+	extern const void* volatile g_doNotOptimizeSink;
+#endif
+
+	// Prevents the compiler from optimizing away the computation of a given value
+	template<typename T>
+	inline void doNotOptimize(const T& value)
+	{
+#if defined(__GNUC__)
+		// An empty assembly block that the compiler must assume reads the value and clobbers memory
+		asm volatile("" : : "g"(&value) : "memory");
+#else
+		g_doNotOptimizeSink = &value;
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+	}
+
+	// Result of running a single benchmark
+	struct BenchmarkResult
+	{
+		enum class Status
+		{
+			Ok,
+			Skipped,
+			Failed
+		};
+
+		std::string name;
+		Status status = Status::Ok;
+
+		// Median and minimum time of a single iteration across all samples, in nanoseconds
+		double nsPerIteration = 0.0;
+		double minNsPerIteration = 0.0;
+		// Average number of heap allocations made by a single iteration
+		double allocationsPerIteration = 0.0;
+		// Number of iterations in each sample
+		long long iterations = 0;
+
+		// Reason why benchmark was skipped or failed
+		std::string message;
+	};
+
+	// A single run of a benchmark, passed to benchmark's function.
+	//
+	// Benchmark's function does its (untimed) setup, and then calls measure() exactly once with the operation to be measured.
+	class BenchmarkRun
+	{
+	public:
+
+		BenchmarkRun(BenchmarkResult& result, int samplesCount) : m_result(result), m_samplesCount(samplesCount) {}
+
+		// Measures how long a given operation takes.
+		//
+		// Operation is first run for a while to warm up caches and to find how many iterations fit in a single sample,
+		// and then it's timed over a number of samples, taking the median.
+		// Allocations made by the operation are counted during the timed samples.
+		template<typename Operation>
+		void measure(Operation&& operation);
+
+		// Marks benchmark as skipped, for example when it needs something that's not available
+		void skip(const std::string& reason);
+		// Marks benchmark as failed, for example when its setup fails
+		void fail(const std::string& reason);
+
+	private: /* functions */
+
+		// Runs a given operation a given number of times and returns how long it took, in nanoseconds
+		template<typename Operation>
+		static double runIterations(Operation& operation, long long iterations);
+
+		// Fills result from the durations of all samples
+		void finish(std::vector<double>& samplesNs, long long iterations, size_t allocationsCount);
+
+	private: /* variables */
+
+		BenchmarkResult& m_result;
+
+		// Number of timed samples
+		int m_samplesCount = 0;
+	};
+
+	// A benchmark of a single operation
+	struct Benchmark
+	{
+		// Benchmark's name, in the form "Area/Operation"
+		std::string name;
+
+		// Flag indicating if benchmark needs a window with an OpenGL context
+		bool needsGraphics = false;
+
+		// Flag indicating if the measured operation must not allocate on the heap.
+		// Benchmark fails if it does.
+		bool expectZeroAllocations = false;
+
+		// Function doing benchmark's setup and calling BenchmarkRun::measure()
+		std::function<void(BenchmarkRun&)> function;
+	};
+
+	// Writes given benchmark results to a JSON file.
+	// @return true on success
+	bool writeResultsToJson(const std::vector<BenchmarkResult>& results, const std::string& filepath);
+	// Reads the time per iteration of each benchmark from a JSON file previously written by writeResultsToJson(),
+	// to be used as a baseline that new results are compared against.
+	// Only successful benchmarks are read.
+	// @return true on success
+	bool readBaselineFromJson(const std::string& filepath, std::unordered_map<std::string, double>& nsPerIteration);
+
+	// Functions adding the benchmarks of each area to a given list of benchmarks
+	void addRenderer2DBenchmarks(std::vector<Benchmark>& benchmarks);
+	void addMathUtilsBenchmarks(std::vector<Benchmark>& benchmarks);
+	void addShaderPreprocessorBenchmarks(std::vector<Benchmark>& benchmarks);
+	void addEventsBenchmarks(std::vector<Benchmark>& benchmarks);
+	void addGleamHouseBenchmarks(std::vector<Benchmark>& benchmarks);
+
+	// Duration that a single sample should roughly take, in nanoseconds
+	static constexpr double SAMPLE_DURATION_NS = 20.0 * 1000.0 * 1000.0;
+
+	template<typename Operation>
+	double BenchmarkRun::runIterations(Operation& operation, long long iterations)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		for (long long i = 0; i < iterations; i++)
+		{
+			operation();
+		}
+		const auto end = std::chrono::steady_clock::now();
+		return double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+	}
+
+	template<typename Operation>
+	void BenchmarkRun::measure(Operation&& operation)
+	{
+		// Warm up, doubling number of iterations until they take long enough to be a sample
+		long long iterations = 1;
+		double durationNs = runIterations(operation, iterations);
+		while (durationNs < SAMPLE_DURATION_NS / 4.0 && iterations < (1LL << 40))
+		{
+			iterations *= 2;
+			durationNs = runIterations(operation, iterations);
+		}
+		// Scale number of iterations so that a sample takes about SAMPLE_DURATION_NS
+		if (durationNs > 0.0)
+		{
+			iterations = std::max(1LL, (long long)(double(iterations) * SAMPLE_DURATION_NS / durationNs));
+		}
+
+		// Time all samples, counting allocations made in them
+		std::vector<double> samplesNs(m_samplesCount);
+		const size_t allocationsCountBefore = getAllocationsCount();
+		for (int i = 0; i < m_samplesCount; i++)
+		{
+			samplesNs[i] = runIterations(operation, iterations);
+		}
+		const size_t allocationsCount = getAllocationsCount() - allocationsCountBefore;
+
+		finish(samplesNs, iterations, allocationsCount);
+	}
+
+} // namespace Benchmarks
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "BenchmarkApplication.h"
+
+using Pekan::PekanApplication;
+using Pekan::ApplicationProperties;
+using Pekan::LayerStack;
+using Pekan::Layer;
+using Pekan::KeyCode;
+
+namespace Benchmarks
+{
+
+	// Number of layers in application's layer stack, that events are dispatched through
+	static constexpr int LAYERS_COUNT = 3;
+
+	// Values of GLFW_PRESS and GLFW_RELEASE, which window passes to application as key actions
+	static constexpr int KEY_ACTION_RELEASE = 0;
+	static constexpr int KEY_ACTION_PRESS = 1;
+
+	// A layer that doesn't do anything and doesn't handle any events
+	class BenchmarkLayer : public Layer
+	{
+	public:
+
+		BenchmarkLayer(PekanApplication* application) : Layer(application) {}
+
+		std::string getLayerName() const override { return "benchmark_layer"; }
+	};
+
+	void BenchmarkApplication::dispatchInputBurst(int eventsCount)
+	{
+		for (int i = 0; i < eventsCount; i++)
+		{
+			if (i % 8 == 0)
+			{
+				handleKeyEvent(KeyCode::KEY_W, 0, (i % 16 == 0) ? KEY_ACTION_PRESS : KEY_ACTION_RELEASE, 0);
+			}
+			else
+			{
+				handleMouseMovedEvent(double(i), double(eventsCount - i));
+			}
+		}
+		dispatchPendingEvents();
+		handleEventQueue();
+	}
+
+	bool BenchmarkApplication::_fillLayerStack(LayerStack& layerStack)
+	{
+		for (int i = 0; i < LAYERS_COUNT; i++)
+		{
+			layerStack.pushLayer(std::make_shared<BenchmarkLayer>(this));
+		}
+		return true;
+	}
+
+	ApplicationProperties BenchmarkApplication::getProperties() const
+	{
+		ApplicationProperties props;
+		props.windowProperties.title = getName();
+		props.windowProperties.visible = false;
+		// Log messages are written synchronously, so that the logger thread doesn't compete with benchmarks for CPU time
+		props.useAsyncLogging = false;
+		return props;
+	}
+
+} // namespace Benchmarks
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "PekanApplication.h"
+
+namespace Benchmarks
+{
+
+	// An application with an invisible window,
+	// giving benchmarks an OpenGL context and an application where events can be dispatched.
+	// It's initialized but never run. Benchmarks are run instead of application's main loop.
+	class BenchmarkApplication : public Pekan::PekanApplication
+	{
+	public:
+
+		// Simulates a burst of input events coming from the window, like a fast mouse movement with some key presses,
+		// and dispatches all of them the same way the main loop does, right after polling window's events.
+		void dispatchInputBurst(int eventsCount);
+
+	private:
+
+		bool _fillLayerStack(Pekan::LayerStack& layerStack) override;
+		std::string getName() const override { return "Pekan Benchmarks"; }
+		Pekan::ApplicationProperties getProperties() const override;
+	};
+
+} // namespace Benchmarks
\ No newline at end of file
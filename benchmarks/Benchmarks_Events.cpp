@@ -0,0 +1,63 @@
+#include "Benchmark.h"
+#include "BenchmarkApplication.h"
+
+#include "PekanEngine.h"
+#include "PekanApplication.h"
+#include "Events/EventQueue.h"
+
+using namespace Pekan;
+
+namespace Benchmarks
+{
+
+	// Measures pushing a full queue of events of different types, and then popping all of them
+	static void benchmarkEventQueuePushPop(BenchmarkRun& run)
+	{
+		EventQueue eventQueue;
+
+		run.measure([&]()
+		{
+			for (int i = 0; i < EventQueue::CAPACITY; i++)
+			{
+				if (i % 8 == 0)
+				{
+					eventQueue.push(KeyPressedEvent(KeyCode::KEY_W, false));
+				}
+				else
+				{
+					eventQueue.push(MouseMovedEvent(float(i), float(i)));
+				}
+			}
+			while (!eventQueue.empty())
+			{
+				doNotOptimize(eventQueue.front());
+				eventQueue.pop();
+			}
+		});
+	}
+
+	// Measures dispatching a burst of input events, as many as fit in application's pending events at once,
+	// through application's layers and event listeners, none of which handles them,
+	// so they all end up in application's event queue.
+	static void benchmarkDispatchInputBurst(BenchmarkRun& run)
+	{
+		BenchmarkApplication* application = dynamic_cast<BenchmarkApplication*>(PekanEngine::getApplication());
+		if (application == nullptr)
+		{
+			run.skip("There is no application to dispatch events in.");
+			return;
+		}
+
+		run.measure([&]()
+		{
+			application->dispatchInputBurst(EventQueue::CAPACITY);
+		});
+	}
+
+	void addEventsBenchmarks(std::vector<Benchmark>& benchmarks)
+	{
+		benchmarks.push_back({ "EventQueue/PushPop", false, true, benchmarkEventQueuePushPop });
+		benchmarks.push_back({ "PekanApplication/DispatchInputBurst", true, true, benchmarkDispatchInputBurst });
+	}
+
+} // namespace Benchmarks
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "Benchmark.h"
+
+#include "Player.h"
+#include "Floor.h"
+#include "Stress_Scene.h"
+
+#include "PekanEngine.h"
+#include "PekanApplication.h"
+#include "Memory/FrameArena.h"
+
+#include <filesystem>
+#include <limits>
+
+using namespace GleamHouse;
+using Pekan::PekanEngine;
+using Pekan::PekanApplication;
+using Pekan::FrameArena;
+
+namespace Benchmarks
+{
+
+	// Number of floor pieces, same as in Gleam House's level
+	static constexpr int FLOORS_COUNT = 21;
+
+	// Measures checking if player can move, while player is standing on the edge between two floor pieces
+	static void benchmarkPlayerCanMoveBy(BenchmarkRun& run)
+	{
+		// Create two floor pieces next to each other, with player's default position (-1, -1) right on the edge between them,
+		// and the rest of the floor pieces far away, so that they are checked but never collided with.
+		Floor floors[FLOORS_COUNT];
+		bool success = floors[0].create({ -6, -6 }, { -1, 4 });
+		success = success && floors[1].create({ -1, -6 }, { 4, 4 });
+		for (int i = 2; i < FLOORS_COUNT; i++)
+		{
+			success = success && floors[i].create({ 10 + 6 * i, 0 }, { 14 + 6 * i, 4 });
+		}
+		if (!success)
+		{
+			run.fail("Failed to create floor pieces.");
+			return;
+		}
+		// Player doesn't need to be created, because collision checks use only its position
+		Player player;
+
+		// Deltas of all 4 directions that player can move in, checked one after another
+		static constexpr glm::vec2 DELTAS[4] = { { 0.0f, 0.05f }, { -0.05f, 0.0f }, { 0.0f, -0.05f }, { 0.05f, 0.0f } };
+		int deltaIndex = 0;
+
+		run.measure([&]()
+		{
+			doNotOptimize(player.canMoveBy(DELTAS[deltaIndex], floors, FLOORS_COUNT));
+			deltaIndex = (deltaIndex + 1) % 4;
+		});
+
+		for (Floor& floor : floors)
+		{
+			floor.destroy();
+		}
+	}
+
+	// Duration of a single frame of the stress scene, in seconds
+	static constexpr double STEADY_STATE_FRAME_TIME = 1.0 / 60.0;
+	// Number of frames rendered before measuring,
+	// so that everything created lazily during the first frames, like GPU timer queries, already exists
+	static constexpr int STEADY_STATE_WARMUP_FRAMES_COUNT = 16;
+
+	// Measures a whole frame of a stress scene, the way application's main loop runs it:
+	// resetting the frame arena, updating the scene, and rendering it with Renderer2DSystem and PostProcessor.
+	// Once the scene is warm, a frame must not allocate on the heap at all.
+	static void benchmarkSteadyStateFrame(BenchmarkRun& run)
+	{
+		PekanApplication* application = PekanEngine::getApplication();
+		if (application == nullptr)
+		{
+			run.skip("There is no application to render frames in.");
+			return;
+		}
+
+		// Gleam House's shaders are loaded from filepaths relative to its source directory
+		std::error_code error;
+		const std::filesystem::path workingDirectory = std::filesystem::current_path(error);
+		std::filesystem::current_path(GLEAMHOUSE_ROOT_DIR, error);
+
+		StressProperties properties;
+		properties.spritesCount = 100;
+		properties.lightsCount = 16;
+		// Keep stats of every frame from the very first one, so that nothing changes once measuring starts,
+		// and never stop, because stopping closes application's window
+		properties.warmupFramesCount = 0;
+		properties.framesCount = std::numeric_limits<int>::max() / 2;
+		Stress_Scene scene(application, properties);
+		if (!scene.init())
+		{
+			std::filesystem::current_path(workingDirectory, error);
+			run.fail("Failed to initialize stress scene.");
+			return;
+		}
+
+		const auto runFrame = [&]()
+		{
+			FrameArena::reset();
+			scene.update(STEADY_STATE_FRAME_TIME);
+			scene.render();
+		};
+		for (int i = 0; i < STEADY_STATE_WARMUP_FRAMES_COUNT; i++)
+		{
+			runFrame();
+		}
+
+		run.measure(runFrame);
+
+		scene.exit();
+		std::filesystem::current_path(workingDirectory, error);
+	}
+
+	void addGleamHouseBenchmarks(std::vector<Benchmark>& benchmarks)
+	{
+		benchmarks.push_back({ "Player/CanMoveBy", false, true, benchmarkPlayerCanMoveBy });
+		benchmarks.push_back({ "GleamHouse/SteadyStateFrame", true, true, benchmarkSteadyStateFrame });
+	}
+
+} // namespace Benchmarks
\ No newline at end of file
@@ -0,0 +1,85 @@
+#include "Benchmark.h"
+
+#include "Utils/MathUtils.h"
+#include "Memory/FrameArena.h"
+
+#include <cmath>
+
+using namespace Pekan;
+
+namespace Benchmarks
+{
+
+	// Number of tips of the star-shaped polygon to be triangulated
+	static constexpr int STAR_TIPS_COUNT = 32;
+	// Number of battlements on each side of the castle-shaped room outline to be triangulated
+	static constexpr int BATTLEMENTS_COUNT = 64;
+
+	// Measures triangulating a concave, star-shaped polygon
+	static void benchmarkTriangulatePolygon(BenchmarkRun& run)
+	{
+		// Create star's vertices in CCW order, alternating between outer and inner radius
+		std::vector<glm::vec2> vertices;
+		for (int i = 0; i < STAR_TIPS_COUNT * 2; i++)
+		{
+			const float angle = float(i) * 3.14159265f / float(STAR_TIPS_COUNT);
+			const float radius = (i % 2 == 0) ? 1.0f : 0.5f;
+			vertices.push_back({ radius * std::cos(angle), radius * std::sin(angle) });
+		}
+		std::vector<unsigned> indices;
+		indices.reserve((vertices.size() - 2) * 3);
+
+		run.measure([&]()
+		{
+			// Reset frame arena, like it's reset at the start of each frame,
+			// because triangulation allocates its temporary data from it.
+			FrameArena::reset();
+			indices.clear();
+			MathUtils::triangulatePolygon(vertices, indices);
+			doNotOptimize(indices.data());
+		});
+	}
+
+	// Measures triangulating a concave room outline with hundreds of vertices,
+	// shaped like a castle, with battlements on top and bottom, and a lot of vertices at the same height.
+	static void benchmarkTriangulateRoomOutline(BenchmarkRun& run)
+	{
+		// Create outline's vertices in CCW order, going right along the bottom side and then left along the top side
+		std::vector<glm::vec2> vertices;
+		for (int i = 0; i < BATTLEMENTS_COUNT; i++)
+		{
+			const float x = float(2 * i);
+			vertices.push_back({ x, 0.0f });
+			vertices.push_back({ x, -1.0f });
+			vertices.push_back({ x + 1.0f, -1.0f });
+			vertices.push_back({ x + 1.0f, 0.0f });
+		}
+		vertices.push_back({ float(2 * BATTLEMENTS_COUNT), 0.0f });
+		vertices.push_back({ float(2 * BATTLEMENTS_COUNT), 10.0f });
+		for (int i = BATTLEMENTS_COUNT - 1; i >= 0; i--)
+		{
+			const float x = float(2 * i);
+			vertices.push_back({ x + 1.0f, 10.0f });
+			vertices.push_back({ x + 1.0f, 11.0f });
+			vertices.push_back({ x, 11.0f });
+			vertices.push_back({ x, 10.0f });
+		}
+		std::vector<unsigned> indices;
+		indices.reserve((vertices.size() - 2) * 3);
+
+		run.measure([&]()
+		{
+			FrameArena::reset();
+			indices.clear();
+			MathUtils::triangulatePolygon(vertices, indices);
+			doNotOptimize(indices.data());
+		});
+	}
+
+	void addMathUtilsBenchmarks(std::vector<Benchmark>& benchmarks)
+	{
+		benchmarks.push_back({ "MathUtils/TriangulatePolygon", false, true, benchmarkTriangulatePolygon });
+		benchmarks.push_back({ "MathUtils/TriangulateRoomOutline", false, true, benchmarkTriangulateRoomOutline });
+	}
+
+} // namespace Benchmarks
\ No newline at end of file
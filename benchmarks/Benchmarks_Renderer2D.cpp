@@ -0,0 +1,177 @@
+#include "Benchmark.h"
+
+#include "RenderBatch2D.h"
+#include "RectangleShape.h"
+#include "Sprite.h"
+#include "Polyline.h"
+#include "RenderQueue2D.h"
+
+using namespace Pekan::Renderer2D;
+
+namespace Benchmarks
+{
+
+	// Number of segments in a polyline, roughly as many as a debug overlay of a big level has
+	static constexpr int POLYLINE_SEGMENTS_COUNT = 10000;
+
+	// Number of shapes in the render queue, spread across a few layers
+	static constexpr int RENDER_QUEUE_SHAPES_COUNT = 10000;
+	static constexpr int RENDER_QUEUE_LAYERS_COUNT = 4;
+
+	// Number of objects in the chain of transformable objects, each one the parent of the next one
+	static constexpr int TRANSFORM_CHAIN_LENGTH = 8;
+
+	// Measures getting the world matrix of the last object in a chain of objects,
+	// after the first object in the chain changes, so that all world matrices need to be recalculated.
+	static void benchmarkWorldMatrixChain(BenchmarkRun& run)
+	{
+		RectangleShape chain[TRANSFORM_CHAIN_LENGTH];
+		for (int i = 0; i < TRANSFORM_CHAIN_LENGTH; i++)
+		{
+			chain[i].create(1.0f, 1.0f);
+			chain[i].setPosition({ 0.5f, 0.25f });
+			if (i > 0)
+			{
+				chain[i].setParent(&chain[i - 1]);
+			}
+		}
+
+		run.measure([&]()
+		{
+			chain[0].rotate(0.001f);
+			doNotOptimize(chain[TRANSFORM_CHAIN_LENGTH - 1].getWorldMatrix());
+		});
+
+		for (int i = 0; i < TRANSFORM_CHAIN_LENGTH; i++)
+		{
+			chain[i].destroy();
+		}
+	}
+
+	// Measures recalculating a shape's vertices in world space after the shape is moved
+	static void benchmarkShapeVertices(BenchmarkRun& run)
+	{
+		RectangleShape rectangle;
+		rectangle.create(1.0f, 2.0f);
+		rectangle.setColor({ 1.0f, 0.5f, 0.25f, 1.0f });
+
+		run.measure([&]()
+		{
+			rectangle.rotate(0.001f);
+			doNotOptimize(rectangle.getVertices());
+		});
+
+		rectangle.destroy();
+	}
+
+	// Measures adding a moving shape to a batch.
+	// Batch is cleared when it's full, like it would be after being rendered.
+	static void benchmarkBatchAddShape(BenchmarkRun& run)
+	{
+		RenderBatch2D batch;
+		batch.create();
+		RectangleShape rectangle;
+		rectangle.create(1.0f, 2.0f);
+
+		run.measure([&]()
+		{
+			rectangle.rotate(0.001f);
+			if (!batch.addShape(rectangle))
+			{
+				batch.clear();
+				batch.addShape(rectangle);
+			}
+		});
+
+		rectangle.destroy();
+		batch.destroy();
+	}
+
+	// Measures adding a moving sprite to a batch.
+	// Batch is cleared when it's full, like it would be after being rendered.
+	static void benchmarkBatchAddSprite(BenchmarkRun& run)
+	{
+		RenderBatch2D batch;
+		batch.create();
+		// Sprite doesn't need a real texture, because the batch is never rendered
+		Sprite sprite;
+		sprite.create(nullptr, 1.0f, 2.0f);
+
+		run.measure([&]()
+		{
+			sprite.rotate(0.001f);
+			if (!batch.addSprite(sprite))
+			{
+				batch.clear();
+				batch.addSprite(sprite);
+			}
+		});
+
+		sprite.destroy();
+		batch.destroy();
+	}
+
+	// Measures expanding the segments of a polyline into triangles and uploading them to the GPU,
+	// after all segments have changed, like a debug overlay that is redrawn each frame.
+	static void benchmarkPolylineUpdate(BenchmarkRun& run)
+	{
+		Polyline polyline;
+		polyline.create(LineJoin::Miter);
+
+		// A zigzag, so that every joint needs to be filled
+		std::vector<glm::vec2> points(POLYLINE_SEGMENTS_COUNT + 1);
+		for (int i = 0; i < int(points.size()); i++)
+		{
+			points[i] = { float(i) * 0.1f, (i % 2 == 0) ? 0.0f : 0.1f };
+		}
+
+		run.measure([&]()
+		{
+			polyline.clear();
+			polyline.addPolyline(points.data(), int(points.size()), glm::vec4(0.0f, 1.0f, 0.0f, 1.0f), 0.02f);
+			polyline.update();
+		});
+
+		polyline.destroy();
+	}
+
+	// Measures queueing shapes in different layers, some of them translucent, and sorting the queue
+	static void benchmarkRenderQueueSort(BenchmarkRun& run)
+	{
+		std::vector<RectangleShape> rectangles(RENDER_QUEUE_SHAPES_COUNT);
+		for (int i = 0; i < RENDER_QUEUE_SHAPES_COUNT; i++)
+		{
+			rectangles[i].create(1.0f, 1.0f);
+			rectangles[i].setLayer((i * 7) % RENDER_QUEUE_LAYERS_COUNT);
+			rectangles[i].setColor({ 1.0f, 1.0f, 1.0f, (i % 3 == 0) ? 0.5f : 1.0f });
+		}
+		RenderQueue2D queue;
+
+		run.measure([&]()
+		{
+			queue.clear();
+			for (const RectangleShape& rectangle : rectangles)
+			{
+				queue.addShape(rectangle);
+			}
+			queue.sort();
+			doNotOptimize(queue.getItems().data());
+		});
+
+		for (RectangleShape& rectangle : rectangles)
+		{
+			rectangle.destroy();
+		}
+	}
+
+	void addRenderer2DBenchmarks(std::vector<Benchmark>& benchmarks)
+	{
+		benchmarks.push_back({ "Transformable2D/WorldMatrixChain", false, true, benchmarkWorldMatrixChain });
+		benchmarks.push_back({ "Shape/RectangleVertices", false, true, benchmarkShapeVertices });
+		benchmarks.push_back({ "RenderBatch2D/AddShape", true, true, benchmarkBatchAddShape });
+		benchmarks.push_back({ "RenderBatch2D/AddSprite", true, true, benchmarkBatchAddSprite });
+		benchmarks.push_back({ "Polyline/Update10kSegments", true, true, benchmarkPolylineUpdate });
+		benchmarks.push_back({ "RenderQueue2D/Sort10kShapes", false, true, benchmarkRenderQueueSort });
+	}
+
+} // namespace Benchmarks
\ No newline at end of file
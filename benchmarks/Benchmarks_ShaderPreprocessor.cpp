@@ -0,0 +1,76 @@
+#include "Benchmark.h"
+
+#include "ShaderPreprocessor.h"
+#include "Utils/FileUtils.h"
+
+#include <filesystem>
+
+using namespace Pekan;
+using namespace Pekan::Graphics;
+
+// A real .pkshad file, used as input of the preprocessor
+#define PKSHAD_FILEPATH PEKAN_RENDERER2D_ROOT_DIR "/Shaders/2D_Batch_FragmentShader.pkshad"
+
+namespace Benchmarks
+{
+
+	// Returns substitutions that Renderer2D uses for its .pkshad files
+	static std::unordered_map<std::string, std::string> getSubstitutions()
+	{
+		return
+		{
+			{ "MAX_TEXTURE_SLOTS", "32" },
+			{ "ANALYTIC_EDGE_ANTI_ALIASING", "0" }
+		};
+	}
+
+	// Measures substituting placeholders in a shader source that is already in memory
+	static void benchmarkSubstitute(BenchmarkRun& run)
+	{
+		const std::string content = FileUtils::readTextFileToString(PKSHAD_FILEPATH);
+		if (content.empty())
+		{
+			run.fail("Failed to read " PKSHAD_FILEPATH);
+			return;
+		}
+		const std::unordered_map<std::string, std::string> substitutions = getSubstitutions();
+
+		run.measure([&]()
+		{
+			const std::string result = ShaderPreprocessor::substitute(content, substitutions, PKSHAD_FILEPATH);
+			doNotOptimize(result);
+		});
+	}
+
+	// Measures preprocessing a .pkshad file into a .glsl file, including reading and writing the files.
+	// Works on a copy of the .pkshad file in a temporary directory, so that the real .glsl file is not touched.
+	static void benchmarkPreprocess(BenchmarkRun& run)
+	{
+		std::error_code error;
+		const std::filesystem::path directory = std::filesystem::temp_directory_path(error) / "PekanBenchmarks";
+		std::filesystem::create_directories(directory, error);
+		const std::filesystem::path pkshadFilepath = directory / "Shader.pkshad";
+		std::filesystem::copy_file(PKSHAD_FILEPATH, pkshadFilepath, std::filesystem::copy_options::overwrite_existing, error);
+		if (error)
+		{
+			run.fail("Failed to copy " PKSHAD_FILEPATH " to a temporary directory: " + error.message());
+			return;
+		}
+		const std::string pkshadFilepathString = pkshadFilepath.string();
+		const std::unordered_map<std::string, std::string> substitutions = getSubstitutions();
+
+		run.measure([&]()
+		{
+			ShaderPreprocessor::preprocess(pkshadFilepathString, substitutions);
+		});
+
+		std::filesystem::remove_all(directory, error);
+	}
+
+	void addShaderPreprocessorBenchmarks(std::vector<Benchmark>& benchmarks)
+	{
+		benchmarks.push_back({ "ShaderPreprocessor/Substitute", false, false, benchmarkSubstitute });
+		benchmarks.push_back({ "ShaderPreprocessor/Preprocess", false, false, benchmarkPreprocess });
+	}
+
+} // namespace Benchmarks
\ No newline at end of file
@@ -0,0 +1,144 @@
+// Gleam House Stress
+//
+// Renders a procedurally generated level with a given number of floor pieces, torches, sprites and lights,
+// in an invisible window, for a fixed number of frames,
+// and reports CPU and GPU time of each part of the frame - mean, 50th, 95th and 99th percentile.
+//
+// Usage:
+//     GleamHouseStress [--floors <N>] [--torches <M>] [--sprites <K>] [--lights <L>] [--aa none|msaa<samples>|fxaa]
+//                      [--frames <count>] [--warmup <count>] [--seed <seed>] [--output <file>]
+//
+// To see how a frame scales, run it a few times growing one parameter at a time, for example:
+//     for n in 25 100 400 1600; do GleamHouseStress --floors $n --output stress_floors_$n.json; done
+//
+// To compare the cost of anti-aliasing modes, run it once for each mode, for example:
+//     for aa in none fxaa msaa2 msaa4 msaa8; do GleamHouseStress --aa $aa --output stress_aa_$aa.json; done
+//
+// NOTE: Must be run from Gleam House's source directory, because Gleam House's shaders are loaded from relative filepaths.
+// NOTE: Percentiles are calculated over the last FrameTimeStats::FRAMES_COUNT frames.
+
+#include "GraphicsSystem.h"
+#include "Renderer2DSystem.h"
+
+#include "PekanLogger.h"
+
+#include "Stress_Application.h"
+
+#include <iostream>
+#include <cstdlib>
+#include <string>
+
+using GleamHouse::Stress_Application;
+using GleamHouse::StressProperties;
+using Pekan::Graphics::AntiAliasingMode;
+
+// Parses an anti-aliasing mode given as "none", "fxaa" or "msaa<samples>", for example "msaa4".
+// @return false if given string is not a valid anti-aliasing mode
+static bool parseAntiAliasingMode(const std::string& value, StressProperties& properties)
+{
+	if (value == "none")
+	{
+		properties.antiAliasingMode = AntiAliasingMode::None;
+		properties.antiAliasingSamples = 0;
+		return true;
+	}
+	if (value == "fxaa")
+	{
+		properties.antiAliasingMode = AntiAliasingMode::FXAA;
+		properties.antiAliasingSamples = 0;
+		return true;
+	}
+	if (value.rfind("msaa", 0) == 0)
+	{
+		const int samples = std::atoi(value.c_str() + 4);
+		if (samples < 2)
+		{
+			return false;
+		}
+		properties.antiAliasingMode = AntiAliasingMode::MSAA;
+		properties.antiAliasingSamples = samples;
+		return true;
+	}
+	return false;
+}
+
+// Parses stress scene's properties from command line arguments.
+// @return false if arguments are invalid
+static bool parseProperties(int argc, char** argv, StressProperties& properties)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+		const bool hasValue = (i + 1 < argc);
+		if (arg == "--floors" && hasValue)
+		{
+			properties.floorsCount = std::atoi(argv[++i]);
+		}
+		else if (arg == "--torches" && hasValue)
+		{
+			properties.torchesCount = std::atoi(argv[++i]);
+		}
+		else if (arg == "--sprites" && hasValue)
+		{
+			properties.spritesCount = std::atoi(argv[++i]);
+		}
+		else if (arg == "--lights" && hasValue)
+		{
+			properties.lightsCount = std::atoi(argv[++i]);
+		}
+		else if (arg == "--aa" && hasValue)
+		{
+			if (!parseAntiAliasingMode(argv[++i], properties))
+			{
+				std::cerr << "Invalid anti-aliasing mode: " << argv[i] << std::endl;
+				return false;
+			}
+		}
+		else if (arg == "--frames" && hasValue)
+		{
+			properties.framesCount = std::atoi(argv[++i]);
+		}
+		else if (arg == "--warmup" && hasValue)
+		{
+			properties.warmupFramesCount = std::atoi(argv[++i]);
+		}
+		else if (arg == "--seed" && hasValue)
+		{
+			properties.seed = unsigned(std::strtoul(argv[++i], nullptr, 10));
+		}
+		else if (arg == "--output" && hasValue)
+		{
+			properties.outputFilepath = argv[++i];
+		}
+		else
+		{
+			std::cerr << "Unknown or incomplete argument: " << arg << std::endl;
+			return false;
+		}
+	}
+	return properties.floorsCount > 0 && properties.torchesCount >= 0 && properties.spritesCount >= 0 && properties.lightsCount >= 0
+		&& properties.framesCount > 0 && properties.warmupFramesCount >= 0;
+}
+
+int main(int argc, char** argv)
+{
+	StressProperties properties;
+	if (!parseProperties(argc, argv, properties))
+	{
+		std::cerr << "Usage: GleamHouseStress [--floors <N>] [--torches <M>] [--sprites <K>] [--lights <L>] [--aa none|msaa<samples>|fxaa] [--frames <count>] [--warmup <count>] [--seed <seed>] [--output <file>]" << std::endl;
+		return 2;
+	}
+
+	PEKAN_INCLUDE_SUBSYSTEM_GRAPHICS;
+	PEKAN_INCLUDE_SUBSYSTEM_RENDERER2D;
+
+	Stress_Application application(properties);
+	if (!application.init())
+	{
+		PK_LOG_ERROR("Application failed to initialize.", "Pekan");
+		return -1;
+	}
+	application.run();
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#include "Stress_Application.h"
+
+using Pekan::ApplicationProperties;
+using Pekan::LayerStack;
+
+namespace GleamHouse
+{
+
+	bool Stress_Application::_fillLayerStack(LayerStack& layerStack)
+	{
+		layerStack.pushLayer(std::make_shared<Stress_Scene>(this, m_properties));
+		return true;
+	}
+
+	ApplicationProperties Stress_Application::getProperties() const
+	{
+		ApplicationProperties props;
+		// Same resolution as Gleam House, so that the number of pixels to be shaded is the same
+		props.windowProperties.width = 1800;
+		props.windowProperties.height = 900;
+		props.windowProperties.title = getName();
+		props.windowProperties.visible = false;
+		// Render frames as fast as possible, so that measured frame time is the actual cost of a frame
+		props.fps = 0.0;
+		props.useVSync = false;
+		return props;
+	}
+
+} // namespace GleamHouse
\ No newline at end of file
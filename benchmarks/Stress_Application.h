@@ -0,0 +1,28 @@
+#pragma once
+
+#include "PekanApplication.h"
+#include "Stress_Scene.h"
+
+namespace GleamHouse
+{
+
+	// An application running a stress scene in an invisible window, as fast as possible,
+	// used to measure how the cost of a frame scales with the size of a level.
+	class Stress_Application : public Pekan::PekanApplication
+	{
+	public:
+
+		Stress_Application(const StressProperties& properties) : m_properties(properties) {}
+
+	private:
+
+		bool _fillLayerStack(Pekan::LayerStack& layerStack) override;
+		std::string getName() const override { return "Gleam House Stress"; }
+		Pekan::ApplicationProperties getProperties() const override;
+
+	private: /* variables */
+
+		StressProperties m_properties;
+	};
+
+} // namespace GleamHouse
\ No newline at end of file
@@ -0,0 +1,477 @@
+#include "Stress_Scene.h"
+
+#include "PekanLogger.h"
+#include "PekanApplication.h"
+#include "Renderer2DSystem.h"
+#include "RenderState.h"
+#include "RenderCommands.h"
+#include "PostProcessor.h"
+#include "Image.h"
+#include "Texture2D.h"
+
+#include <chrono>
+#include <random>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <iterator>
+
+using namespace Pekan::Graphics;
+using namespace Pekan::Renderer2D;
+using namespace Pekan;
+
+#define PI 3.14159265f
+
+namespace GleamHouse
+{
+
+	// Filepath of the image to be used for sprites
+	static constexpr char* SPRITE_IMAGE_FILEPATH = GLEAMHOUSE_ROOT_DIR "/src/resources/GleamHouse_player.png";
+
+	// Same camera scale and lighting resolution as in Gleam House's level, so that measurements are comparable
+	static constexpr float CAMERA_SCALE = 10.0f;
+	static constexpr int LIGHTING_RESOLUTION_DIVISOR = 2;
+
+	// Size of a cell of the level's grid, in tiles. Each cell contains one floor piece.
+	static constexpr int CELL_SIZE = 12;
+	// Minimum and maximum size of a floor piece, in tiles
+	static constexpr int FLOOR_MIN_SIZE = 4;
+	static constexpr int FLOOR_MAX_SIZE = 10;
+	// Margin around the level's grid, in world space
+	static constexpr float LEVEL_MARGIN = 10.0f;
+
+	// Size of sprites, in world space
+	static constexpr float SPRITE_SIZE = 1.0f;
+
+	// Radius of dynamic lights, in world space
+	static constexpr float LIGHT_RADIUS = 4.0f;
+	static constexpr float LIGHT_INTENSITY = 3.0f;
+	static constexpr float LIGHT_SHARPNESS = 0.5f;
+
+	// Number of camera's laps around the level during the measured frames
+	static constexpr float CAMERA_LAPS = 1.0f;
+	// Time step by which sprites and lights are animated each frame.
+	// It's fixed instead of measured, so that every run renders the exact same frames no matter how fast it runs.
+	static constexpr float ANIMATION_TIME_STEP = 1.0f / 60.0f;
+
+	// Returns milliseconds passed since a given time point
+	static double getMillisecondsSince(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	void Stress_Scene::Section::add(double time)
+	{
+		stats.addFrameTime(time);
+		totalTime += time;
+		framesCount++;
+	}
+
+	bool Stress_Scene::init()
+	{
+		if (m_properties.floorsCount <= 0 || m_properties.torchesCount < 0 || m_properties.spritesCount < 0 || m_properties.lightsCount < 0)
+		{
+			PK_LOG_ERROR("Stress scene needs at least one floor piece, and a non-negative number of torches, sprites and lights.", "GleamHouse");
+			return false;
+		}
+
+		// Enable and configure blending
+		RenderState::enableBlending();
+		RenderState::setBlendFunction(BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha);
+
+		m_camera = std::make_shared<Camera2D>();
+		m_camera->create(CAMERA_SCALE);
+		Renderer2DSystem::setCamera(m_camera);
+
+		if (!createFloors())
+		{
+			PK_LOG_ERROR("Failed to create floor pieces.", "GleamHouse");
+			return false;
+		}
+		if (!m_wall.create(m_levelBottomLeftPosition, m_levelTopRightPosition))
+		{
+			PK_LOG_ERROR("Failed to create background wall.", "GleamHouse");
+			return false;
+		}
+		if (!createTorches())
+		{
+			PK_LOG_ERROR("Failed to create torches.", "GleamHouse");
+			return false;
+		}
+		if (!createSprites())
+		{
+			PK_LOG_ERROR("Failed to create sprites.", "GleamHouse");
+			return false;
+		}
+		createLights();
+
+		if (!m_lightVolumes.create())
+		{
+			PK_LOG_ERROR("Failed to create light volumes.", "GleamHouse");
+			return false;
+		}
+		if (!m_staticLightmap.create(m_levelBottomLeftPosition, m_levelTopRightPosition))
+		{
+			PK_LOG_ERROR("Failed to create static lightmap.", "GleamHouse");
+			return false;
+		}
+		m_lightVolumes.setStaticLightmap(&m_staticLightmap);
+		// Torches lie on the ground, so their lights are static
+		for (int i = 0; i < m_properties.torchesCount; i++)
+		{
+			m_staticLightmap.setLight(i, m_torches[i].getStaticLightProperties());
+		}
+		m_staticLightmap.setStarLight({ 0.0f, 0.0f, 0.0f });
+
+		// Same post-processing as in Gleam House's level, but without dynamic resolution,
+		// so that the amount of work per frame depends only on the scene and on the anti-aliasing mode
+		PostProcessor::setAntiAliasingMode(m_properties.antiAliasingMode, m_properties.antiAliasingSamples);
+		if (!PostProcessor::init([this]() { m_lightVolumes.render(); }, LIGHTING_RESOLUTION_DIVISOR))
+		{
+			PK_LOG_ERROR("Failed to initialize PostProcessor", "GleamHouse");
+			return false;
+		}
+
+		m_gpuTimerRender2D.create();
+		m_gpuTimerPostProcess.create();
+		Renderer2DSystem::setOverdrawMeasuringEnabled(true);
+
+		m_cpuUpdate.name = "cpu/update";
+		m_cpuLights.name = "cpu/lights";
+		m_cpuRender2D.name = "cpu/render2D";
+		m_cpuPostProcess.name = "cpu/postProcess";
+		m_cpuFrame.name = "cpu/frame";
+		m_gpuRender2D.name = "gpu/render2D";
+		m_gpuPostProcess.name = "gpu/postProcess";
+		m_gpuFrame.name = "gpu/frame";
+
+		m_framesCount = 0;
+		m_overdrawTotal = 0.0;
+		m_overdrawFramesCount = 0;
+
+		return true;
+	}
+
+	void Stress_Scene::update(double deltaTime)
+	{
+		m_framesCount++;
+		if (isMeasuring())
+		{
+			m_cpuFrame.add(deltaTime * 1000.0);
+			const float overdraw = Renderer2DSystem::getStats().overdraw;
+			if (overdraw >= 0.0f)
+			{
+				m_overdrawTotal += double(overdraw);
+				m_overdrawFramesCount++;
+			}
+		}
+		if (m_framesCount > m_properties.warmupFramesCount + m_properties.framesCount)
+		{
+			report();
+			m_application->stopRunning();
+			return;
+		}
+
+		const auto updateStart = std::chrono::steady_clock::now();
+		updateCamera();
+		for (Torch& torch : m_torches)
+		{
+			torch.update(float(deltaTime));
+		}
+		updateSprites(ANIMATION_TIME_STEP);
+		const double updateTime = getMillisecondsSince(updateStart);
+
+		const auto lightsStart = std::chrono::steady_clock::now();
+		updateLights();
+		const double lightsTime = getMillisecondsSince(lightsStart);
+
+		if (isMeasuring())
+		{
+			m_cpuUpdate.add(updateTime);
+			m_cpuLights.add(lightsTime);
+		}
+	}
+
+	void Stress_Scene::render() const
+	{
+		const auto render2DStart = std::chrono::steady_clock::now();
+		PostProcessor::beginFrame();
+		m_gpuTimerRender2D.begin();
+		Renderer2DSystem::beginFrame();
+		RenderCommands::clear();
+
+		m_wall.render();
+		for (const Floor& floor : m_floors)
+		{
+			floor.render();
+		}
+		for (const Torch& torch : m_torches)
+		{
+			torch.render();
+		}
+		for (const Sprite& sprite : m_sprites)
+		{
+			sprite.render();
+		}
+
+		Renderer2DSystem::endFrame();
+		m_gpuTimerRender2D.end();
+		const double render2DTime = getMillisecondsSince(render2DStart);
+
+		const auto postProcessStart = std::chrono::steady_clock::now();
+		m_gpuTimerPostProcess.begin();
+		PostProcessor::endFrame();
+		m_gpuTimerPostProcess.end();
+		const double postProcessTime = getMillisecondsSince(postProcessStart);
+
+		if (isMeasuring())
+		{
+			m_cpuRender2D.add(render2DTime);
+			m_cpuPostProcess.add(postProcessTime);
+			// GPU times are read a few frames late, so they are negative until first measurements are available
+			if (m_gpuTimerRender2D.getTime() >= 0.0)
+			{
+				m_gpuRender2D.add(m_gpuTimerRender2D.getTime());
+			}
+			if (m_gpuTimerPostProcess.getTime() >= 0.0)
+			{
+				m_gpuPostProcess.add(m_gpuTimerPostProcess.getTime());
+			}
+			if (PostProcessor::getGpuFrameTime() >= 0.0)
+			{
+				m_gpuFrame.add(PostProcessor::getGpuFrameTime());
+			}
+		}
+	}
+
+	void Stress_Scene::exit()
+	{
+		Renderer2DSystem::setOverdrawMeasuringEnabled(false);
+		m_gpuTimerPostProcess.destroy();
+		m_gpuTimerRender2D.destroy();
+		for (Sprite& sprite : m_sprites)
+		{
+			sprite.destroy();
+		}
+		for (Torch& torch : m_torches)
+		{
+			torch.destroy();
+		}
+		for (Floor& floor : m_floors)
+		{
+			floor.destroy();
+		}
+		m_wall.destroy();
+		m_staticLightmap.destroy();
+		m_lightVolumes.destroy();
+		m_camera->destroy();
+	}
+
+	bool Stress_Scene::createFloors()
+	{
+		std::mt19937 random(m_properties.seed);
+
+		// Lay cells out in a square grid
+		const int columnsCount = int(std::ceil(std::sqrt(float(m_properties.floorsCount))));
+		const int rowsCount = (m_properties.floorsCount + columnsCount - 1) / columnsCount;
+		m_levelBottomLeftPosition = { -LEVEL_MARGIN, -LEVEL_MARGIN };
+		m_levelTopRightPosition = glm::vec2(float(columnsCount * CELL_SIZE), float(rowsCount * CELL_SIZE)) + LEVEL_MARGIN;
+
+		// Floor pieces must not be moved after they are created, so create all of them in place
+		m_floors.resize(m_properties.floorsCount);
+		std::uniform_int_distribution<int> sizeDistribution(FLOOR_MIN_SIZE, FLOOR_MAX_SIZE);
+		for (int i = 0; i < m_properties.floorsCount; i++)
+		{
+			const glm::ivec2 size = { sizeDistribution(random), sizeDistribution(random) };
+			std::uniform_int_distribution<int> offsetXDistribution(0, CELL_SIZE - size.x);
+			std::uniform_int_distribution<int> offsetYDistribution(0, CELL_SIZE - size.y);
+			const glm::ivec2 cell = { i % columnsCount, i / columnsCount };
+			const glm::ivec2 bottomLeftPosition = cell * CELL_SIZE + glm::ivec2(offsetXDistribution(random), offsetYDistribution(random));
+			if (!m_floors[i].create(bottomLeftPosition, bottomLeftPosition + size, (i % 2) == 0))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool Stress_Scene::createTorches()
+	{
+		std::mt19937 random(m_properties.seed + 1);
+		std::uniform_real_distribution<float> offsetDistribution(-1.0f, 1.0f);
+
+		// Place each torch next to the center of a floor piece, going through floor pieces one by one
+		m_torches.resize(m_properties.torchesCount);
+		for (int i = 0; i < m_properties.torchesCount; i++)
+		{
+			const BoundingBox floorBoundingBox = m_floors[i % m_floors.size()].getBoundingBox();
+			const glm::vec2 floorCenter = (floorBoundingBox.min + floorBoundingBox.max) / 2.0f;
+			if (!m_torches[i].create(floorCenter + glm::vec2(offsetDistribution(random), offsetDistribution(random))))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool Stress_Scene::createSprites()
+	{
+		if (m_properties.spritesCount == 0)
+		{
+			return true;
+		}
+
+		std::mt19937 random(m_properties.seed + 2);
+		std::uniform_real_distribution<float> xDistribution(m_levelBottomLeftPosition.x, m_levelTopRightPosition.x);
+		std::uniform_real_distribution<float> yDistribution(m_levelBottomLeftPosition.y, m_levelTopRightPosition.y);
+		std::uniform_real_distribution<float> angularSpeedDistribution(-PI, PI);
+
+		// All sprites share the same texture
+		Image image(SPRITE_IMAGE_FILEPATH);
+		std::shared_ptr<Texture2D> texture = std::make_shared<Texture2D>();
+		texture->create(image);
+
+		m_sprites.resize(m_properties.spritesCount);
+		m_spritesAngularSpeeds.resize(m_properties.spritesCount);
+		for (int i = 0; i < m_properties.spritesCount; i++)
+		{
+			m_sprites[i].create(texture, SPRITE_SIZE, SPRITE_SIZE);
+			m_sprites[i].setPosition({ xDistribution(random), yDistribution(random) });
+			m_spritesAngularSpeeds[i] = angularSpeedDistribution(random);
+		}
+		return true;
+	}
+
+	void Stress_Scene::createLights()
+	{
+		std::mt19937 random(m_properties.seed + 3);
+		std::uniform_real_distribution<float> xDistribution(m_levelBottomLeftPosition.x, m_levelTopRightPosition.x);
+		std::uniform_real_distribution<float> yDistribution(m_levelBottomLeftPosition.y, m_levelTopRightPosition.y);
+		std::uniform_real_distribution<float> unitDistribution(0.0f, 1.0f);
+
+		m_movingLights.resize(m_properties.lightsCount);
+		m_lights.resize(m_properties.lightsCount);
+		for (MovingLight& light : m_movingLights)
+		{
+			light.center = { xDistribution(random), yDistribution(random) };
+			light.orbitRadius = 1.0f + 4.0f * unitDistribution(random);
+			light.angle = 2.0f * PI * unitDistribution(random);
+			light.angularSpeed = PI * (unitDistribution(random) - 0.5f);
+			light.properties.color = glm::vec3(1.0f, 0.5f + 0.5f * unitDistribution(random), 0.5f * unitDistribution(random));
+			light.properties.intensity = LIGHT_INTENSITY;
+			light.properties.sharpness = LIGHT_SHARPNESS;
+		}
+	}
+
+	void Stress_Scene::updateCamera()
+	{
+		// Move camera around an ellipse inside the level, by the same amount each frame,
+		// so that every run sees the exact same sequence of frames
+		const float progress = float(m_framesCount) / float(std::max(m_properties.framesCount, 1));
+		const float angle = 2.0f * PI * CAMERA_LAPS * progress;
+		const glm::vec2 levelCenter = (m_levelBottomLeftPosition + m_levelTopRightPosition) / 2.0f;
+		const glm::vec2 levelHalfSize = (m_levelTopRightPosition - m_levelBottomLeftPosition) / 2.0f - LEVEL_MARGIN;
+		m_camera->setPosition(levelCenter + levelHalfSize * glm::vec2(std::cos(angle), std::sin(angle)));
+	}
+
+	void Stress_Scene::updateSprites(float dt)
+	{
+		for (size_t i = 0; i < m_sprites.size(); i++)
+		{
+			m_sprites[i].rotate(m_spritesAngularSpeeds[i] * dt);
+		}
+	}
+
+	void Stress_Scene::updateLights()
+	{
+		m_staticLightmap.bake();
+
+		// Move dynamic lights and convert them to window space
+		for (size_t i = 0; i < m_movingLights.size(); i++)
+		{
+			MovingLight& light = m_movingLights[i];
+			light.angle += light.angularSpeed * ANIMATION_TIME_STEP;
+			const glm::vec2 position = light.center + light.orbitRadius * glm::vec2(std::cos(light.angle), std::sin(light.angle));
+
+			m_lights[i] = light.properties;
+			m_lights[i].position = m_camera->worldToWindowPosition(position);
+			m_lights[i].radius = m_camera->worldToWindowSize({ LIGHT_RADIUS, LIGHT_RADIUS }).x;
+		}
+		m_lightVolumes.setLights(m_lights.data(), int(m_lights.size()));
+	}
+
+	void Stress_Scene::report() const
+	{
+		const Section* sections[] =
+		{
+			&m_cpuUpdate, &m_cpuLights, &m_cpuRender2D, &m_cpuPostProcess, &m_cpuFrame,
+			&m_gpuRender2D, &m_gpuPostProcess, &m_gpuFrame
+		};
+
+		std::cout << "Stress scene: " << m_properties.floorsCount << " floors, " << m_properties.torchesCount << " torches, "
+			<< m_properties.spritesCount << " sprites, " << m_properties.lightsCount << " lights, "
+			<< m_properties.framesCount << " frames, " << getAntiAliasingName() << " anti-aliasing" << std::endl;
+		std::cout << std::left << std::setw(18) << "section" << std::right
+			<< std::setw(10) << "mean ms" << std::setw(10) << "p50 ms" << std::setw(10) << "p95 ms" << std::setw(10) << "p99 ms" << std::endl;
+		for (const Section* section : sections)
+		{
+			const FrameTimePercentiles percentiles = section->stats.getPercentiles();
+			const double mean = (section->framesCount > 0) ? section->totalTime / double(section->framesCount) : 0.0;
+			std::cout << std::left << std::setw(18) << section->name << std::right << std::fixed << std::setprecision(3)
+				<< std::setw(10) << mean << std::setw(10) << percentiles.p50 << std::setw(10) << percentiles.p95 << std::setw(10) << percentiles.p99 << std::endl;
+		}
+		const double overdraw = getMeanOverdraw();
+		if (overdraw >= 0.0)
+		{
+			std::cout << "overdraw: " << std::fixed << std::setprecision(3) << overdraw << " samples drawn per sample of the target" << std::endl;
+		}
+
+		if (m_properties.outputFilepath.empty())
+		{
+			return;
+		}
+		std::ofstream file(m_properties.outputFilepath);
+		if (!file.is_open())
+		{
+			PK_LOG_ERROR("Failed to write stress scene's measurements to " << m_properties.outputFilepath, "GleamHouse");
+			return;
+		}
+		file << "{\n";
+		file << "  \"floors\": " << m_properties.floorsCount << ",\n";
+		file << "  \"torches\": " << m_properties.torchesCount << ",\n";
+		file << "  \"sprites\": " << m_properties.spritesCount << ",\n";
+		file << "  \"lights\": " << m_properties.lightsCount << ",\n";
+		file << "  \"frames\": " << m_properties.framesCount << ",\n";
+		file << "  \"antiAliasing\": \"" << getAntiAliasingName() << "\",\n";
+		file << "  \"overdraw\": " << overdraw << ",\n";
+		file << "  \"sections\": [";
+		for (size_t i = 0; i < std::size(sections); i++)
+		{
+			const Section* section = sections[i];
+			const FrameTimePercentiles percentiles = section->stats.getPercentiles();
+			const double mean = (section->framesCount > 0) ? section->totalTime / double(section->framesCount) : 0.0;
+			file << (i > 0 ? ",\n" : "\n");
+			file << "    { \"name\": \"" << section->name << "\", \"mean\": " << mean
+				<< ", \"p50\": " << percentiles.p50 << ", \"p95\": " << percentiles.p95 << ", \"p99\": " << percentiles.p99 << " }";
+		}
+		file << "\n  ]\n}\n";
+	}
+
+	double Stress_Scene::getMeanOverdraw() const
+	{
+		return (m_overdrawFramesCount > 0) ? m_overdrawTotal / double(m_overdrawFramesCount) : -1.0;
+	}
+
+	std::string Stress_Scene::getAntiAliasingName() const
+	{
+		switch (m_properties.antiAliasingMode)
+		{
+			case AntiAliasingMode::None:    return "none";
+			case AntiAliasingMode::MSAA:    return "msaa" + std::to_string(m_properties.antiAliasingSamples);
+			case AntiAliasingMode::FXAA:    return "fxaa";
+		}
+		return "unknown";
+	}
+
+} // namespace GleamHouse
\ No newline at end of file
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "Floor.h"
+#include "Wall.h"
+#include "Torch.h"
+#include "LightVolumes.h"
+#include "StaticLightmap.h"
+
+#include "Layer.h"
+#include "Sprite.h"
+#include "Camera2D.h"
+#include "GpuTimer.h"
+#include "PostProcessor.h"
+#include "Time/FrameTimeStats.h"
+
+#include <string>
+#include <vector>
+
+namespace GleamHouse
+{
+
+	// Parameters of a stress scene
+	struct StressProperties
+	{
+		// Number of floor pieces
+		int floorsCount = 21;
+		// Number of torches, lying on the floor, each one a static light
+		int torchesCount = 4;
+		// Number of rotating sprites scattered around the level
+		int spritesCount = 0;
+		// Number of moving dynamic lights
+		int lightsCount = 0;
+
+		// Anti-aliasing mode used by post-processing,
+		// and number of samples per pixel if it's MSAA
+		Pekan::Graphics::AntiAliasingMode antiAliasingMode = Pekan::Graphics::AntiAliasingMode::FXAA;
+		int antiAliasingSamples = 0;
+
+		// Number of frames to be measured
+		int framesCount = 600;
+		// Number of frames to be rendered before measuring, to let caches and drivers settle
+		int warmupFramesCount = 60;
+
+		// Seed of the random generator used to generate the level
+		unsigned seed = 1;
+
+		// File where measurements are written as JSON, or empty to only print them
+		std::string outputFilepath;
+	};
+
+	// A scene with a procedurally generated level made of Gleam House's building blocks,
+	// used to measure how the cost of a frame scales with the number of floor pieces, torches, sprites and lights.
+	//
+	// Scene renders a fixed number of frames, with camera moving across the level,
+	// then reports CPU and GPU time of each part of the frame, and Renderer2D's average overdraw, and stops the application.
+	class Stress_Scene : public Pekan::Layer
+	{
+	public:
+
+		Stress_Scene(Pekan::PekanApplication* application, const StressProperties& properties)
+			: Layer(application), m_properties(properties) {}
+
+		bool init() override;
+
+		void update(double deltaTime) override;
+
+		void render() const override;
+
+		void exit() override;
+
+		inline std::string getLayerName() const override { return "stress_scene_layer"; }
+
+	private: /* functions */
+
+		// Generates floor pieces in a grid of cells, one floor piece of random size in each cell
+		bool createFloors();
+		// Places torches and sprites on random positions
+		bool createTorches();
+		bool createSprites();
+		// Generates dynamic lights, each one circling around a random center
+		void createLights();
+
+		void updateCamera();
+		void updateSprites(float dt);
+		void updateLights();
+
+		// Prints measurements and writes them to output file, if there is one
+		void report() const;
+		// Returns Renderer2D's overdraw averaged over measured frames, or a negative value if it wasn't measured
+		double getMeanOverdraw() const;
+		// Returns the name of the anti-aliasing mode being measured, as given on the command line, for example "msaa4"
+		std::string getAntiAliasingName() const;
+
+		// Checks if current frame is measured, meaning that warmup is over
+		bool isMeasuring() const { return m_framesCount > m_properties.warmupFramesCount; }
+
+	private: /* variables */
+
+		// A part of the frame that is measured
+		struct Section
+		{
+			std::string name;
+			// Stats of section's durations, in milliseconds
+			Pekan::FrameTimeStats stats;
+			// Sum of section's durations over all measured frames, in milliseconds
+			double totalTime = 0.0;
+			// Number of measured frames
+			int framesCount = 0;
+
+			void add(double time);
+		};
+
+		// A dynamic light circling around a center
+		struct MovingLight
+		{
+			LightProperties properties;
+			glm::vec2 center = { 0.0f, 0.0f };
+			float orbitRadius = 1.0f;
+			float angle = 0.0f;
+			float angularSpeed = 1.0f;
+		};
+
+		StressProperties m_properties;
+
+		// Level's rectangle in world space
+		glm::vec2 m_levelBottomLeftPosition = { 0.0f, 0.0f };
+		glm::vec2 m_levelTopRightPosition = { 0.0f, 0.0f };
+
+		// Background wall
+		Wall m_wall;
+		std::vector<Floor> m_floors;
+		std::vector<Torch> m_torches;
+		std::vector<Pekan::Renderer2D::Sprite> m_sprites;
+		// Rotation speed of each sprite, in radians per second
+		std::vector<float> m_spritesAngularSpeeds;
+
+		std::vector<MovingLight> m_movingLights;
+		// Properties of dynamic lights, in window space, updated each frame
+		std::vector<LightProperties> m_lights;
+
+		LightVolumes m_lightVolumes;
+		StaticLightmap m_staticLightmap;
+
+		Pekan::Renderer2D::Camera2D_Ptr m_camera;
+
+		// Measured sections of CPU time.
+		// Render sections are measured in render() which is const, so they are mutable.
+		Section m_cpuUpdate;
+		Section m_cpuLights;
+		mutable Section m_cpuRender2D;
+		mutable Section m_cpuPostProcess;
+		Section m_cpuFrame;
+		// Measured sections of GPU time
+		mutable Section m_gpuRender2D;
+		mutable Section m_gpuPostProcess;
+		mutable Section m_gpuFrame;
+
+		// GPU timers measuring rendering of the scene itself, and lighting together with post-processing
+		mutable Pekan::Graphics::GpuTimer m_gpuTimerRender2D;
+		mutable Pekan::Graphics::GpuTimer m_gpuTimerPostProcess;
+
+		// Number of frames updated so far, including warmup frames
+		int m_framesCount = 0;
+
+		// Sum of Renderer2D's overdraw over measured frames, and number of measured frames that it was available in
+		double m_overdrawTotal = 0.0;
+		int m_overdrawFramesCount = 0;
+	};
+
+} // namespace GleamHouse
\ No newline at end of file
@@ -0,0 +1,222 @@
+// Pekan Benchmarks
+//
+// Measures the hot paths of Pekan and Gleam House,
+// writes the results to a JSON file,
+// and optionally compares them against a baseline JSON file written by an earlier run.
+//
+// Usage:
+//     PekanBenchmarks [--filter <text>] [--output <file>] [--baseline <file>] [--threshold <fraction>] [--samples <count>] [--no-graphics]
+//
+//     --filter      Runs only benchmarks whose name contains given text
+//     --output      File where results are written. Default is benchmark_results.json
+//     --baseline    File with results of an earlier run, to compare against
+//     --threshold   How much slower than baseline a benchmark can be before it's considered a regression.
+//                   Default is 0.10, meaning 10% slower.
+//     --samples     Number of timed samples per benchmark. Default is 9.
+//     --no-graphics Skips benchmarks that need a window with an OpenGL context
+//
+// To save a baseline, run benchmarks on a Release build and keep the output file.
+// Later runs given that file as a baseline exit with code 1 if any benchmark regressed,
+// failed, or allocated memory while it's expected not to, so they can be used as a check before merging changes.
+
+#include "Benchmark.h"
+#include "BenchmarkApplication.h"
+
+#include "GraphicsSystem.h"
+#include "Renderer2DSystem.h"
+
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <cstdlib>
+
+using namespace Benchmarks;
+
+// Options given from the command line
+struct Options
+{
+	std::string filter;
+	std::string outputFilepath = "benchmark_results.json";
+	std::string baselineFilepath;
+	double threshold = 0.10;
+	int samplesCount = 9;
+	bool withGraphics = true;
+};
+
+// Parses options from command line arguments.
+// @return false if arguments are invalid
+static bool parseOptions(int argc, char** argv, Options& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+		const bool hasValue = (i + 1 < argc);
+		if (arg == "--filter" && hasValue)
+		{
+			options.filter = argv[++i];
+		}
+		else if (arg == "--output" && hasValue)
+		{
+			options.outputFilepath = argv[++i];
+		}
+		else if (arg == "--baseline" && hasValue)
+		{
+			options.baselineFilepath = argv[++i];
+		}
+		else if (arg == "--threshold" && hasValue)
+		{
+			options.threshold = std::atof(argv[++i]);
+		}
+		else if (arg == "--samples" && hasValue)
+		{
+			options.samplesCount = std::atoi(argv[++i]);
+		}
+		else if (arg == "--no-graphics")
+		{
+			options.withGraphics = false;
+		}
+		else
+		{
+			std::cerr << "Unknown or incomplete argument: " << arg << std::endl;
+			return false;
+		}
+	}
+	return options.samplesCount > 0 && options.threshold >= 0.0;
+}
+
+// Runs a given benchmark and returns its result
+static BenchmarkResult runBenchmark(const Benchmark& benchmark, const Options& options, bool isGraphicsAvailable)
+{
+	BenchmarkResult result;
+	result.name = benchmark.name;
+
+	if (benchmark.needsGraphics && !isGraphicsAvailable)
+	{
+		result.status = BenchmarkResult::Status::Skipped;
+		result.message = "Needs a window with an OpenGL context.";
+		return result;
+	}
+
+	BenchmarkRun run(result, options.samplesCount);
+	benchmark.function(run);
+
+	if (result.status == BenchmarkResult::Status::Ok && benchmark.expectZeroAllocations && result.allocationsPerIteration > 0.0)
+	{
+		result.status = BenchmarkResult::Status::Failed;
+		result.message = "Allocates memory on the heap, but it's expected not to.";
+	}
+	return result;
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+	if (!parseOptions(argc, argv, options))
+	{
+		std::cerr << "Usage: PekanBenchmarks [--filter <text>] [--output <file>] [--baseline <file>] [--threshold <fraction>] [--samples <count>] [--no-graphics]" << std::endl;
+		return 2;
+	}
+
+	// Collect benchmarks matching the filter
+	std::vector<Benchmark> allBenchmarks;
+	addRenderer2DBenchmarks(allBenchmarks);
+	addMathUtilsBenchmarks(allBenchmarks);
+	addShaderPreprocessorBenchmarks(allBenchmarks);
+	addEventsBenchmarks(allBenchmarks);
+	addGleamHouseBenchmarks(allBenchmarks);
+	std::vector<Benchmark> benchmarks;
+	bool needsGraphics = false;
+	for (const Benchmark& benchmark : allBenchmarks)
+	{
+		if (benchmark.name.find(options.filter) != std::string::npos)
+		{
+			benchmarks.push_back(benchmark);
+			needsGraphics = needsGraphics || benchmark.needsGraphics;
+		}
+	}
+
+	// Read baseline, if there is one
+	std::unordered_map<std::string, double> baseline;
+	if (!options.baselineFilepath.empty() && !readBaselineFromJson(options.baselineFilepath, baseline))
+	{
+		std::cerr << "Failed to read baseline from " << options.baselineFilepath << std::endl;
+		return 2;
+	}
+
+	// Initialize an application with an invisible window, if any benchmark needs graphics.
+	// If that fails, benchmarks needing graphics will be skipped, and the rest will still run.
+	std::unique_ptr<BenchmarkApplication> application;
+	bool isGraphicsAvailable = false;
+	if (needsGraphics && options.withGraphics)
+	{
+		PEKAN_INCLUDE_SUBSYSTEM_GRAPHICS;
+		PEKAN_INCLUDE_SUBSYSTEM_RENDERER2D;
+
+		application = std::make_unique<BenchmarkApplication>();
+		isGraphicsAvailable = application->init();
+		if (!isGraphicsAvailable)
+		{
+			std::cerr << "Failed to create a window with an OpenGL context. Benchmarks that need one will be skipped." << std::endl;
+		}
+	}
+
+	// Run benchmarks, comparing each one against baseline
+	std::vector<BenchmarkResult> results;
+	int failuresCount = 0;
+	int regressionsCount = 0;
+	for (const Benchmark& benchmark : benchmarks)
+	{
+		const BenchmarkResult result = runBenchmark(benchmark, options, isGraphicsAvailable);
+		results.push_back(result);
+
+		std::cout << std::left << std::setw(40) << result.name << std::right;
+		if (result.status == BenchmarkResult::Status::Skipped)
+		{
+			std::cout << "  skipped: " << result.message << std::endl;
+			continue;
+		}
+		if (result.status == BenchmarkResult::Status::Failed)
+		{
+			std::cout << "  FAILED: " << result.message << std::endl;
+			failuresCount++;
+			continue;
+		}
+
+		std::cout << std::fixed << std::setprecision(1)
+			<< std::setw(14) << result.nsPerIteration << " ns"
+			<< std::setw(14) << result.minNsPerIteration << " ns min"
+			<< std::setprecision(2) << std::setw(10) << result.allocationsPerIteration << " allocs";
+
+		const auto it = baseline.find(result.name);
+		if (it != baseline.end() && it->second > 0.0)
+		{
+			const double change = result.nsPerIteration / it->second - 1.0;
+			std::cout << std::showpos << std::setw(10) << change * 100.0 << "%" << std::noshowpos;
+			if (change > options.threshold)
+			{
+				std::cout << "  REGRESSION";
+				regressionsCount++;
+			}
+		}
+		else if (!baseline.empty())
+		{
+			std::cout << "  (not in baseline)";
+		}
+		std::cout << std::endl;
+	}
+
+	if (!writeResultsToJson(results, options.outputFilepath))
+	{
+		std::cerr << "Failed to write results to " << options.outputFilepath << std::endl;
+		return 2;
+	}
+	std::cout << "Results written to " << options.outputFilepath << std::endl;
+
+	if (failuresCount > 0 || regressionsCount > 0)
+	{
+		std::cout << failuresCount << " benchmark(s) failed, " << regressionsCount << " benchmark(s) regressed by more than "
+			<< options.threshold * 100.0 << "%." << std::endl;
+		return 1;
+	}
+	return 0;
+}
\ No newline at end of file
@@ -3,8 +3,6 @@
 #include <ostream>
 #include <string>
 #include <functional>
-#include <queue>
-#include <memory>
 
 struct GLFWwindow;
 
@@ -57,45 +55,4 @@ namespace Pekan
 		return os << e.toString();
 	}
 
-	// A queue of events
-	// where events are pushed when they happen
-	// and can be handled later, usually once per frame,
-	// by popping them one by one from the queue.
-	class EventQueue
-	{
-	public:
-
-		// Pushes an event to the event queue
-		void push(std::unique_ptr<Event> event)
-		{
-			m_queue.push(std::move(event));
-		}
-
-		// Checks if the event queue is empty
-		bool empty() const
-		{
-			return m_queue.empty();
-		}
-
-		// Returns event queue's size
-		int size() const
-		{
-			return m_queue.size();
-		}
-
-		// Pops an event from the back of the event queue.
-		// Returns the popped event.
-		std::unique_ptr<Event> pop()
-		{
-			std::unique_ptr<Event> event = std::move(m_queue.front());
-			m_queue.pop();
-			return event;
-		}
-
-	private:
-
-		// Underlying queue of event pointers
-		std::queue<std::unique_ptr<Event>> m_queue;
-	};
-
 } // namespace Pekan
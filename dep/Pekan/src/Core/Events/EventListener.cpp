@@ -0,0 +1,16 @@
+#include "EventListener.h"
+
+#include "PekanApplication.h"
+
+namespace Pekan
+{
+
+	EventListener::~EventListener()
+	{
+		if (m_application != nullptr)
+		{
+			m_application->unlinkEventListener(this);
+		}
+	}
+
+} // namespace Pekan
\ No newline at end of file
@@ -16,6 +16,16 @@ namespace Pekan
 	{
 		friend class PekanApplication;
 
+	public:
+
+		EventListener() = default;
+		// Unregisters event listener from the application where it's registered, if any
+		virtual ~EventListener();
+
+		// Event listeners are linked into their application's list of listeners, so they cannot be copied
+		EventListener(const EventListener&) = delete;
+		EventListener& operator=(const EventListener&) = delete;
+
 	protected:
 
 		// Functions that are automatically called when an event occurs in an application.
@@ -30,6 +40,17 @@ namespace Pekan
 		virtual bool onMouseButtonReleased(const MouseButtonReleasedEvent& event) { return false; }
 		virtual bool onWindowResized(const WindowResizedEvent& event) { return false; }
 		virtual bool onWindowClosed(const WindowClosedEvent& event) { return false; }
+
+	private: /* variables */
+
+		// Application where event listener is registered, or null if it's not registered
+		PekanApplication* m_application = nullptr;
+
+		// Previous and next event listener in application's list of registered event listeners.
+		// Listeners are linked directly to each other, so registering, unregistering and dispatching
+		// never allocate memory or copy the list.
+		EventListener* m_previousListener = nullptr;
+		EventListener* m_nextListener = nullptr;
 	};
 
 } // namespace Pekan
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "KeyEvents.h"
+#include "MouseEvents.h"
+#include "WindowEvents.h"
+
+#include <array>
+#include <variant>
+#include <type_traits>
+
+namespace Pekan
+{
+
+	// An event of any type, stored by value and tagged with its type.
+	// Allows storing events of different types together without allocating each one on the heap.
+	using QueuedEvent = std::variant
+	<
+		std::monostate,
+		KeyPressedEvent, KeyReleasedEvent,
+		MouseButtonPressedEvent, MouseButtonReleasedEvent, MouseMovedEvent, MouseScrolledEvent,
+		WindowClosedEvent, WindowResizedEvent
+	>;
+
+	// A queue of events
+	// where events are pushed when they happen
+	// and can be handled later, usually once per frame,
+	// by popping them one by one from the queue.
+	//
+	// Implemented as a fixed-capacity ring buffer of events stored by value,
+	// so pushing and popping events never allocates memory.
+	class EventQueue
+	{
+	public:
+
+		// Maximum number of events that can be in the queue at the same time
+		static constexpr int CAPACITY = 1024;
+
+		// Pushes an event to the back of the event queue.
+		// @return false if the event queue is full, in which case the event is NOT pushed
+		template<typename EventT>
+		bool push(const EventT& event)
+		{
+			if (full())
+			{
+				return false;
+			}
+			m_events[(m_front + m_size) % CAPACITY] = event;
+			m_size++;
+			return true;
+		}
+
+		// Checks if the event queue is empty
+		bool empty() const
+		{
+			return m_size == 0;
+		}
+
+		// Checks if the event queue is full
+		bool full() const
+		{
+			return m_size == CAPACITY;
+		}
+
+		// Returns event queue's size
+		int size() const
+		{
+			return m_size;
+		}
+
+		// Returns (a pointer to) the event at the front of the event queue, or null if the event queue is empty.
+		//
+		// NOTE: Pointer is valid only until the event is popped.
+		const Event* front() const
+		{
+			if (empty())
+			{
+				return nullptr;
+			}
+			return std::visit
+			(
+				[](const auto& event) -> const Event*
+				{
+					if constexpr (std::is_base_of_v<Event, std::decay_t<decltype(event)>>)
+					{
+						return &event;
+					}
+					else
+					{
+						return nullptr;
+					}
+				},
+				m_events[m_front]
+			);
+		}
+
+		// Returns the event at the front of the event queue, tagged with its type.
+		// Holds std::monostate if the event queue is empty.
+		const QueuedEvent& frontTagged() const
+		{
+			return m_events[m_front];
+		}
+
+		// Pops the event from the front of the event queue
+		void pop()
+		{
+			if (empty())
+			{
+				return;
+			}
+			// Reset popped slot, so that a slot outside of the queue always holds std::monostate
+			m_events[m_front] = std::monostate();
+			m_front = (m_front + 1) % CAPACITY;
+			m_size--;
+		}
+
+	private:
+
+		// Underlying ring buffer of events
+		std::array<QueuedEvent, CAPACITY> m_events;
+
+		// Index of the event at the front of the queue
+		int m_front = 0;
+		// Number of events in the queue
+		int m_size = 0;
+	};
+
+} // namespace Pekan
\ No newline at end of file
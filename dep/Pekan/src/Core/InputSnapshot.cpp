@@ -0,0 +1,63 @@
+#include "InputSnapshot.h"
+
+#include <GLFW/glfw3.h>
+
+namespace Pekan
+{
+
+	// Checks if a given key code can be stored in the snapshot.
+	// Unknown keys have a negative key code.
+	static bool isKeyValid(KeyCode key)
+	{
+		return int(key) >= 0 && int(key) < InputSnapshot::KEYS_COUNT;
+	}
+
+	// Checks if a given mouse button can be stored in the snapshot
+	static bool isMouseButtonValid(MouseButton button)
+	{
+		return int(button) >= 0 && int(button) < InputSnapshot::MOUSE_BUTTONS_COUNT;
+	}
+
+	void InputSnapshot::onKey(KeyCode key, int action)
+	{
+		if (!isKeyValid(key))
+		{
+			return;
+		}
+		const size_t index = size_t(key);
+		m_pressedKeys.set(index, action == GLFW_PRESS || action == GLFW_REPEAT);
+		m_repeatingKeys.set(index, action == GLFW_REPEAT);
+	}
+
+	void InputSnapshot::onMouseButton(MouseButton button, int action)
+	{
+		if (!isMouseButtonValid(button))
+		{
+			return;
+		}
+		m_pressedMouseButtons.set(size_t(button), action == GLFW_PRESS);
+	}
+
+	void InputSnapshot::clear()
+	{
+		m_pressedKeys.reset();
+		m_repeatingKeys.reset();
+		m_pressedMouseButtons.reset();
+	}
+
+	bool InputSnapshot::isKeyPressed(KeyCode key) const
+	{
+		return isKeyValid(key) && m_pressedKeys.test(size_t(key));
+	}
+
+	bool InputSnapshot::isKeyRepeating(KeyCode key) const
+	{
+		return isKeyValid(key) && m_repeatingKeys.test(size_t(key));
+	}
+
+	bool InputSnapshot::isMouseButtonPressed(MouseButton button) const
+	{
+		return isMouseButtonValid(button) && m_pressedMouseButtons.test(size_t(button));
+	}
+
+} // namespace Pekan
\ No newline at end of file
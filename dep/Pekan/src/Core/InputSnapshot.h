@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Events/KeyEvents_Enums.h"
+#include "Events/MouseEvents_Enums.h"
+
+#include <bitset>
+#include <glm/glm.hpp>
+
+namespace Pekan
+{
+
+	// A snapshot of keyboard and mouse state.
+	//
+	// Window keeps it up to date from its input callbacks while events are polled,
+	// so after polling events the snapshot holds the state for the whole frame,
+	// and querying it is just a bit test instead of a call to the OS.
+	class InputSnapshot
+	{
+	public:
+
+		// Number of key codes that can be stored, covering all key codes from KeyCode enum
+		static constexpr int KEYS_COUNT = int(KeyCode::KEY_MENU) + 1;
+		// Number of mouse buttons that can be stored
+		static constexpr int MOUSE_BUTTONS_COUNT = 8;
+
+		// Updates the snapshot with a key/mouse button event, where action is GLFW_PRESS, GLFW_RELEASE or GLFW_REPEAT
+		void onKey(KeyCode key, int action);
+		void onMouseButton(MouseButton button, int action);
+		// Updates mouse position in the snapshot
+		void setMousePosition(glm::vec2 mousePosition) { m_mousePosition = mousePosition; }
+
+		// Releases all keys and mouse buttons
+		void clear();
+
+		// Checks if a given key is pressed,
+		// or repeating which means that it had been pressed and held down for a bit, like half a second.
+		bool isKeyPressed(KeyCode key) const;
+		bool isKeyRepeating(KeyCode key) const;
+		// Checks if a given mouse button is pressed
+		bool isMouseButtonPressed(MouseButton button) const;
+		// Returns mouse position, in pixels, relative to window's top-left corner
+		glm::vec2 getMousePosition() const { return m_mousePosition; }
+
+	private: /* variables */
+
+		// One bit per key, set if key is pressed
+		std::bitset<KEYS_COUNT> m_pressedKeys;
+		// One bit per key, set if key is repeating
+		std::bitset<KEYS_COUNT> m_repeatingKeys;
+		// One bit per mouse button, set if button is pressed
+		std::bitset<MOUSE_BUTTONS_COUNT> m_pressedMouseButtons;
+
+		glm::vec2 m_mousePosition = { 0.0f, 0.0f };
+	};
+
+} // namespace Pekan
\ No newline at end of file
@@ -34,6 +34,10 @@ namespace Pekan
 
 		// Can be implemented by derived classes with specific logic for updating the layer between frames
 		virtual void update(double deltaTime) {}
+		// Can be implemented by derived classes with logic that needs to run right before rendering,
+		// after mouse position has been re-sampled (late-latched).
+		// Use it for things that follow the mouse, so they are rendered with minimal lag.
+		virtual void lateUpdate() {}
 		// Can be implemented by derived classes with specific rendering logic
 		virtual void render() const {}
 
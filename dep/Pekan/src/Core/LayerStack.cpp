@@ -53,6 +53,17 @@ namespace Pekan
 		}
 	}
 
+	void LayerStack::lateUpdateAll()
+	{
+		for (const Layer_Ptr& layer : m_layers)
+		{
+			if (layer != nullptr)
+			{
+				layer->lateUpdate();
+			}
+		}
+	}
+
 	void LayerStack::initLayer(const Layer_Ptr& layer)
 	{
 		PK_ASSERT_QUICK(layer != nullptr);
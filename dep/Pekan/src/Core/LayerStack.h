@@ -25,6 +25,8 @@ namespace Pekan
 		void renderAll();
 		// Updates all layers, in the order they were pushed to the layer stack
 		void updateAll(double deltaTime);
+		// Late-updates all layers, in the order they were pushed to the layer stack
+		void lateUpdateAll();
 
 		// Sends an event of a given type to layers of the layer stack,
 		// one by one, until a layer successfully handles the event,
@@ -34,7 +36,7 @@ namespace Pekan
 		template<typename EventT>
 		bool dispatchEvent
 		(
-			std::unique_ptr<EventT>& event,
+			const EventT& event,
 			bool (EventListener::* onEventFunc)(const EventT&)
 		);
 
@@ -53,14 +55,14 @@ namespace Pekan
 	template<typename EventT>
 	bool LayerStack::dispatchEvent
 	(
-		std::unique_ptr<EventT>& event,
+		const EventT& event,
 		bool (EventListener::* onEventFunc)(const EventT&)
 	)
 	{
 		for (auto it = m_layers.rbegin(); it != m_layers.rend(); ++it)
 		{
 			EventListener* layer = static_cast<EventListener*>((*it).get());
-			if (layer != nullptr && (layer->*onEventFunc)(*event.get()))
+			if (layer != nullptr && (layer->*onEventFunc)(event))
 			{
 				return true;
 			}
@@ -3,6 +3,19 @@
 #include <iostream>
 #include <filesystem>
 #include <fstream>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <exception>
+#include <memory>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 
 #define SPACES_STR(N) std::string(N, ' ')
 
@@ -211,6 +224,314 @@ namespace Logger
     static bool isFileEnabled = _isFileEnabled();
 #endif // PK_LOGGER_FILE_SUPPORT
 
+#if PK_LOGGER_ASYNC_SUPPORT
+
+    // Level of a log message
+    enum class LogLevel { Error, Warning, Info, Debug };
+    // Where a log message is written to
+    enum class LogDestination { Console, File };
+
+    // Maximum number of records in asynchronous logging's buffer. Must be a power of 2.
+    static constexpr size_t ASYNC_RECORDS_CAPACITY = 2048;
+    // Maximum length of a message that fits in a record, including the null terminator
+    static constexpr size_t ASYNC_MESSAGE_CAPACITY = 512;
+    // Maximum length of a sender that fits in a record, including the null terminator
+    static constexpr size_t ASYNC_SENDER_CAPACITY = 32;
+    // How often logger thread wakes up to write pending records, if not woken up earlier
+    static constexpr std::chrono::milliseconds ASYNC_WRITE_INTERVAL(5);
+
+    // A log message waiting in asynchronous logging's buffer to be written
+    struct AsyncLogRecord
+    {
+        // Sequence number of the record, telling producers and the logger thread who owns the record (see pushAsyncRecord())
+        std::atomic<size_t> sequence;
+
+        LogLevel level;
+        LogDestination destination;
+
+        // Source file's name is a part of a string literal (__FILE__), so it's safe to store without copying
+        std::string_view sourceFileName;
+        // Line in source file, or -1 if message doesn't include source file
+        int sourceFileLine;
+
+        char sender[ASYNC_SENDER_CAPACITY];
+        char msg[ASYNC_MESSAGE_CAPACITY];
+    };
+
+    // Buffer of records, used as a lock-free multiple-producer single-consumer ring buffer.
+    // Allocated once, on first start of asynchronous logging, and never freed,
+    // so that a late producer can never write into freed memory.
+    static std::unique_ptr<AsyncLogRecord[]> g_records;
+    // Position where next record will be pushed, and position of next record to be written.
+    // Positions only ever grow, and are wrapped into the buffer with a mask.
+    static std::atomic<size_t> g_pushPosition = 0;
+    static std::atomic<size_t> g_writePosition = 0;
+    // Number of records dropped because buffer was full, that are not yet reported
+    static std::atomic<size_t> g_droppedRecordsCount = 0;
+
+    // Flag indicating if asynchronous logging is currently running
+    static std::atomic<bool> g_isAsyncRunning = false;
+    static AsyncOverflowPolicy g_overflowPolicy = AsyncOverflowPolicy::Drop;
+
+    // Flag indicating if some thread is currently writing records.
+    // Normally that's the logger thread, but after a crash it's the crashing thread.
+    static std::atomic_flag g_isWritingRecords = ATOMIC_FLAG_INIT;
+
+    // Background thread writing records, and a condition variable used to wake it up early
+    static std::thread g_loggerThread;
+    static std::mutex g_wakeMutex;
+    static std::condition_variable g_wakeCondition;
+
+    // Flag indicating if current thread writes log messages synchronously,
+    // either because it's the logger thread, or because it's flushing records after a crash.
+    static thread_local bool t_writesSynchronously = false;
+
+    // Handlers that were installed before asynchronous logging installed its own crash handlers
+    static std::terminate_handler g_previousTerminateHandler = nullptr;
+    static constexpr int CRASH_SIGNALS[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+    static void (*g_previousSignalHandlers[std::size(CRASH_SIGNALS)])(int) = {};
+
+    // Writes a record to its destination. Defined at the end of this file, after all _log*() functions.
+    static void writeAsyncRecord(const AsyncLogRecord& record);
+
+    // Pushes a log message to asynchronous logging's buffer, to be written later by the logger thread.
+    // Returns true if message is taken care of - pushed, or dropped because buffer is full.
+    // Returns false if message should be written synchronously by the caller,
+    // which happens if asynchronous logging is not running, or if message is too long to fit in a record.
+    static bool pushAsyncRecord(LogLevel level, LogDestination destination, const char* msg, const char* sender, std::string_view sourceFileName, int sourceFileLine)
+    {
+        if (t_writesSynchronously || !g_isAsyncRunning.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        const size_t msgLength = std::strlen(msg);
+        if (msgLength >= ASYNC_MESSAGE_CAPACITY)
+        {
+            // Write all earlier messages first, so that caller's synchronous write comes after them
+            flush();
+            return false;
+        }
+
+        // Claim a record.
+        // A record at position P is free to be claimed when its sequence number is P,
+        // and it's ready to be written when its sequence number is P + 1.
+        size_t position = g_pushPosition.load(std::memory_order_relaxed);
+        AsyncLogRecord* record = nullptr;
+        while (true)
+        {
+            record = &g_records[position & (ASYNC_RECORDS_CAPACITY - 1)];
+            const size_t sequence = record->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = std::ptrdiff_t(sequence) - std::ptrdiff_t(position);
+            if (difference == 0)
+            {
+                // Record is free, try to claim it before another producer does
+                if (g_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // Record is not written yet, so buffer is full
+                if (g_overflowPolicy == AsyncOverflowPolicy::Drop)
+                {
+                    g_droppedRecordsCount.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+                g_wakeCondition.notify_one();
+                std::this_thread::yield();
+                position = g_pushPosition.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                // Another producer claimed the record first
+                position = g_pushPosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        record->level = level;
+        record->destination = destination;
+        record->sourceFileName = sourceFileName;
+        record->sourceFileLine = sourceFileLine;
+        std::strncpy(record->sender, sender, ASYNC_SENDER_CAPACITY - 1);
+        record->sender[ASYNC_SENDER_CAPACITY - 1] = '\0';
+        std::memcpy(record->msg, msg, msgLength + 1);
+        // Publish the record to the logger thread
+        record->sequence.store(position + 1, std::memory_order_release);
+
+        // If buffer is getting full, wake up logger thread early
+        if (position - g_writePosition.load(std::memory_order_relaxed) >= ASYNC_RECORDS_CAPACITY / 2)
+        {
+            g_wakeCondition.notify_one();
+        }
+        return true;
+    }
+
+    // Writes all published records with a given function, in the order they were pushed.
+    // Returns true if at least one record was written.
+    //
+    // NOTE: Caller must hold g_isWritingRecords for the whole call.
+    static bool writePublishedRecords(void (*writeRecord)(const AsyncLogRecord&))
+    {
+        bool wroteAny = false;
+        while (true)
+        {
+            const size_t position = g_writePosition.load(std::memory_order_relaxed);
+            AsyncLogRecord& record = g_records[position & (ASYNC_RECORDS_CAPACITY - 1)];
+            if (record.sequence.load(std::memory_order_acquire) != position + 1)
+            {
+                break;
+            }
+            writeRecord(record);
+            // Free the record for the producer that will push at the same index on next lap around the buffer
+            record.sequence.store(position + ASYNC_RECORDS_CAPACITY, std::memory_order_release);
+            g_writePosition.store(position + 1, std::memory_order_release);
+            wroteAny = true;
+        }
+        return wroteAny;
+    }
+
+    // Reports the number of records dropped since last report, if any
+    static void reportDroppedRecords()
+    {
+        const size_t droppedRecordsCount = g_droppedRecordsCount.exchange(0, std::memory_order_relaxed);
+        if (droppedRecordsCount > 0)
+        {
+            std::cout << "[WARNING](Pekan): " << droppedRecordsCount << " log messages were dropped because they were logged faster than they could be written." << std::endl;
+        }
+    }
+
+    // Writes all published records, in the order they were pushed.
+    // Returns true if at least one record was written.
+    // Returns false without writing anything if another thread is currently writing records.
+    static bool writeAsyncRecords()
+    {
+        if (g_isWritingRecords.test_and_set(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        const bool wroteAny = writePublishedRecords(writeAsyncRecord);
+        reportDroppedRecords();
+
+        g_isWritingRecords.clear(std::memory_order_release);
+        return wroteAny;
+    }
+
+    // Function running on the logger thread
+    static void loggerThreadFunction()
+    {
+        t_writesSynchronously = true;
+        while (g_isAsyncRunning.load(std::memory_order_acquire))
+        {
+            if (!writeAsyncRecords())
+            {
+                std::unique_lock<std::mutex> lock(g_wakeMutex);
+                g_wakeCondition.wait_for(lock, ASYNC_WRITE_INTERVAL);
+            }
+        }
+        // Write records that were pushed while stopping
+        writeAsyncRecords();
+    }
+
+    // Writes all published records from the current thread, after std::terminate().
+    // Logger thread might be in the middle of writing records, so we give it a little time to finish,
+    // but we don't wait forever because it might be the thread that crashed.
+    static void flushOnCrash()
+    {
+        if (!g_isAsyncRunning.load(std::memory_order_acquire) || t_writesSynchronously)
+        {
+            return;
+        }
+        t_writesSynchronously = true;
+        for (int attempt = 0; attempt < 1000; attempt++)
+        {
+            // Hold the flag until all records are written, so that logger thread can't write the same records at the same time
+            if (g_isWritingRecords.test_and_set(std::memory_order_acquire) == false)
+            {
+                writePublishedRecords(writeAsyncRecord);
+                reportDroppedRecords();
+                g_isWritingRecords.clear(std::memory_order_release);
+                return;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    // Writes a null-terminated string straight to standard error, with no buffering and no allocations.
+    // Safe to be called from a signal handler.
+    static void writeToStandardErrorUnbuffered(const char* str)
+    {
+        const size_t length = std::strlen(str);
+#ifdef _WIN32
+        _write(2, str, unsigned(length));
+#else
+        // There is nothing to be done if writing fails while crashing, so result is ignored
+        const ssize_t result = write(STDERR_FILENO, str, length);
+        (void)result;
+#endif
+    }
+
+    // Writes a record to standard error, no matter its destination, without its source file.
+    // Unlike writeAsyncRecord(), it's safe to be called from a signal handler.
+    static void writeAsyncRecordUnbuffered(const AsyncLogRecord& record)
+    {
+        static constexpr const char* LEVEL_TAGS[] = { "[ERROR](", "[WARNING](", "[INFO](", "[DEBUG](" };
+        writeToStandardErrorUnbuffered(LEVEL_TAGS[int(record.level)]);
+        writeToStandardErrorUnbuffered(record.sender);
+        writeToStandardErrorUnbuffered("): ");
+        writeToStandardErrorUnbuffered(record.msg);
+        writeToStandardErrorUnbuffered("\n");
+    }
+
+    // Writes all published records from the current thread, after a crash signal.
+    //
+    // NOTE: Only async-signal-safe work is done here. Records are written with write(2), without iostreams,
+    //       and if logger thread is in the middle of writing records we don't wait for it, so this is best-effort.
+    static void flushOnCrashSignal()
+    {
+        if (!g_isAsyncRunning.load(std::memory_order_acquire) || t_writesSynchronously)
+        {
+            return;
+        }
+        t_writesSynchronously = true;
+        if (g_isWritingRecords.test_and_set(std::memory_order_acquire))
+        {
+            return;
+        }
+        writePublishedRecords(writeAsyncRecordUnbuffered);
+        g_isWritingRecords.clear(std::memory_order_release);
+    }
+
+    // Handler of crash signals
+    static void onCrashSignal(int signal)
+    {
+        flushOnCrashSignal();
+        // Let the signal crash the process as it would without asynchronous logging
+        std::signal(signal, SIG_DFL);
+        std::raise(signal);
+    }
+
+    // Handler of std::terminate()
+    static void onTerminate()
+    {
+        flushOnCrash();
+        if (g_previousTerminateHandler != nullptr)
+        {
+            g_previousTerminateHandler();
+        }
+        std::abort();
+    }
+
+    // An object stopping asynchronous logging on static destruction,
+    // for the case when application exits without stopping it
+    static struct AsyncLoggingStopper
+    {
+        ~AsyncLoggingStopper() { stopAsyncLogging(); }
+    } g_asyncLoggingStopper;
+
+#endif // PK_LOGGER_ASYNC_SUPPORT
+
 #if PK_LOGGER_CONSOLE_SUPPORT
 
 #if PK_LOGGER_ERROR_SUPPORT
@@ -218,6 +539,10 @@ namespace Logger
     {
         if (isConsoleEnabled && isErrorEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Error, LogDestination::Console, msg, sender, {}, -1))
+            {
+                return;
+            }
             std::cout << "[ERROR](" << sender << "): " << msg << std::endl;
         }
     }
@@ -226,6 +551,10 @@ namespace Logger
     {
         if (isConsoleEnabled && isErrorEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Error, LogDestination::Console, msg, sender, sourceFileName, sourceFileLine))
+            {
+                return;
+            }
             std::cout << "[ERROR in " << sourceFileName << ":" << sourceFileLine << "](" << sender << "): " << msg << std::endl;
         }
     }
@@ -235,6 +564,10 @@ namespace Logger
     {
         if (isConsoleEnabled && isWarningEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Warning, LogDestination::Console, msg, sender, {}, -1))
+            {
+                return;
+            }
             std::cout << "[WARNING](" << sender << "): " << msg << std::endl;
         }
     }
@@ -243,6 +576,10 @@ namespace Logger
     {
         if (isConsoleEnabled && isWarningEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Warning, LogDestination::Console, msg, sender, sourceFileName, sourceFileLine))
+            {
+                return;
+            }
             std::cout << "[WARNING in " << sourceFileName << ":" << sourceFileLine << "](" << sender << "): " << msg << std::endl;
         }
     }
@@ -252,6 +589,10 @@ namespace Logger
     {
         if (isConsoleEnabled && isInfoEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Info, LogDestination::Console, msg, sender, {}, -1))
+            {
+                return;
+            }
             std::cout << "[INFO](" << sender << "): " << msg << std::endl;
         }
     }
@@ -260,6 +601,10 @@ namespace Logger
     {
         if (isConsoleEnabled && isInfoEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Info, LogDestination::Console, msg, sender, sourceFileName, sourceFileLine))
+            {
+                return;
+            }
             std::cout << "[INFO in " << sourceFileName << ":" << sourceFileLine << "](" << sender << "): " << msg << std::endl;
         }
     }
@@ -269,6 +614,10 @@ namespace Logger
     {
         if (isConsoleEnabled && isDebugEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Debug, LogDestination::Console, msg, sender, {}, -1))
+            {
+                return;
+            }
             std::cout << "[DEBUG](" << sender << "): " << msg << std::endl;
         }
     }
@@ -277,6 +626,10 @@ namespace Logger
     {
         if (isConsoleEnabled && isDebugEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Debug, LogDestination::Console, msg, sender, sourceFileName, sourceFileLine))
+            {
+                return;
+            }
             std::cout << "[DEBUG in " << sourceFileName << ":" << sourceFileLine << "](" << sender << "): " << msg << std::endl;
         }
     }
@@ -291,6 +644,10 @@ namespace Logger
     {
         if (isFileEnabled && isErrorEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Error, LogDestination::File, msg, sender, {}, -1))
+            {
+                return;
+            }
             std::ofstream logFile(logFilePath, std::ios_base::app);
             if (!logFile.is_open())
             {
@@ -312,6 +669,10 @@ namespace Logger
     {
         if (isFileEnabled && isErrorEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Error, LogDestination::File, msg, sender, sourceFileName, sourceFileLine))
+            {
+                return;
+            }
             std::ofstream logFile(logFilePath, std::ios_base::app);
             if (!logFile.is_open())
             {
@@ -334,6 +695,10 @@ namespace Logger
     {
         if (isFileEnabled && isWarningEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Warning, LogDestination::File, msg, sender, {}, -1))
+            {
+                return;
+            }
             std::ofstream logFile(logFilePath, std::ios_base::app);
             if (!logFile.is_open())
             {
@@ -355,6 +720,10 @@ namespace Logger
     {
         if (isFileEnabled && isWarningEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Warning, LogDestination::File, msg, sender, sourceFileName, sourceFileLine))
+            {
+                return;
+            }
             std::ofstream logFile(logFilePath, std::ios_base::app);
             if (!logFile.is_open())
             {
@@ -377,6 +746,10 @@ namespace Logger
     {
         if (isFileEnabled && isInfoEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Info, LogDestination::File, msg, sender, {}, -1))
+            {
+                return;
+            }
             std::ofstream logFile(logFilePath, std::ios_base::app);
             if (!logFile.is_open())
             {
@@ -398,6 +771,10 @@ namespace Logger
     {
         if (isFileEnabled && isInfoEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Info, LogDestination::File, msg, sender, sourceFileName, sourceFileLine))
+            {
+                return;
+            }
             std::ofstream logFile(logFilePath, std::ios_base::app);
             if (!logFile.is_open())
             {
@@ -420,6 +797,10 @@ namespace Logger
     {
         if (isFileEnabled && isDebugEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Debug, LogDestination::File, msg, sender, {}, -1))
+            {
+                return;
+            }
             std::ofstream logFile(logFilePath, std::ios_base::app);
             if (!logFile.is_open())
             {
@@ -439,6 +820,8 @@ namespace Logger
 
     void _logAssertToConsole(const char* msg, const char* sender, const char* condition)
     {
+        // Write all earlier messages first, because process is going to be aborted right after the assert message
+        flush();
         if (isConsoleEnabled)
         {
             std::cout << "(" << sender << "): " << "Assertion failed: " << condition << std::endl;
@@ -449,6 +832,8 @@ namespace Logger
 
     void _logAssertToConsole(const char* condition)
     {
+        // Write all earlier messages first, because process is going to be aborted right after the assert message
+        flush();
         if (isConsoleEnabled)
         {
             std::cout << "Assertion failed: " << condition << std::endl;
@@ -459,6 +844,10 @@ namespace Logger
     {
         if (isFileEnabled && isDebugEnabled)
         {
+            if (pushAsyncRecord(LogLevel::Debug, LogDestination::File, msg, sender, sourceFileName, sourceFileLine))
+            {
+                return;
+            }
             std::ofstream logFile(logFilePath, std::ios_base::app);
             if (!logFile.is_open())
             {
@@ -479,7 +868,213 @@ namespace Logger
 
 #endif // PK_LOGGER_FILE_SUPPORT
 
+#if PK_LOGGER_ASYNC_SUPPORT
+
+    static void writeAsyncRecord(const AsyncLogRecord& record)
+    {
+        const bool includesSourceFile = (record.sourceFileLine >= 0);
+        switch (record.level)
+        {
+#if PK_LOGGER_ERROR_SUPPORT
+        case LogLevel::Error:
+#if PK_LOGGER_CONSOLE_SUPPORT
+            if (record.destination == LogDestination::Console)
+            {
+                if (includesSourceFile)
+                {
+                    _logErrorToConsole(record.msg, record.sender, record.sourceFileName, record.sourceFileLine);
+                }
+                else
+                {
+                    _logErrorToConsole(record.msg, record.sender);
+                }
+            }
+#endif
+#if PK_LOGGER_FILE_SUPPORT
+            if (record.destination == LogDestination::File)
+            {
+                if (includesSourceFile)
+                {
+                    _logErrorToFile(record.msg, record.sender, record.sourceFileName, record.sourceFileLine);
+                }
+                else
+                {
+                    _logErrorToFile(record.msg, record.sender);
+                }
+            }
+#endif
+            break;
+#endif // PK_LOGGER_ERROR_SUPPORT
+#if PK_LOGGER_WARNING_SUPPORT
+        case LogLevel::Warning:
+#if PK_LOGGER_CONSOLE_SUPPORT
+            if (record.destination == LogDestination::Console)
+            {
+                if (includesSourceFile)
+                {
+                    _logWarningToConsole(record.msg, record.sender, record.sourceFileName, record.sourceFileLine);
+                }
+                else
+                {
+                    _logWarningToConsole(record.msg, record.sender);
+                }
+            }
+#endif
+#if PK_LOGGER_FILE_SUPPORT
+            if (record.destination == LogDestination::File)
+            {
+                if (includesSourceFile)
+                {
+                    _logWarningToFile(record.msg, record.sender, record.sourceFileName, record.sourceFileLine);
+                }
+                else
+                {
+                    _logWarningToFile(record.msg, record.sender);
+                }
+            }
+#endif
+            break;
+#endif // PK_LOGGER_WARNING_SUPPORT
+#if PK_LOGGER_INFO_SUPPORT
+        case LogLevel::Info:
+#if PK_LOGGER_CONSOLE_SUPPORT
+            if (record.destination == LogDestination::Console)
+            {
+                if (includesSourceFile)
+                {
+                    _logInfoToConsole(record.msg, record.sender, record.sourceFileName, record.sourceFileLine);
+                }
+                else
+                {
+                    _logInfoToConsole(record.msg, record.sender);
+                }
+            }
+#endif
+#if PK_LOGGER_FILE_SUPPORT
+            if (record.destination == LogDestination::File)
+            {
+                if (includesSourceFile)
+                {
+                    _logInfoToFile(record.msg, record.sender, record.sourceFileName, record.sourceFileLine);
+                }
+                else
+                {
+                    _logInfoToFile(record.msg, record.sender);
+                }
+            }
+#endif
+            break;
+#endif // PK_LOGGER_INFO_SUPPORT
+#if PK_LOGGER_DEBUG_SUPPORT
+        case LogLevel::Debug:
+#if PK_LOGGER_CONSOLE_SUPPORT
+            if (record.destination == LogDestination::Console)
+            {
+                if (includesSourceFile)
+                {
+                    _logDebugToConsole(record.msg, record.sender, record.sourceFileName, record.sourceFileLine);
+                }
+                else
+                {
+                    _logDebugToConsole(record.msg, record.sender);
+                }
+            }
+#endif
+#if PK_LOGGER_FILE_SUPPORT
+            if (record.destination == LogDestination::File)
+            {
+                if (includesSourceFile)
+                {
+                    _logDebugToFile(record.msg, record.sender, record.sourceFileName, record.sourceFileLine);
+                }
+                else
+                {
+                    _logDebugToFile(record.msg, record.sender);
+                }
+            }
+#endif
+            break;
+#endif // PK_LOGGER_DEBUG_SUPPORT
+        }
+    }
+
+    void startAsyncLogging(AsyncOverflowPolicy overflowPolicy)
+    {
+        if (g_isAsyncRunning.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        if (g_records == nullptr)
+        {
+            g_records = std::make_unique<AsyncLogRecord[]>(ASYNC_RECORDS_CAPACITY);
+            for (size_t i = 0; i < ASYNC_RECORDS_CAPACITY; i++)
+            {
+                g_records[i].sequence.store(i, std::memory_order_relaxed);
+            }
+            g_pushPosition.store(0, std::memory_order_relaxed);
+            g_writePosition.store(0, std::memory_order_relaxed);
+        }
+        g_overflowPolicy = overflowPolicy;
+
+        // Install crash handlers that write pending messages before the process dies
+        for (size_t i = 0; i < std::size(CRASH_SIGNALS); i++)
+        {
+            g_previousSignalHandlers[i] = std::signal(CRASH_SIGNALS[i], onCrashSignal);
+        }
+        g_previousTerminateHandler = std::set_terminate(onTerminate);
+
+        g_isAsyncRunning.store(true, std::memory_order_release);
+        g_loggerThread = std::thread(loggerThreadFunction);
+    }
+
+    void stopAsyncLogging()
+    {
+        if (!g_isAsyncRunning.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        g_isAsyncRunning.store(false, std::memory_order_release);
+        g_wakeCondition.notify_one();
+        if (g_loggerThread.joinable())
+        {
+            g_loggerThread.join();
+        }
+
+        // Restore previous crash handlers
+        for (size_t i = 0; i < std::size(CRASH_SIGNALS); i++)
+        {
+            std::signal(CRASH_SIGNALS[i], (g_previousSignalHandlers[i] != SIG_ERR) ? g_previousSignalHandlers[i] : SIG_DFL);
+        }
+        std::set_terminate(g_previousTerminateHandler);
+        g_previousTerminateHandler = nullptr;
+    }
+
+    void flush()
+    {
+        if (t_writesSynchronously || !g_isAsyncRunning.load(std::memory_order_acquire))
+        {
+            return;
+        }
+        // Wait until logger thread writes all records pushed so far
+        const size_t position = g_pushPosition.load(std::memory_order_acquire);
+        while (g_writePosition.load(std::memory_order_acquire) < position)
+        {
+            g_wakeCondition.notify_one();
+            std::this_thread::yield();
+        }
+    }
+
+#endif // PK_LOGGER_ASYNC_SUPPORT
+
 #endif // PK_LOGGER_SUPPORT
 
+#if !(PK_LOGGER_SUPPORT && PK_LOGGER_ASYNC_SUPPORT)
+    void startAsyncLogging(AsyncOverflowPolicy overflowPolicy) {}
+    void stopAsyncLogging() {}
+    void flush() {}
+#endif
+
 } // namespace Logger
 } // namespace Pekan
\ No newline at end of file
@@ -48,6 +48,11 @@
 #define PK_LOGGER_CONSOLE_SUPPORT 1
 #define PK_LOGGER_FILE_SUPPORT 1
 
+// Toggle this macro on/off to enable/disable support for asynchronous logging,
+// where log messages are written to the console and/or log file by a background thread
+// instead of by the thread that logs them.
+#define PK_LOGGER_ASYNC_SUPPORT 1
+
 // Default values for the environment variables
 //     PEKAN_LOGGER_ERROR_ENABLED
 //     PEKAN_LOGGER_WARNING_ENABLED
@@ -151,6 +156,34 @@ namespace Logger
 	void _logAssertToConsole(const char* msg, const char* sender, const char* condition);
 	void _logAssertToConsole(const char* condition);
 
+	// What asynchronous logging does with a log message when its buffer is full
+	enum class AsyncOverflowPolicy
+	{
+		// Message is dropped, and the number of dropped messages is reported later.
+		// Logging never blocks.
+		Drop,
+		// Caller waits until there is space in the buffer.
+		// No message is lost, but logging blocks if messages are logged faster than they can be written.
+		Block
+	};
+
+	// Starts asynchronous logging.
+	// Log messages are then copied into a lock-free buffer,
+	// and a background thread writes them to the console and/or log file,
+	// so that logging never waits for I/O.
+	// Messages logged before std::terminate() are flushed before the process dies.
+	// Messages logged before a crash signal are written to standard error, on a best-effort basis,
+	// because only async-signal-safe work can be done inside a signal handler.
+	//
+	// NOTE: Messages too long to fit in the buffer are still written synchronously.
+	void startAsyncLogging(AsyncOverflowPolicy overflowPolicy);
+	// Stops asynchronous logging, writing all remaining messages.
+	// Logging is synchronous again after that.
+	void stopAsyncLogging();
+	// Waits until all messages logged so far are written.
+	// Does nothing if asynchronous logging is not started.
+	void flush();
+
 #if PK_LOGGER_SUPPORT
 	#if PK_LOGGER_USE_FILEPATH_FOR_SOURCE_FILE
 		// Filepath of current source file where logger is used
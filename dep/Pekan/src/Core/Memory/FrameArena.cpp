@@ -0,0 +1,87 @@
+#include "FrameArena.h"
+
+#include "PekanLogger.h"
+
+#include <cstdint>
+
+namespace Pekan
+{
+
+	// Arena's buffer
+	alignas(std::max_align_t) static unsigned char g_buffer[FrameArena::CAPACITY];
+	// Offset in the buffer where next allocation will start
+	static size_t g_offset = 0;
+	// Maximum offset ever reached in a single frame
+	static size_t g_peakOffset = 0;
+	// Number of allocations that didn't fit in the arena since last reset
+	static size_t g_overflowAllocationsCount = 0;
+
+	// Checks if a given memory is inside of arena's buffer
+	static bool isInsideBuffer(const void* memory)
+	{
+		const unsigned char* bytes = static_cast<const unsigned char*>(memory);
+		return bytes >= g_buffer && bytes < g_buffer + FrameArena::CAPACITY;
+	}
+
+	void* FrameArena::allocate(size_t size, size_t alignment)
+	{
+		// Align the offset up to the requested alignment
+		const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(g_buffer) + g_offset;
+		const std::uintptr_t alignedAddress = (address + alignment - 1) & ~std::uintptr_t(alignment - 1);
+		const size_t alignedOffset = size_t(alignedAddress - reinterpret_cast<std::uintptr_t>(g_buffer));
+
+		if (alignedOffset + size > CAPACITY)
+		{
+			// Arena is full, so fall back to the global heap
+			g_overflowAllocationsCount++;
+			return ::operator new(size);
+		}
+
+		g_offset = alignedOffset + size;
+		if (g_offset > g_peakOffset)
+		{
+			g_peakOffset = g_offset;
+		}
+		return g_buffer + alignedOffset;
+	}
+
+	void FrameArena::deallocate(void* memory)
+	{
+		// Memory inside the arena is freed all at once on reset.
+		// Only memory that fell back to the global heap needs to be freed here.
+		if (memory != nullptr && !isInsideBuffer(memory))
+		{
+			::operator delete(memory);
+		}
+	}
+
+	void FrameArena::reset()
+	{
+		PK_DEBUG_CODE
+		(
+			if (g_overflowAllocationsCount > 0)
+			{
+				PK_LOG_WARNING("Frame arena overflowed with " << g_overflowAllocationsCount << " allocations falling back to the heap. Consider increasing FrameArena::CAPACITY.", "Pekan");
+			}
+		)
+
+		g_offset = 0;
+		g_overflowAllocationsCount = 0;
+	}
+
+	size_t FrameArena::getUsedSize()
+	{
+		return g_offset;
+	}
+
+	size_t FrameArena::getPeakUsedSize()
+	{
+		return g_peakOffset;
+	}
+
+	size_t FrameArena::getOverflowAllocationsCount()
+	{
+		return g_overflowAllocationsCount;
+	}
+
+} // namespace Pekan
\ No newline at end of file
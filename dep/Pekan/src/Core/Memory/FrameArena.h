@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace Pekan
+{
+
+	// A linear (bump) allocator for transient data that lives no longer than a single frame.
+	//
+	// Allocating just moves a pointer forward inside of a big preallocated buffer,
+	// and nothing is ever freed individually. Instead, the whole arena is reset at the start of each frame
+	// by PekanApplication's main loop, so memory allocated during a frame is valid only until the end of that frame.
+	//
+	// If the arena runs out of space, allocations fall back to the global heap,
+	// and in debug builds this is reported once per frame so that the capacity can be increased.
+	//
+	// NOTE: Frame arena is not thread-safe. Use it only from the main thread.
+	class FrameArena
+	{
+	public:
+
+		// Size of arena's buffer, in bytes
+		static constexpr size_t CAPACITY = 1024 * 1024;
+
+		// Allocates a given number of bytes with a given alignment.
+		// Memory is valid until next call to reset().
+		static void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+		// Deallocates memory returned by allocate().
+		// Does nothing for memory inside the arena, and frees memory that fell back to the global heap.
+		static void deallocate(void* memory);
+
+		// Resets the arena, invalidating all memory allocated from it.
+		// To be called once per frame, at the start of the frame.
+		static void reset();
+
+		// Returns number of bytes allocated from the arena since last reset
+		static size_t getUsedSize();
+		// Returns the maximum number of bytes ever allocated from the arena in a single frame
+		static size_t getPeakUsedSize();
+		// Returns number of allocations that didn't fit in the arena since last reset
+		static size_t getOverflowAllocationsCount();
+	};
+
+	// An STL-compatible allocator allocating from the frame arena.
+	// Containers using it must not outlive the frame where they are created.
+	template<typename T>
+	class FrameAllocator
+	{
+	public:
+
+		using value_type = T;
+
+		FrameAllocator() = default;
+		template<typename U>
+		FrameAllocator(const FrameAllocator<U>&) {}
+
+		T* allocate(size_t count)
+		{
+			return static_cast<T*>(FrameArena::allocate(count * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T* memory, size_t count)
+		{
+			FrameArena::deallocate(memory);
+		}
+
+		template<typename U>
+		bool operator==(const FrameAllocator<U>&) const { return true; }
+		template<typename U>
+		bool operator!=(const FrameAllocator<U>&) const { return false; }
+	};
+
+	// A vector allocating from the frame arena.
+	// Must not outlive the frame where it's created.
+	template<typename T>
+	using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+} // namespace Pekan
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "PekanLogger.h"
 #include "PekanEngine.h"
 #include "Time/FpsLimiter.h"
+#include "Memory/FrameArena.h"
 
 #include "Events/KeyEvents.h"
 #include "Events/MouseEvents.h"
@@ -60,8 +61,13 @@ namespace Pekan
         Window& window = PekanEngine::s_window;
         while (!window.shouldBeClosed())
         {
-            // Process all pending events, calling the handler function of each one.
+            // Free all transient memory allocated during previous frame
+            FrameArena::reset();
+
+            // Poll window's events. Window only records them as pending events.
             glfwPollEvents();
+            // Process all pending events, calling the handler function of each one.
+            dispatchPendingEvents();
             // Process all remaining events - those that were not handled by their handler function,
             // and instead were added to the event queue.
             handleEventQueue();
@@ -72,15 +78,27 @@ namespace Pekan
 
             // Get delta time - time passed since last frame
             const double deltaTime = m_deltaTimer.getDeltaTime();
+            if (deltaTime > 0.0)
+            {
+                m_frameTimeStats.addFrameTime(deltaTime * 1000.0);
+            }
 
-            // Update and render all layers of the layer stack
+            // Update all layers of the layer stack
             m_layerStack.updateAll(deltaTime);
+
+            // Re-sample mouse position right before rendering,
+            // and let layers update whatever follows the mouse
+            window.latchMousePosition();
+            m_layerStack.lateUpdateAll();
+
+            // Render all layers of the layer stack
             m_layerStack.renderAll();
 
             // Swap buffers to show the new frame on screen.
             // If we are using VSync this function will automatically wait
             // the correct amount of time before the next screen update.
             window.swapBuffers();
+            m_inputLatency = (glfwGetTime() - window.getMouseLatchTime()) * 1000.0;
             // If there is a target FPS, then we need to manually wait some amount of time
             if (fps > 0.0)
             {
@@ -96,6 +114,21 @@ namespace Pekan
         // Exit all layers of the layer stack
         m_layerStack.exitAll();
 
+        // Detach all event listeners that are still registered,
+        // because they might outlive the application
+        EventListener* listener = m_firstEventListener;
+        while (listener != nullptr)
+        {
+            EventListener* nextListener = listener->m_nextListener;
+            listener->m_application = nullptr;
+            listener->m_previousListener = nullptr;
+            listener->m_nextListener = nullptr;
+            listener = nextListener;
+        }
+        m_firstEventListener = nullptr;
+        m_lastEventListener = nullptr;
+        m_nextEventListenerToDispatch = nullptr;
+
         // Exit engine
         PekanEngine::exit();
 
@@ -111,26 +144,68 @@ namespace Pekan
             PK_LOG_ERROR("Trying to register a NULL event listener in PekanApplication. It will be ignored.", "Pekan");
             return;
         }
-        m_eventListeners.push_back(listener);
+        EventListener* eventListener = listener.get();
+        if (eventListener->m_application != nullptr)
+        {
+            PK_LOG_ERROR("Trying to register an event listener that is already registered in a PekanApplication. It will be ignored.", "Pekan");
+            return;
+        }
+
+        // Link event listener at the end of the list of registered event listeners
+        eventListener->m_application = this;
+        eventListener->m_previousListener = m_lastEventListener;
+        eventListener->m_nextListener = nullptr;
+        if (m_lastEventListener != nullptr)
+        {
+            m_lastEventListener->m_nextListener = eventListener;
+        }
+        else
+        {
+            m_firstEventListener = eventListener;
+        }
+        m_lastEventListener = eventListener;
     }
 
     void PekanApplication::unregisterEventListener(const std::shared_ptr<EventListener>& listener)
     {
         PK_ASSERT(isValid(), "Trying to unregister an event listener from a PekanApplication that is not yet initialized.", "Pekan");
 
-        m_eventListeners.erase
-        (
-            std::remove_if
-            (
-                m_eventListeners.begin(), m_eventListeners.end(),
-                [&listener](const std::weak_ptr<EventListener>& otherListener)
-                {
-                    // Check if both pointers point to the same object
-                    return !otherListener.owner_before(listener) && !listener.owner_before(otherListener);
-                }
-            ),
-            m_eventListeners.end()
-        );
+        if (listener == nullptr || listener->m_application != this)
+        {
+            return;
+        }
+        unlinkEventListener(listener.get());
+    }
+
+    void PekanApplication::unlinkEventListener(EventListener* listener)
+    {
+        // If listener is the next one to be notified of the event currently being dispatched,
+        // then the next one after it should be notified instead
+        if (m_nextEventListenerToDispatch == listener)
+        {
+            m_nextEventListenerToDispatch = listener->m_nextListener;
+        }
+
+        if (listener->m_previousListener != nullptr)
+        {
+            listener->m_previousListener->m_nextListener = listener->m_nextListener;
+        }
+        else
+        {
+            m_firstEventListener = listener->m_nextListener;
+        }
+        if (listener->m_nextListener != nullptr)
+        {
+            listener->m_nextListener->m_previousListener = listener->m_previousListener;
+        }
+        else
+        {
+            m_lastEventListener = listener->m_previousListener;
+        }
+
+        listener->m_application = nullptr;
+        listener->m_previousListener = nullptr;
+        listener->m_nextListener = nullptr;
     }
 
     void PekanApplication::stopRunning()
@@ -142,24 +217,75 @@ namespace Pekan
         PekanEngine::s_window.setShouldBeClosed(true);
     }
 
-    // Sends an event of a given type to layers of the layer stack,
-    // one by one, until a layer successfully handles the event.
-    // If no layer successfully handles the event, then the event is sent to all registered event listeners.
-    // If event is still not handled, it will be pushed to the event queue.
-    //
-    // WARNING: Leaves the original event object in an invalid state. Make sure you DON'T use it after calling this function.
     template<typename EventT>
-    static void _dispatchEvent
-    (
-        std::unique_ptr<EventT>& event,
-        LayerStack& layerStack,
-        std::vector<std::weak_ptr<EventListener>> eventListeners,
-        EventQueue& eventQueue,
-        bool (EventListener::*onEventFunc)(const EventT&)
-    )
+    void PekanApplication::pushPendingEvent(const EventT& event)
+    {
+        // If there are too many pending events, dispatch them now to make space for the new one
+        if (m_pendingEvents.full())
+        {
+            dispatchPendingEvents();
+        }
+        m_pendingEvents.push(event);
+    }
+
+    void PekanApplication::dispatchPendingEvents()
+    {
+        while (!m_pendingEvents.empty())
+        {
+            dispatchQueuedEvent(m_pendingEvents.frontTagged());
+            m_pendingEvents.pop();
+        }
+    }
+
+    void PekanApplication::dispatchQueuedEvent(const QueuedEvent& queuedEvent)
+    {
+        std::visit
+        (
+            [this](const auto& event)
+            {
+                using EventT = std::decay_t<decltype(event)>;
+                if constexpr (std::is_same_v<EventT, KeyPressedEvent>)
+                {
+                    dispatchEvent(event, &EventListener::onKeyPressed);
+                }
+                else if constexpr (std::is_same_v<EventT, KeyReleasedEvent>)
+                {
+                    dispatchEvent(event, &EventListener::onKeyReleased);
+                }
+                else if constexpr (std::is_same_v<EventT, MouseMovedEvent>)
+                {
+                    dispatchEvent(event, &EventListener::onMouseMoved);
+                }
+                else if constexpr (std::is_same_v<EventT, MouseScrolledEvent>)
+                {
+                    dispatchEvent(event, &EventListener::onMouseScrolled);
+                }
+                else if constexpr (std::is_same_v<EventT, MouseButtonPressedEvent>)
+                {
+                    dispatchEvent(event, &EventListener::onMouseButtonPressed);
+                }
+                else if constexpr (std::is_same_v<EventT, MouseButtonReleasedEvent>)
+                {
+                    dispatchEvent(event, &EventListener::onMouseButtonReleased);
+                }
+                else if constexpr (std::is_same_v<EventT, WindowResizedEvent>)
+                {
+                    dispatchEvent(event, &EventListener::onWindowResized);
+                }
+                else if constexpr (std::is_same_v<EventT, WindowClosedEvent>)
+                {
+                    dispatchEvent(event, &EventListener::onWindowClosed);
+                }
+            },
+            queuedEvent
+        );
+    }
+
+    template<typename EventT>
+    void PekanApplication::dispatchEvent(const EventT& event, bool (EventListener::*onEventFunc)(const EventT&))
     {
         // Dispatch event to the layer stack
-        if (layerStack.dispatchEvent(event, onEventFunc))
+        if (m_layerStack.dispatchEvent(event, onEventFunc))
         {
             return;
         }
@@ -167,28 +293,26 @@ namespace Pekan
         bool handled = false;
 
         // If event was not handled by the layer stack,
-        // call the onEventFunc on all registered event listeners
-        for (auto it = eventListeners.begin(); it != eventListeners.end(); )
+        // call the onEventFunc on all registered event listeners.
+        // Next listener is kept in a member, so that a listener can unregister itself, or another listener, while being notified.
+        m_nextEventListenerToDispatch = m_firstEventListener;
+        while (m_nextEventListenerToDispatch != nullptr)
         {
-            if (auto listener = it->lock())
+            EventListener* listener = m_nextEventListenerToDispatch;
+            m_nextEventListenerToDispatch = listener->m_nextListener;
+            if ((listener->*onEventFunc)(event))
             {
-                if ((listener.get()->*onEventFunc)(*event.get()))
-                {
-                    handled = true;
-                }
-                ++it;
-            }
-            else
-            {
-                // Listener is expired, so remove it
-                it = eventListeners.erase(it);
+                handled = true;
             }
         }
 
         // If event is still not handled, add it to event queue
         if (!handled)
         {
-            eventQueue.push(std::move(event));
+            if (!m_eventQueue.push(event))
+            {
+                PK_LOG_WARNING("Event queue is full. An unhandled event will be dropped.", "Pekan");
+            }
         }
     }
 
@@ -200,20 +324,17 @@ namespace Pekan
         {
             case GLFW_PRESS:
             {
-                std::unique_ptr<KeyPressedEvent> event = std::make_unique<KeyPressedEvent>(key, false);
-                _dispatchEvent(event, m_layerStack, m_eventListeners, m_eventQueue, &EventListener::onKeyPressed);
+                pushPendingEvent(KeyPressedEvent(key, false));
                 break;
             }
             case GLFW_RELEASE:
             {
-                std::unique_ptr<KeyReleasedEvent> event = std::make_unique<KeyReleasedEvent>(key);
-                _dispatchEvent(event, m_layerStack, m_eventListeners, m_eventQueue, &EventListener::onKeyReleased);
+                pushPendingEvent(KeyReleasedEvent(key));
                 break;
             }
             case GLFW_REPEAT:
             {
-                std::unique_ptr<KeyPressedEvent> event = std::make_unique<KeyPressedEvent>(key, true);
-                _dispatchEvent(event, m_layerStack, m_eventListeners, m_eventQueue, &EventListener::onKeyPressed);
+                pushPendingEvent(KeyPressedEvent(key, true));
                 break;
             }
         }
@@ -223,16 +344,14 @@ namespace Pekan
     {
         PK_ASSERT(isValid(), "Trying to handle a mouse-moved event in a PekanApplication that is not yet initialized.", "Pekan");
 
-        std::unique_ptr<MouseMovedEvent> event = std::make_unique<MouseMovedEvent>(float(xPos), float(yPos));
-        _dispatchEvent(event, m_layerStack, m_eventListeners, m_eventQueue, &EventListener::onMouseMoved);
+        pushPendingEvent(MouseMovedEvent(float(xPos), float(yPos)));
     }
 
     void PekanApplication::handleMouseScrolledEvent(double xOffset, double yOffset)
     {
         PK_ASSERT(isValid(), "Trying to handle a mouse-scrolled event in a PekanApplication that is not yet initialized.", "Pekan");
 
-        std::unique_ptr<MouseScrolledEvent> event = std::make_unique<MouseScrolledEvent>(float(xOffset), float(yOffset));
-        _dispatchEvent(event, m_layerStack, m_eventListeners, m_eventQueue, &EventListener::onMouseScrolled);
+        pushPendingEvent(MouseScrolledEvent(float(xOffset), float(yOffset)));
     }
 
     void PekanApplication::handleMouseButtonEvent(MouseButton button, int action, int mods)
@@ -243,14 +362,12 @@ namespace Pekan
         {
             case GLFW_PRESS:
             {
-                std::unique_ptr<MouseButtonPressedEvent> event = std::make_unique<MouseButtonPressedEvent>(button);
-                _dispatchEvent(event, m_layerStack, m_eventListeners, m_eventQueue, &EventListener::onMouseButtonPressed);
+                pushPendingEvent(MouseButtonPressedEvent(button));
                 break;
             }
             case GLFW_RELEASE:
             {
-                std::unique_ptr<MouseButtonReleasedEvent> event = std::make_unique<MouseButtonReleasedEvent>(button);
-                _dispatchEvent(event, m_layerStack, m_eventListeners, m_eventQueue, &EventListener::onMouseButtonReleased);
+                pushPendingEvent(MouseButtonReleasedEvent(button));
                 break;
             }
         }
@@ -260,16 +377,14 @@ namespace Pekan
     {
         PK_ASSERT(isValid(), "Trying to handle a window-resized event in a PekanApplication that is not yet initialized.", "Pekan");
 
-        std::unique_ptr<WindowResizedEvent> event = std::make_unique<WindowResizedEvent>(width, height);
-        _dispatchEvent(event, m_layerStack, m_eventListeners, m_eventQueue, &EventListener::onWindowResized);
+        pushPendingEvent(WindowResizedEvent(width, height));
     }
 
     void PekanApplication::handleWindowClosedEvent()
     {
         PK_ASSERT(isValid(), "Trying to handle a window-closed event in a PekanApplication that is not yet initialized.", "Pekan");
 
-        std::unique_ptr<WindowClosedEvent> event = std::make_unique<WindowClosedEvent>();
-        _dispatchEvent(event, m_layerStack, m_eventListeners, m_eventQueue, &EventListener::onWindowClosed);
+        pushPendingEvent(WindowClosedEvent());
     }
 
 } // namespace Pekan
\ No newline at end of file
@@ -1,10 +1,12 @@
 #pragma once
 
-#include "Events/Event.h"
+#include "Events/EventQueue.h"
 #include "Events/EventListener.h"
 #include "LayerStack.h"
 #include "Time/DeltaTimer.h"
+#include "Time/FrameTimeStats.h"
 #include "Window.h"
+#include "PekanLogger.h"
 
 #include <string>
 #include <memory>
@@ -29,6 +31,12 @@ namespace Pekan
 
 		// Number of samples per pixel to be used for multisampling
 		int numberOfSamples = 1;
+
+		// Flag indicating if log messages should be written asynchronously, by a background thread,
+		// so that logging doesn't slow down application's frames.
+		bool useAsyncLogging = true;
+		// What to do with a log message if asynchronous logging can't keep up
+		Logger::AsyncOverflowPolicy logOverflowPolicy = Logger::AsyncOverflowPolicy::Drop;
 	};
 
 	// A base class for all Pekan applications
@@ -37,8 +45,11 @@ namespace Pekan
 		// We need class Window as a friend class
 		// because Window needs to send events to PekanApplication
 		// using the handleKeyEvent(), handleMouseMovedEvent(), etc. functions,
-		// and these functions are private because we don't want anyone else to be able to call them.
+		// and these functions are not public because we don't want anyone else to be able to call them.
 		friend class Window;
+		// We need class EventListener as a friend class
+		// because an EventListener needs to unlink itself from the application when it's destroyed
+		friend class EventListener;
 
 	public:
 
@@ -52,7 +63,8 @@ namespace Pekan
 
 		virtual std::string getName() const { return ""; }
 
-		// Registers an event listener to be notified when an event occurs in this application
+		// Registers an event listener to be notified when an event occurs in this application.
+		// Application does NOT own the event listener. It's automatically unregistered when destroyed.
 		void registerEventListener(const std::shared_ptr<EventListener>& eventListener);
 		// Unregisters an event listener. It will no longer be notified when an event occurs in this application.
 		void unregisterEventListener(const std::shared_ptr<EventListener>& eventListener);
@@ -67,21 +79,23 @@ namespace Pekan
 		// Checks if application is valid, meaning that it has been initialized and not yet exited
 		bool isValid() const { return m_isInitialized; }
 
-	private: /* functions */
+		// Returns the time from late-latching mouse position to presenting last frame, in milliseconds.
+		// This is the part of input-to-photon latency that is under application's control.
+		double getInputLatency() const { return m_inputLatency; }
 
-		// Can be implemented by derived classes with specific initialization logic.
-		// @return true on success
-		virtual bool _init() { return true; }
+		// Returns stats of durations of most recent frames, like percentiles, used to measure how stable frame pacing is
+		const FrameTimeStats& getFrameTimeStats() const { return m_frameTimeStats; }
 
-		// To be implemented by derived classes to fill layer stack with application's layers.
-		// @return true on success
-		virtual bool _fillLayerStack(LayerStack& layerStack) = 0;
+	protected: /* functions */
 
 		// Functions that are called when an event occurs.
 		// Each of these functions handles a specific type of event
 		// by sending it to each layer of the application, one by one, until a layer succesfully handles the event.
 		// The order of layers receiving the event is the opposite of the order of rendering,
 		// meaning that layers drawn last (on top) receive events first.
+		//
+		// NOTE: Normally only Window calls these functions, as events occur.
+		//       Derived classes can call them to simulate events, for example to measure how fast events are dispatched.
 		void handleKeyEvent(KeyCode key, int scancode, int action, int mods);
 		void handleMouseMovedEvent(double xPos, double yPos);
 		void handleMouseScrolledEvent(double xOffset, double yOffset);
@@ -89,6 +103,9 @@ namespace Pekan
 		void handleWindowResizedEvent(int width, int height);
 		void handleWindowClosedEvent();
 
+		// Dispatches all pending events, in the order they occurred
+		void dispatchPendingEvents();
+
 		// Handles the event queue.
 		// The event queue is a queue of left-over events that were not handled by any layer or any event listener.
 		//
@@ -96,6 +113,34 @@ namespace Pekan
 		// NOTE: Make sure to pop all events from the queue, otherwise they will keep piling up.
 		virtual void handleEventQueue() { while (!m_eventQueue.empty()) { m_eventQueue.pop(); } }
 
+	private: /* functions */
+
+		// Can be implemented by derived classes with specific initialization logic.
+		// @return true on success
+		virtual bool _init() { return true; }
+
+		// To be implemented by derived classes to fill layer stack with application's layers.
+		// @return true on success
+		virtual bool _fillLayerStack(LayerStack& layerStack) = 0;
+
+		// Pushes an event to the pending events, to be dispatched on next call to dispatchPendingEvents()
+		template<typename EventT>
+		void pushPendingEvent(const EventT& event);
+
+		// Dispatches an event of any type
+		void dispatchQueuedEvent(const QueuedEvent& queuedEvent);
+
+		// Sends an event of a given type to layers of the layer stack,
+		// one by one, until a layer successfully handles the event.
+		// If no layer successfully handles the event, then the event is sent to all registered event listeners.
+		// If event is still not handled, it will be pushed to the event queue.
+		template<typename EventT>
+		void dispatchEvent(const EventT& event, bool (EventListener::*onEventFunc)(const EventT&));
+
+		// Removes a given event listener from the list of registered event listeners
+		void unlinkEventListener(EventListener* eventListener);
+
+
 	private: /* variables */
 
 		// Stack of layers making up the application
@@ -104,12 +149,28 @@ namespace Pekan
 		// Event queue where events are pushed if they are not handled by any layer or any event listener.
 		EventQueue m_eventQueue;
 
-		// List of registered event listeners that need to be notified when an event occurs
-		std::vector<std::weak_ptr<EventListener>> m_eventListeners;
+		// Events that occurred but are not yet dispatched.
+		// Window pushes events here as they occur, and they are all dispatched right after polling window's events.
+		EventQueue m_pendingEvents;
+
+		// First and last event listener in the list of registered event listeners that need to be notified when an event occurs.
+		// The list is an intrusive list, event listeners are linked to each other.
+		EventListener* m_firstEventListener = nullptr;
+		EventListener* m_lastEventListener = nullptr;
+
+		// Next event listener to be notified of the event that is currently being dispatched.
+		// Kept here so that an event listener can be safely unregistered while an event is being dispatched.
+		EventListener* m_nextEventListenerToDispatch = nullptr;
 
 		// Delta timer used to keep track of time passed since last frame was rendered
 		DeltaTimer m_deltaTimer;
 
+		// Time from late-latching mouse position to presenting last frame, in milliseconds
+		double m_inputLatency = 0.0;
+
+		// Stats of durations of most recent frames
+		FrameTimeStats m_frameTimeStats;
+
 		// A flag indicating if application has been initialized and not yet exited
 		bool m_isInitialized = false;
 	};
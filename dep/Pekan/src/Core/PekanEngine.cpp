@@ -34,6 +34,12 @@ namespace Pekan
 
         // Get application's properties
         const ApplicationProperties properties = application->getProperties();
+        // Start writing log messages on a background thread, if application wants to
+        if (properties.useAsyncLogging)
+        {
+            Logger::startAsyncLogging(properties.logOverflowPolicy);
+        }
+
         // Create a window with application's properties
         if (!s_window.create(properties))
         {
@@ -61,6 +67,9 @@ namespace Pekan
         // Exit all subsystems
         SubsystemManager::exitAll();
 
+        // Write all remaining log messages and stop asynchronous logging
+        Logger::stopAsyncLogging();
+
         s_isInitialized = false;
     }
 
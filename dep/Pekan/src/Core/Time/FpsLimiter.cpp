@@ -1,5 +1,22 @@
 #include "Time/FpsLimiter.h"
 
+#include <algorithm>
+
+#if PEKAN_FPS_LIMITER_IMPL_HYBRID
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+// Defined only by newer Windows SDKs
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#else
+#include <time.h>
+#include <cerrno>
+#endif
+#endif
+
 using namespace std::chrono;
 using TimePoint = std::chrono::high_resolution_clock::time_point;
 using Duration = std::chrono::duration<double>;
@@ -59,4 +76,131 @@ namespace Pekan
 
 #endif
 
+#if PEKAN_FPS_LIMITER_IMPL_HYBRID
+
+    // Initial margin before the deadline where sleeping stops, in seconds
+    static constexpr double INITIAL_SLEEP_MARGIN = 0.001;
+    // Minimum and maximum margin before the deadline where sleeping stops, in seconds
+    static constexpr double MIN_SLEEP_MARGIN = 0.0002;
+    static constexpr double MAX_SLEEP_MARGIN = 0.004;
+#ifdef _WIN32
+    // Maximum margin before the deadline where sleeping stops, in seconds,
+    // when sleeping with Windows' default timer, which ticks every 15.6 ms
+    static constexpr double MAX_SLEEP_MARGIN_DEFAULT_TIMER = 0.016;
+#endif
+    // How many times bigger than the average oversleep should the margin be
+    static constexpr double SLEEP_MARGIN_FACTOR = 1.5;
+    // Weight of a new oversleep in the average oversleep
+    static constexpr double OVERSLEEP_SMOOTHING = 0.05;
+
+    FpsLimiter::FpsLimiter(double targetFps)
+        : m_targetFrameDuration(duration_cast<steady_clock::duration>(Duration(1.0 / targetFps)))
+        , m_deadline(steady_clock::now() + m_targetFrameDuration)
+        , m_sleepMargin(INITIAL_SLEEP_MARGIN)
+        , m_averageOversleep(0.0)
+        , m_maxSleepMargin(MAX_SLEEP_MARGIN)
+    {
+#ifdef _WIN32
+        // High-resolution timers are supported since Windows 10, version 1803
+        m_timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+        if (m_timer == nullptr)
+        {
+            m_maxSleepMargin = MAX_SLEEP_MARGIN_DEFAULT_TIMER;
+        }
+#endif
+    }
+
+#ifdef _WIN32
+    FpsLimiter::~FpsLimiter()
+    {
+        if (m_timer != nullptr)
+        {
+            CloseHandle(m_timer);
+        }
+    }
+#endif
+
+    void FpsLimiter::wait()
+    {
+        steady_clock::time_point now = steady_clock::now();
+
+        // If frame took longer than its deadline, don't try to catch up by rushing next frames.
+        // Just start counting again from now.
+        if (now >= m_deadline)
+        {
+            m_deadline = now + m_targetFrameDuration;
+            return;
+        }
+
+        // Sleep until a margin before the deadline
+        const steady_clock::time_point wakeUpTarget = m_deadline - duration_cast<steady_clock::duration>(Duration(m_sleepMargin));
+        if (now < wakeUpTarget)
+        {
+            sleepUntil(wakeUpTarget);
+            now = steady_clock::now();
+            updateSleepMargin(Duration(now - wakeUpTarget).count());
+        }
+
+        // Actively wait for the rest of the time
+        while (now < m_deadline)
+        {
+            now = steady_clock::now();
+        }
+
+        m_deadline += m_targetFrameDuration;
+    }
+
+    void FpsLimiter::sleepUntil(steady_clock::time_point timePoint) const
+    {
+#ifdef _WIN32
+        if (m_timer != nullptr)
+        {
+            // A negative due time is relative to now, in units of 100 nanoseconds
+            const long long dueTime100ns = duration_cast<nanoseconds>(timePoint - steady_clock::now()).count() / 100;
+            if (dueTime100ns <= 0)
+            {
+                return;
+            }
+            LARGE_INTEGER dueTime;
+            dueTime.QuadPart = -dueTime100ns;
+            if (SetWaitableTimerEx(m_timer, &dueTime, 0, nullptr, nullptr, nullptr, 0))
+            {
+                WaitForSingleObject(m_timer, INFINITE);
+                return;
+            }
+        }
+        std::this_thread::sleep_until(timePoint);
+#else
+        // steady_clock is based on CLOCK_MONOTONIC,
+        // so we can sleep until an absolute time point instead of for a relative duration,
+        // which doesn't lose precision if we get interrupted or preempted before going to sleep.
+        const nanoseconds sinceEpoch = duration_cast<nanoseconds>(timePoint.time_since_epoch());
+        timespec deadline;
+        deadline.tv_sec = time_t(sinceEpoch.count() / 1000000000);
+        deadline.tv_nsec = long(sinceEpoch.count() % 1000000000);
+        // Sleep again if sleep is interrupted by a signal
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) == EINTR)
+        { /* nothing */ }
+#endif
+    }
+
+    void FpsLimiter::updateSleepMargin(double oversleep)
+    {
+        m_averageOversleep = m_averageOversleep * (1.0 - OVERSLEEP_SMOOTHING) + oversleep * OVERSLEEP_SMOOTHING;
+
+        if (oversleep > m_sleepMargin)
+        {
+            // We woke up after the deadline, so grow the margin right away
+            m_sleepMargin = oversleep * SLEEP_MARGIN_FACTOR;
+        }
+        else
+        {
+            // Sleeps are accurate enough, so slowly shrink the margin towards the average oversleep
+            m_sleepMargin = m_sleepMargin * (1.0 - OVERSLEEP_SMOOTHING) + m_averageOversleep * SLEEP_MARGIN_FACTOR * OVERSLEEP_SMOOTHING;
+        }
+        m_sleepMargin = std::clamp(m_sleepMargin, MIN_SLEEP_MARGIN, m_maxSleepMargin);
+    }
+
+#endif
+
 } // namespace Pekan
\ No newline at end of file
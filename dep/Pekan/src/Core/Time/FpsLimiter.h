@@ -3,7 +3,7 @@
 #include <chrono>
 #include <thread>
 
-// We have 2 different implementations of the FPS limiter:
+// We have 3 different implementations of the FPS limiter:
 //
 // 1. Sleep Compensate
 // Each frame this implementation tries to sleep the exact amount needed
@@ -18,16 +18,29 @@
 // Each frame this implementation actively waits in a loop, without sleeping,
 // the exact amount needed so that the current frame takes 1 / target FPS.
 //
+// 3. Hybrid
+// Each frame this implementation sleeps until a small margin before the frame's deadline,
+// and then actively waits in a loop for the rest of the time.
+// Deadlines are absolute, one target frame duration apart, so errors don't accumulate.
+// The margin adapts to how much the OS oversleeps - it grows quickly when we wake up late,
+// and shrinks slowly while sleeps are accurate.
+// On Linux it sleeps with clock_nanosleep() on an absolute deadline, which is more accurate than std::this_thread::sleep_for().
+// On Windows it sleeps with a high-resolution waitable timer, because the default timer ticks only every 15.6 ms.
+// If that's not available, the margin is allowed to grow to a whole tick of the default timer.
+//
 // Which one to use?
 // - Sleep Compensate has lower CPU usage (like 10x lower),
 //   but it doesn't hit the target FPS perfectly - resulting FPS might be different from target FPS by 1-2 frames.
 //   There is also sometimes a little "stutter" where 2 frames are rendered immediately one after the other,
 //   but it's very rarely noticable.
 // - Wait Blocking can be used for a perfectly smooth motion and hitting the target FPS perfectly at the cost of higher CPU usage (like 10x higher)
+// - Hybrid hits the target FPS as precisely as Wait Blocking, while spinning only for the margin at the end of each frame,
+//   so its CPU usage is close to Sleep Compensate's.
 //
-// Toggle these macros on/off to choose between the 2 implementations of FpsLimiter - Sleep Compensate and Sleep Loop
+// Toggle these macros on/off to choose between the 3 implementations of FpsLimiter - Sleep Compensate, Wait Blocking and Hybrid
 #define PEKAN_FPS_LIMITER_IMPL_SLEEP_COMPENSATE 0
-#define PEKAN_FPS_LIMITER_IMPL_WAIT_BLOCKING 1
+#define PEKAN_FPS_LIMITER_IMPL_WAIT_BLOCKING 0
+#define PEKAN_FPS_LIMITER_IMPL_HYBRID 1
 
 namespace Pekan
 {
@@ -70,4 +83,55 @@ namespace Pekan
     };
 #endif
 
+#if PEKAN_FPS_LIMITER_IMPL_HYBRID
+
+    // A class used to limit FPS in a running application
+    // by waiting some amount of time between frames.
+    class FpsLimiter
+    {
+    public:
+        FpsLimiter(double targetFps);
+#ifdef _WIN32
+        ~FpsLimiter();
+
+        FpsLimiter(const FpsLimiter&) = delete;
+        FpsLimiter& operator=(const FpsLimiter&) = delete;
+#endif
+
+        // Waits some amount of time until enough time has passed
+        // since the last call to wait() such that we hit the target FPS
+        void wait();
+
+        // Returns current margin before the deadline where sleeping stops and active waiting begins, in milliseconds
+        double getSleepMargin() const { return m_sleepMargin * 1000.0; }
+        // Returns average time that the OS overslept when asked to sleep until a given time, in milliseconds
+        double getAverageOversleep() const { return m_averageOversleep * 1000.0; }
+
+    private:
+        // Sleeps until a given time point, or a bit later
+        void sleepUntil(std::chrono::steady_clock::time_point timePoint) const;
+
+        // Updates sleep margin with a newly observed oversleep, in seconds
+        void updateSleepMargin(double oversleep);
+
+    private:
+        std::chrono::steady_clock::duration m_targetFrameDuration;
+        // Time point when current frame should end
+        std::chrono::steady_clock::time_point m_deadline;
+
+        // Margin before the deadline where sleeping stops and active waiting begins, in seconds
+        double m_sleepMargin;
+        // Exponential moving average of observed oversleep, in seconds
+        double m_averageOversleep;
+        // Maximum margin before the deadline where sleeping stops, in seconds.
+        // Depends on how precisely the OS can sleep.
+        double m_maxSleepMargin;
+
+#ifdef _WIN32
+        // High-resolution waitable timer used for sleeping, or null if it's not supported
+        void* m_timer = nullptr;
+#endif
+    };
+#endif
+
 } // namespace Pekan
\ No newline at end of file
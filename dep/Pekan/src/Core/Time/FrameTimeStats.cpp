@@ -0,0 +1,40 @@
+#include "Time/FrameTimeStats.h"
+
+#include <algorithm>
+
+namespace Pekan
+{
+
+    void FrameTimeStats::addFrameTime(double frameTime)
+    {
+        m_frameTimes[m_nextIndex] = frameTime;
+        m_nextIndex = (m_nextIndex + 1) % FRAMES_COUNT;
+        m_framesCount = std::min(m_framesCount + 1, FRAMES_COUNT);
+    }
+
+    FrameTimePercentiles FrameTimeStats::getPercentiles() const
+    {
+        if (m_framesCount == 0)
+        {
+            return {};
+        }
+
+        // Sort a copy of frame times, so that the percentile at P is just the element at P% of the way through
+        std::array<double, FRAMES_COUNT> sortedFrameTimes;
+        std::copy(m_frameTimes.begin(), m_frameTimes.begin() + m_framesCount, sortedFrameTimes.begin());
+        std::sort(sortedFrameTimes.begin(), sortedFrameTimes.begin() + m_framesCount);
+
+        const auto getPercentile = [&](double percentile) -> double
+        {
+            const int index = std::min(int(percentile * double(m_framesCount)), m_framesCount - 1);
+            return sortedFrameTimes[index];
+        };
+
+        FrameTimePercentiles percentiles;
+        percentiles.p50 = getPercentile(0.50);
+        percentiles.p95 = getPercentile(0.95);
+        percentiles.p99 = getPercentile(0.99);
+        return percentiles;
+    }
+
+} // namespace Pekan
\ No newline at end of file
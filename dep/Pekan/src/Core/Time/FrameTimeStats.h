@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+
+namespace Pekan
+{
+
+    // Percentiles of frame times, in milliseconds
+    struct FrameTimePercentiles
+    {
+        double p50 = 0.0;
+        double p95 = 0.0;
+        double p99 = 0.0;
+    };
+
+    // A class keeping track of the durations of the last few hundred frames,
+    // used to measure how stable frame pacing is.
+    class FrameTimeStats
+    {
+    public:
+
+        // Number of most recent frames that stats are calculated over
+        static constexpr int FRAMES_COUNT = 600;
+
+        // Adds a frame's duration, in milliseconds
+        void addFrameTime(double frameTime);
+
+        // Returns percentiles of durations of most recent frames.
+        // Returns zeros if no frames have been added yet.
+        FrameTimePercentiles getPercentiles() const;
+
+        // Returns number of frames that stats are currently calculated over
+        int getFramesCount() const { return m_framesCount; }
+
+    private:
+
+        // Durations of most recent frames, in milliseconds, used as a ring buffer
+        std::array<double, FRAMES_COUNT> m_frameTimes = {};
+        // Index where next frame's duration will be written
+        int m_nextIndex = 0;
+        // Number of valid durations in the ring buffer
+        int m_framesCount = 0;
+    };
+
+} // namespace Pekan
\ No newline at end of file
@@ -0,0 +1,138 @@
+#include "MappedFile.h"
+
+#include "PekanLogger.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Pekan
+{
+
+	MappedFile::~MappedFile()
+	{
+		close();
+	}
+
+#ifdef _WIN32
+
+	bool MappedFile::open(const char* filepath)
+	{
+		close();
+
+		HANDLE fileHandle = CreateFileA(filepath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			PK_LOG_ERROR("Failed to open file for mapping: " << filepath, "Pekan");
+			return false;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart <= 0)
+		{
+			PK_LOG_ERROR("Failed to map an empty file, or to get its size: " << filepath, "Pekan");
+			CloseHandle(fileHandle);
+			return false;
+		}
+
+		HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mappingHandle == nullptr)
+		{
+			PK_LOG_ERROR("Failed to create a mapping of file: " << filepath, "Pekan");
+			CloseHandle(fileHandle);
+			return false;
+		}
+
+		const void* data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+		if (data == nullptr)
+		{
+			PK_LOG_ERROR("Failed to map file into memory: " << filepath, "Pekan");
+			CloseHandle(mappingHandle);
+			CloseHandle(fileHandle);
+			return false;
+		}
+
+		m_fileHandle = fileHandle;
+		m_mappingHandle = mappingHandle;
+		m_data = static_cast<const unsigned char*>(data);
+		m_size = size_t(fileSize.QuadPart);
+		return true;
+	}
+
+	void MappedFile::close()
+	{
+		if (m_data != nullptr)
+		{
+			UnmapViewOfFile(m_data);
+			m_data = nullptr;
+			m_size = 0;
+		}
+		if (m_mappingHandle != nullptr)
+		{
+			CloseHandle(m_mappingHandle);
+			m_mappingHandle = nullptr;
+		}
+		if (m_fileHandle != nullptr)
+		{
+			CloseHandle(m_fileHandle);
+			m_fileHandle = nullptr;
+		}
+	}
+
+#else
+
+	bool MappedFile::open(const char* filepath)
+	{
+		close();
+
+		const int fileDescriptor = ::open(filepath, O_RDONLY);
+		if (fileDescriptor < 0)
+		{
+			PK_LOG_ERROR("Failed to open file for mapping: " << filepath, "Pekan");
+			return false;
+		}
+
+		struct stat fileStatus;
+		if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size <= 0)
+		{
+			PK_LOG_ERROR("Failed to map an empty file, or to get its size: " << filepath, "Pekan");
+			::close(fileDescriptor);
+			return false;
+		}
+
+		void* data = mmap(nullptr, size_t(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+		// Mapping stays valid after the file descriptor is closed
+		::close(fileDescriptor);
+		if (data == MAP_FAILED)
+		{
+			PK_LOG_ERROR("Failed to map file into memory: " << filepath, "Pekan");
+			return false;
+		}
+		// File is going to be read from start to end, once
+		madvise(data, size_t(fileStatus.st_size), MADV_SEQUENTIAL);
+
+		m_data = static_cast<const unsigned char*>(data);
+		m_size = size_t(fileStatus.st_size);
+		return true;
+	}
+
+	void MappedFile::close()
+	{
+		if (m_data != nullptr)
+		{
+			munmap(const_cast<unsigned char*>(m_data), m_size);
+			m_data = nullptr;
+			m_size = 0;
+		}
+	}
+
+#endif
+
+} // namespace Pekan
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Pekan
+{
+
+	// A read-only memory mapping of a whole file.
+	//
+	// File's contents are not read up front. Instead, the operating system pages them in on first access,
+	// so data can be handed to the GPU straight from the mapping, without copying it into a buffer first.
+	//
+	// NOTE: Data is valid only while the file is open, and is closed when the mapped file is destroyed.
+	class MappedFile
+	{
+	public:
+
+		MappedFile() = default;
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		// Opens a given file and maps it into memory, closing the previously opened file if there is one.
+		// Returns true on success.
+		bool open(const char* filepath);
+		// Unmaps and closes the file
+		void close();
+
+		inline const unsigned char* getData() const { return m_data; }
+		// Returns file's size, in bytes
+		inline size_t getSize() const { return m_size; }
+
+		// Checks if a file is currently open and mapped
+		inline bool isOpen() const { return m_data != nullptr; }
+
+	private: /* variables */
+
+		// Start of the mapping
+		const unsigned char* m_data = nullptr;
+		// Size of the mapping, in bytes
+		size_t m_size = 0;
+
+#ifdef _WIN32
+		// Handles of the file and of the mapping object
+		void* m_fileHandle = nullptr;
+		void* m_mappingHandle = nullptr;
+#endif
+	};
+
+} // namespace Pekan
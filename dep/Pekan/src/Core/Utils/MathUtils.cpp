@@ -1,6 +1,12 @@
 #include "MathUtils.h"
 
 #include "PekanLogger.h"
+#include "Memory/FrameArena.h"
+
+#include <algorithm>
+#include <set>
+#include <cmath>
+#include <cfloat>
 
 namespace Pekan
 {
@@ -34,16 +40,457 @@ namespace MathUtils
         return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
     }
 
-    bool triangulatePolygon(const std::vector<glm::vec2>& vertices, std::vector<unsigned>& indices)
+    // Type of a polygon's vertex, depending on how the polygon's boundary goes around it,
+    // when sweeping a horizontal line over the polygon from top to bottom.
+    enum class SweepVertexType
     {
-        PK_ASSERT_QUICK(indices.empty());
-        const size_t n = vertices.size();
-        if (n < 3)
+        Start,      // Both neighbours are below, and interior angle is less than 180 degrees
+        Split,      // Both neighbours are below, and interior angle is more than 180 degrees
+        End,        // Both neighbours are above, and interior angle is less than 180 degrees
+        Merge,      // Both neighbours are above, and interior angle is more than 180 degrees
+        Regular     // One neighbour is above and the other is below
+    };
+
+    // Checks if a point P comes before a point Q when sweeping from top to bottom,
+    // meaning that P is higher than Q, or at the same height and to the left of Q.
+    static bool isAbove(glm::vec2 p, glm::vec2 q)
+    {
+        return p.y > q.y || (p.y == q.y && p.x < q.x);
+    }
+
+    // Finds diagonals splitting a CCW polygon into y-monotone polygons,
+    // sweeping a horizontal line from top to bottom, in O(n log n) time.
+    //
+    // @param[out] diagonals - Fills list with pairs of vertex indices, each pair being a diagonal
+    // @return false if polygon is too degenerate to be split, for example if it has overlapping edges
+    static bool findMonotoneDiagonals(const std::vector<glm::vec2>& vertices, FrameVector<unsigned>& diagonals)
+    {
+        const unsigned n = unsigned(vertices.size());
+
+        // Sort vertices in the order they are met by the sweep line
+        FrameVector<unsigned> order(n);
+        for (unsigned i = 0; i < n; i++)
         {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), [&](unsigned a, unsigned b) { return isAbove(vertices[a], vertices[b]); });
+
+        // Current position of the sweep line, and of the vertex being processed on it
+        float sweepY = 0.0f;
+        float sweepX = 0.0f;
+
+        // Edges are identified by the index of their first vertex, so edge i goes from vertex i to vertex i + 1.
+        // A special edge index is used to look up the vertex being processed among the edges.
+        const unsigned queryEdge = n;
+        // A lambda function returning the X coordinate where a given edge crosses the sweep line
+        const auto getEdgeX = [&](unsigned edge) -> float
+        {
+            if (edge == queryEdge)
+            {
+                return sweepX;
+            }
+            const glm::vec2 a = vertices[edge];
+            const glm::vec2 b = vertices[(edge + 1) % n];
+            if (a.y == b.y)
+            {
+                return std::min(std::max(sweepX, std::min(a.x, b.x)), std::max(a.x, b.x));
+            }
+            return a.x + (sweepY - a.y) * (b.x - a.x) / (b.y - a.y);
+        };
+        // A lambda function returning how much a given edge moves to the right per unit of going down
+        const auto getEdgeSlope = [&](unsigned edge) -> float
+        {
+            const glm::vec2 a = vertices[edge];
+            const glm::vec2 b = vertices[(edge + 1) % n];
+            if (a.y == b.y)
+            {
+                return (b.x > a.x) ? FLT_MAX : -FLT_MAX;
+            }
+            return (b.x - a.x) / (a.y - b.y);
+        };
+        // A lambda function comparing edges from left to right at the sweep line.
+        // Edges crossing the sweep line at the same point are compared by where they go below it.
+        const auto compareEdges = [&](unsigned edgeA, unsigned edgeB) -> bool
+        {
+            const float xA = getEdgeX(edgeA);
+            const float xB = getEdgeX(edgeB);
+            if (xA != xB || edgeA == queryEdge || edgeB == queryEdge)
+            {
+                return xA < xB;
+            }
+            return getEdgeSlope(edgeA) < getEdgeSlope(edgeB);
+        };
+
+        // Edges crossed by the sweep line that have polygon's interior to their right, from left to right.
+        // Edges never cross each other in a valid polygon, so their order stays the same while the sweep line moves.
+        using SweepStatus = std::set<unsigned, decltype(compareEdges), FrameAllocator<unsigned>>;
+        SweepStatus status(compareEdges);
+        FrameVector<typename SweepStatus::iterator> statusIterators(n, status.end());
+        // Helper of each edge - the lowest vertex above the sweep line, that can be connected to the edge's left side
+        FrameVector<unsigned> helpers(n, 0);
+        FrameVector<SweepVertexType> types(n, SweepVertexType::Regular);
+
+        // A lambda function adding a diagonal from a given vertex to a given edge's helper, if the helper is a merge vertex
+        const auto connectToMergeHelper = [&](unsigned vertex, unsigned edge)
+        {
+            if (types[helpers[edge]] == SweepVertexType::Merge)
+            {
+                diagonals.push_back(vertex);
+                diagonals.push_back(helpers[edge]);
+            }
+        };
+        // A lambda function inserting an edge to the sweep status
+        const auto insertEdge = [&](unsigned edge, unsigned helper) -> bool
+        {
+            const auto inserted = status.insert(edge);
+            statusIterators[edge] = inserted.first;
+            helpers[edge] = helper;
+            return inserted.second;
+        };
+        // A lambda function removing an edge from the sweep status
+        const auto removeEdge = [&](unsigned edge) -> bool
+        {
+            if (statusIterators[edge] == status.end())
+            {
+                return false;
+            }
+            status.erase(statusIterators[edge]);
+            statusIterators[edge] = status.end();
             return true;
+        };
+        // A lambda function finding the edge directly to the left of the vertex being processed
+        const auto findLeftEdge = [&](unsigned& edge) -> bool
+        {
+            auto it = status.upper_bound(queryEdge);
+            if (it == status.begin())
+            {
+                return false;
+            }
+            edge = *(--it);
+            return true;
+        };
+
+        for (const unsigned v : order)
+        {
+            sweepX = vertices[v].x;
+            sweepY = vertices[v].y;
+            const unsigned prev = (v + n - 1) % n;
+            const unsigned next = (v + 1) % n;
+            // Edge coming into v is edge "prev", and edge going out of v is edge "v"
+            const bool isPrevBelow = isAbove(vertices[v], vertices[prev]);
+            const bool isNextBelow = isAbove(vertices[v], vertices[next]);
+            const bool isConvex = isOrientationCCW(vertices[prev], vertices[v], vertices[next]);
+
+            unsigned leftEdge = 0;
+            if (isPrevBelow && isNextBelow)
+            {
+                types[v] = isConvex ? SweepVertexType::Start : SweepVertexType::Split;
+                if (!isConvex)
+                {
+                    if (!findLeftEdge(leftEdge))
+                    {
+                        return false;
+                    }
+                    diagonals.push_back(v);
+                    diagonals.push_back(helpers[leftEdge]);
+                    helpers[leftEdge] = v;
+                }
+                if (!insertEdge(v, v))
+                {
+                    return false;
+                }
+            }
+            else if (!isPrevBelow && !isNextBelow)
+            {
+                types[v] = isConvex ? SweepVertexType::End : SweepVertexType::Merge;
+                if (statusIterators[prev] == status.end())
+                {
+                    return false;
+                }
+                connectToMergeHelper(v, prev);
+                removeEdge(prev);
+                if (!isConvex)
+                {
+                    if (!findLeftEdge(leftEdge))
+                    {
+                        return false;
+                    }
+                    connectToMergeHelper(v, leftEdge);
+                    helpers[leftEdge] = v;
+                }
+            }
+            // If vertex is regular and polygon's interior is to its right,
+            // meaning that it's on the left side of the polygon, where the boundary goes down
+            else if (isNextBelow)
+            {
+                if (statusIterators[prev] == status.end())
+                {
+                    return false;
+                }
+                connectToMergeHelper(v, prev);
+                removeEdge(prev);
+                if (!insertEdge(v, v))
+                {
+                    return false;
+                }
+            }
+            // If vertex is regular and polygon's interior is to its left
+            else
+            {
+                if (!findLeftEdge(leftEdge))
+                {
+                    return false;
+                }
+                connectToMergeHelper(v, leftEdge);
+                helpers[leftEdge] = v;
+            }
+        }
+
+        return true;
+    }
+
+    // Triangulates a y-monotone polygon, given as a list of indices of its vertices in CCW order, in O(k) time.
+    // Triangles are added to the given "indices" list, in CCW order.
+    // @return false if the polygon turns out not to be y-monotone
+    static bool triangulateMonotonePolygon(const std::vector<glm::vec2>& vertices, const FrameVector<unsigned>& polygon, std::vector<unsigned>& indices)
+    {
+        const size_t k = polygon.size();
+        if (k < 3)
+        {
+            return false;
+        }
+
+        // A lambda function adding a triangle to the "indices" list, in CCW order
+        const auto addTriangle = [&](size_t a, size_t b, size_t c)
+        {
+            if (getDeterminant(vertices[polygon[a]], vertices[polygon[b]], vertices[polygon[c]]) < 0.0f)
+            {
+                std::swap(b, c);
+            }
+            indices.push_back(polygon[a]);
+            indices.push_back(polygon[b]);
+            indices.push_back(polygon[c]);
+        };
+
+        // Find top and bottom vertex
+        size_t top = 0;
+        size_t bottom = 0;
+        for (size_t i = 1; i < k; i++)
+        {
+            if (isAbove(vertices[polygon[i]], vertices[polygon[top]]))
+            {
+                top = i;
+            }
+            if (isAbove(vertices[polygon[bottom]], vertices[polygon[i]]))
+            {
+                bottom = i;
+            }
+        }
+
+        // Going in CCW order, the left chain goes down from top vertex to bottom vertex,
+        // and the right chain goes up from bottom vertex to top vertex.
+        // Merge the two chains into a list of vertices sorted from top to bottom.
+        FrameVector<size_t> sorted;
+        sorted.reserve(k);
+        FrameVector<bool> isLeft(k, false);
+        sorted.push_back(top);
+        size_t left = (top + 1) % k;
+        size_t right = (top + k - 1) % k;
+        while (left != bottom || right != bottom)
+        {
+            const bool takeLeft = (right == bottom) || (left != bottom && isAbove(vertices[polygon[left]], vertices[polygon[right]]));
+            const size_t current = takeLeft ? left : right;
+            // Each chain must strictly go down, otherwise polygon is not monotone
+            const size_t previousInChain = takeLeft ? (current + k - 1) % k : (current + 1) % k;
+            if (!isAbove(vertices[polygon[previousInChain]], vertices[polygon[current]]))
+            {
+                return false;
+            }
+            isLeft[current] = takeLeft;
+            sorted.push_back(current);
+            if (takeLeft)
+            {
+                left = (left + 1) % k;
+            }
+            else
+            {
+                right = (right + k - 1) % k;
+            }
+        }
+        sorted.push_back(bottom);
+
+        // Go through vertices from top to bottom, cutting off triangles above current vertex whenever possible.
+        // Stack holds vertices that are processed but still need to be triangulated,
+        // and they always form a reflex chain on one side of the polygon.
+        FrameVector<size_t> stack;
+        stack.reserve(k);
+        stack.push_back(sorted[0]);
+        stack.push_back(sorted[1]);
+        for (size_t j = 2; j + 1 < k; j++)
+        {
+            const size_t current = sorted[j];
+            // If current vertex is on the opposite chain from the vertices on the stack,
+            // it can be connected to all of them
+            if (isLeft[current] != isLeft[stack.back()])
+            {
+                for (size_t i = 0; i + 1 < stack.size(); i++)
+                {
+                    addTriangle(current, stack[i], stack[i + 1]);
+                }
+                const size_t previous = stack.back();
+                stack.clear();
+                stack.push_back(previous);
+                stack.push_back(current);
+            }
+            // Otherwise it can be connected to vertices on the stack as long as connecting diagonals are inside the polygon
+            else
+            {
+                size_t last = stack.back();
+                stack.pop_back();
+                while (!stack.empty())
+                {
+                    const size_t top = stack.back();
+                    const bool isInside = isLeft[current]
+                        ? isOrientationCCW(vertices[polygon[top]], vertices[polygon[last]], vertices[polygon[current]])
+                        : isOrientationCCW(vertices[polygon[current]], vertices[polygon[last]], vertices[polygon[top]]);
+                    if (!isInside)
+                    {
+                        break;
+                    }
+                    addTriangle(top, last, current);
+                    last = top;
+                    stack.pop_back();
+                }
+                stack.push_back(last);
+                stack.push_back(current);
+            }
+        }
+        // Bottom vertex can be connected to all vertices left on the stack
+        for (size_t i = 0; i + 1 < stack.size(); i++)
+        {
+            addTriangle(sorted[k - 1], stack[i], stack[i + 1]);
+        }
+
+        return true;
+    }
+
+    // Triangulates a CCW polygon by splitting it into y-monotone polygons and triangulating each one of them,
+    // in O(n log n) time.
+    // @return false if polygon is too degenerate to be triangulated this way
+    static bool triangulatePolygonMonotone(const std::vector<glm::vec2>& vertices, std::vector<unsigned>& indices)
+    {
+        const unsigned n = unsigned(vertices.size());
+
+        FrameVector<unsigned> diagonals;
+        if (!findMonotoneDiagonals(vertices, diagonals))
+        {
+            return false;
+        }
+        // If there are no diagonals, polygon is already monotone
+        if (diagonals.empty())
+        {
+            FrameVector<unsigned> polygon(n);
+            for (unsigned i = 0; i < n; i++)
+            {
+                polygon[i] = i;
+            }
+            return triangulateMonotonePolygon(vertices, polygon, indices);
+        }
+
+        // Build a list of half-edges, in pairs of opposite half-edges, so that half-edge h is opposite to half-edge h ^ 1.
+        // First come polygon's edges, each one as a half-edge going in CCW order, and an opposite one, which is on polygon's outside.
+        // Then come diagonals, each one as two half-edges, both inside of the polygon.
+        const unsigned halfEdgesCount = 2 * n + unsigned(diagonals.size());
+        FrameVector<unsigned> origins(halfEdgesCount);
+        for (unsigned i = 0; i < n; i++)
+        {
+            origins[2 * i] = i;
+            origins[2 * i + 1] = (i + 1) % n;
+        }
+        for (unsigned i = 0; i < diagonals.size(); i++)
+        {
+            origins[2 * n + i] = diagonals[i];
+        }
+
+        // Group half-edges by their origin vertex, sorting half-edges around each vertex by angle, counter-clockwise
+        FrameVector<unsigned> offsets(n + 1, 0);
+        for (const unsigned origin : origins)
+        {
+            offsets[origin + 1]++;
+        }
+        for (unsigned i = 0; i < n; i++)
+        {
+            offsets[i + 1] += offsets[i];
+        }
+        FrameVector<unsigned> outgoing(halfEdgesCount);
+        FrameVector<unsigned> filledCounts(n, 0);
+        for (unsigned h = 0; h < halfEdgesCount; h++)
+        {
+            outgoing[offsets[origins[h]] + filledCounts[origins[h]]++] = h;
+        }
+        const auto getAngle = [&](unsigned h) -> float
+        {
+            const glm::vec2 direction = vertices[origins[h ^ 1]] - vertices[origins[h]];
+            return std::atan2(direction.y, direction.x);
+        };
+        FrameVector<unsigned> positions(halfEdgesCount);
+        for (unsigned v = 0; v < n; v++)
+        {
+            std::sort(outgoing.begin() + offsets[v], outgoing.begin() + offsets[v + 1],
+                [&](unsigned a, unsigned b) { return getAngle(a) < getAngle(b); });
+            for (unsigned i = offsets[v]; i < offsets[v + 1]; i++)
+            {
+                positions[outgoing[i]] = i - offsets[v];
+            }
         }
 
-        std::vector<unsigned> remaining;
+        // Trace each face formed by polygon's edges and diagonals, and triangulate it.
+        // Following a face in CCW order, after arriving at a vertex,
+        // the next half-edge is the one right before the opposite half-edge, clockwise around the vertex.
+        FrameVector<bool> isVisited(halfEdgesCount, false);
+        FrameVector<unsigned> face;
+        for (unsigned start = 0; start < halfEdgesCount; start++)
+        {
+            const bool isOutside = (start < 2 * n && start % 2 == 1);
+            if (isOutside || isVisited[start])
+            {
+                continue;
+            }
+            face.clear();
+            unsigned h = start;
+            do
+            {
+                if (isVisited[h] || (h < 2 * n && h % 2 == 1))
+                {
+                    return false;
+                }
+                isVisited[h] = true;
+                face.push_back(origins[h]);
+                const unsigned opposite = h ^ 1;
+                const unsigned v = origins[opposite];
+                const unsigned degree = offsets[v + 1] - offsets[v];
+                h = outgoing[offsets[v] + (positions[opposite] + degree - 1) % degree];
+            }
+            while (h != start);
+
+            if (!triangulateMonotonePolygon(vertices, face, indices))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Triangulates a CCW polygon using the "Ear Clipping" algorithm, in O(n^2) time.
+    // Slower than triangulating with a sweep line, but works for more degenerate polygons,
+    // like ones with overlapping edges or coinciding vertices.
+    static bool triangulatePolygonEarClipping(const std::vector<glm::vec2>& vertices, std::vector<unsigned>& indices)
+    {
+        const size_t n = vertices.size();
+
+        FrameVector<unsigned> remaining;
+        remaining.reserve(n);
         for (unsigned i = 0; i < n; ++i)
         {
             remaining.push_back(i);
@@ -137,6 +584,24 @@ namespace MathUtils
         return true;
     }
 
+    bool triangulatePolygon(const std::vector<glm::vec2>& vertices, std::vector<unsigned>& indices)
+    {
+        PK_ASSERT_QUICK(indices.empty());
+        if (vertices.size() < 3)
+        {
+            return true;
+        }
+
+        // A valid polygon always has exactly n - 2 triangles.
+        // If the sweep line produced a different number, the polygon was too degenerate for it.
+        if (triangulatePolygonMonotone(vertices, indices) && indices.size() == (vertices.size() - 2) * 3)
+        {
+            return true;
+        }
+        indices.clear();
+        return triangulatePolygonEarClipping(vertices, indices);
+    }
+
     bool isPolygonConvex(const std::vector<glm::vec2>& vertices)
     {
         if (vertices.size() < 3)
@@ -17,8 +17,9 @@ namespace MathUtils
     // More precisely returns the determinant of vector AB and vector AC.
     float getDeterminant(glm::vec2 a, glm::vec2 b, glm::vec2 c);
 
-    // Triangulates a polygon formed by the given vertices,
-    // using the "Ear Clipping" algorithm.
+    // Triangulates a polygon formed by the given vertices in O(n log n) time,
+    // by splitting it into y-monotone polygons with a sweep line, and triangulating each one of them.
+    // Falls back to the slower "Ear Clipping" algorithm for degenerate polygons that the sweep line can't handle.
     //
     // NOTE: Expects that the given vertices will be in CCW order
     //
@@ -29,6 +29,8 @@ namespace Pekan
         glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
         // Set window hint for number of samples
         glfwWindowHint(GLFW_SAMPLES, applicationProperties.numberOfSamples);
+        // Set window hint for window's visibility
+        glfwWindowHint(GLFW_VISIBLE, m_properties.visible ? GLFW_TRUE : GLFW_FALSE);
 
         // Create a GLFW window
         if (m_properties.fullScreen)
@@ -64,8 +66,14 @@ namespace Pekan
             glfwSetInputMode(m_glfwWindow, GLFW_CURSOR, GLFW_CURSOR_HIDDEN);
         }
 
+        // Store a pointer to this window inside of the GLFW window, so that event callbacks can reach it
+        glfwSetWindowUserPointer(m_glfwWindow, this);
         setEventCallbacks();
 
+        // Start with current mouse position, because we'll only be notified of it when mouse moves
+        m_inputSnapshot.clear();
+        latchMousePosition();
+
         return true;
     }
 
@@ -115,35 +123,41 @@ namespace Pekan
 
     bool Window::isKeyPressed(KeyCode key) const
     {
-        return (glfwGetKey(m_glfwWindow, int(key)) == GLFW_PRESS || glfwGetKey(m_glfwWindow, int(key)) == GLFW_REPEAT);
+        return m_inputSnapshot.isKeyPressed(key);
     }
 
     bool Window::isKeyReleased(KeyCode key) const
     {
-        return (glfwGetKey(m_glfwWindow, int(key)) == GLFW_RELEASE);
+        return !m_inputSnapshot.isKeyPressed(key);
     }
 
     bool Window::isKeyRepeating(KeyCode key) const
     {
-        return (glfwGetKey(m_glfwWindow, int(key)) == GLFW_REPEAT);
+        return m_inputSnapshot.isKeyRepeating(key);
     }
 
     glm::vec2 Window::getMousePosition() const
     {
-        double xMouse = 0.0;
-        double yMouse = 0.0;
-        glfwGetCursorPos(m_glfwWindow, &xMouse, &yMouse);
-        return { float(xMouse), float(yMouse) };
+        return m_inputSnapshot.getMousePosition();
     }
 
     bool Window::isMouseButtonPressed(MouseButton button) const
     {
-        return glfwGetMouseButton(m_glfwWindow, int(button)) == GLFW_PRESS;
+        return m_inputSnapshot.isMouseButtonPressed(button);
     }
 
     bool Window::isMouseButtonReleased(MouseButton button) const
     {
-        return glfwGetMouseButton(m_glfwWindow, int(button)) == GLFW_RELEASE;
+        return !m_inputSnapshot.isMouseButtonPressed(button);
+    }
+
+    void Window::latchMousePosition()
+    {
+        double xMouse = 0.0;
+        double yMouse = 0.0;
+        glfwGetCursorPos(m_glfwWindow, &xMouse, &yMouse);
+        m_inputSnapshot.setMousePosition({ float(xMouse), float(yMouse) });
+        m_mouseLatchTime = glfwGetTime();
     }
 
     glm::ivec2 Window::getSize() const
@@ -192,6 +206,8 @@ namespace Pekan
 
     void Window::keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
     {
+        static_cast<Window*>(glfwGetWindowUserPointer(window))->m_inputSnapshot.onKey(KeyCode(key), action);
+
         PekanApplication* application = PekanEngine::getApplication();
         if (application != nullptr)
         {
@@ -200,6 +216,8 @@ namespace Pekan
     }
     void Window::mouseMovedCallback(GLFWwindow* window, double xPos, double yPos)
     {
+        static_cast<Window*>(glfwGetWindowUserPointer(window))->m_inputSnapshot.setMousePosition({ float(xPos), float(yPos) });
+
         PekanApplication* application = PekanEngine::getApplication();
         if (application != nullptr)
         {
@@ -216,6 +234,8 @@ namespace Pekan
     }
     void Window::mouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
     {
+        static_cast<Window*>(glfwGetWindowUserPointer(window))->m_inputSnapshot.onMouseButton(MouseButton(button), action);
+
         PekanApplication* application = PekanEngine::getApplication();
         if (application != nullptr)
         {
@@ -2,6 +2,7 @@
 
 #include "Events/KeyEvents_Enums.h"
 #include "Events/MouseEvents_Enums.h"
+#include "InputSnapshot.h"
 
 #include <string>
 #include <glm/glm.hpp>
@@ -38,6 +39,10 @@ namespace Pekan
 
 		// Flag indicating if mouse's cursor should be hidden
 		bool hideCursor = false;
+
+		// Flag indicating if window should be visible.
+		// An invisible window still has an OpenGL context, so it can be used for rendering off-screen.
+		bool visible = true;
 	};
 
 	// A class representing an OS-independent window
@@ -80,6 +85,10 @@ namespace Pekan
 		// INPUT POLLING //
 		///////////////////
 
+		// NOTE: Input is read from a snapshot that is updated while window's events are polled,
+		//       so these functions don't call the OS and return the same state during the whole frame.
+		//       Only mouse position can be re-sampled later in the frame, with latchMousePosition().
+
 		// Checks if a given key from the keyboard is currently pressed or released,
 		// or repeating which means that it had been pressed and held down for a bit, like half a second.
 		bool isKeyPressed(KeyCode key) const;
@@ -99,6 +108,12 @@ namespace Pekan
 		// Returns frame buffer's current size
 		glm::ivec2 getFrameBufferSize() const;
 
+		// Re-samples mouse position from the OS, right before rendering ("late latching"),
+		// so that whatever follows the mouse is rendered with the freshest mouse position possible.
+		void latchMousePosition();
+		// Returns time when mouse position was last latched, in seconds, as returned by glfwGetTime()
+		double getMouseLatchTime() const { return m_mouseLatchTime; }
+
 	private: /* functions */
 
 		// Connects event callbacks with the window, so that they are actually called when an event occurs.
@@ -122,6 +137,12 @@ namespace Pekan
 
 		// Window's properties
 		WindowProperties m_properties;
+
+		// Snapshot of keyboard and mouse state, updated from input callbacks
+		InputSnapshot m_inputSnapshot;
+
+		// Time when mouse position was last latched, in seconds
+		double m_mouseLatchTime = 0.0;
 	};
 
 } // namespace Pekan
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include "StatsDisplayWidget.h"
+
+#include "PekanLogger.h"
+
+#include "imgui_impl_glfw.h"
+#include "imgui_impl_opengl3.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace Pekan
+{
+namespace GUI
+{
+
+	// Default number of samples that each stat keeps, which is 2 seconds at 60 FPS
+	static constexpr int DEFAULT_WINDOW_SAMPLES_COUNT = 120;
+
+	// Color of values that are over budget
+	static const ImVec4 OVER_BUDGET_COLOR = ImVec4(1.0f, 0.35f, 0.3f, 1.0f);
+
+	void StatsDisplayWidget::create(GUIWindow* guiWindow)
+	{
+		create(guiWindow, DEFAULT_WINDOW_SAMPLES_COUNT);
+	}
+	void StatsDisplayWidget::create(GUIWindow* guiWindow, int windowSamplesCount)
+	{
+		PK_ASSERT(windowSamplesCount > 0, "Trying to create a StatsDisplayWidget with a rolling window of no samples.", "Pekan");
+
+		Widget::create(guiWindow);
+		m_windowSamplesCount = windowSamplesCount;
+	}
+	void StatsDisplayWidget::destroy()
+	{
+		m_stats.clear();
+
+		Widget::destroy();
+	}
+
+	int StatsDisplayWidget::addStat(const std::string& name)
+	{
+		PK_ASSERT(isValid(), "Trying to add stat \"" << name << "\" to a StatsDisplayWidget that is not yet created.", "Pekan");
+
+		for (size_t i = 0; i < m_stats.size(); i++)
+		{
+			if (m_stats[i].name == name)
+			{
+				return int(i);
+			}
+		}
+		Stat stat;
+		stat.name = name;
+		stat.samples.resize(m_windowSamplesCount, 0.0);
+		m_stats.push_back(std::move(stat));
+		return int(m_stats.size()) - 1;
+	}
+
+	void StatsDisplayWidget::addSample(int statIndex, double value)
+	{
+		PK_ASSERT_QUICK(statIndex >= 0 && statIndex < int(m_stats.size()));
+
+		Stat& stat = m_stats[statIndex];
+		stat.samples[stat.nextSampleIndex] = value;
+		stat.nextSampleIndex = (stat.nextSampleIndex + 1) % int(stat.samples.size());
+		stat.samplesCount = std::min(stat.samplesCount + 1, int(stat.samples.size()));
+	}
+
+	void StatsDisplayWidget::setBudget(int statIndex, double budget)
+	{
+		PK_ASSERT_QUICK(statIndex >= 0 && statIndex < int(m_stats.size()));
+		PK_ASSERT(budget >= 0.0, "Trying to set a negative budget for stat \"" << m_stats[statIndex].name << "\" in a StatsDisplayWidget.", "Pekan");
+
+		m_stats[statIndex].budget = budget;
+	}
+
+	void StatsDisplayWidget::clearBudgets()
+	{
+		for (Stat& stat : m_stats)
+		{
+			stat.budget = -1.0;
+		}
+	}
+
+	bool StatsDisplayWidget::isOverBudget(int statIndex) const
+	{
+		PK_ASSERT_QUICK(statIndex >= 0 && statIndex < int(m_stats.size()));
+
+		const Stat& stat = m_stats[statIndex];
+		if (stat.samplesCount == 0)
+		{
+			return false;
+		}
+		return isOverBudget(stat, getLatestSample(stat));
+	}
+
+	int StatsDisplayWidget::getOverBudgetSamplesCount(int statIndex) const
+	{
+		PK_ASSERT_QUICK(statIndex >= 0 && statIndex < int(m_stats.size()));
+
+		// Samples are at the beginning of the ring buffer until it's full, and then they are all of it
+		const Stat& stat = m_stats[statIndex];
+		return int(std::count_if(stat.samples.begin(), stat.samples.begin() + stat.samplesCount, [&stat](double value) { return isOverBudget(stat, value); }));
+	}
+
+	void StatsDisplayWidget::_render() const
+	{
+		PK_ASSERT_QUICK(isValid());
+
+		if (!ImGui::BeginTable("Stats", 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp))
+		{
+			return;
+		}
+		ImGui::TableSetupColumn("Stat");
+		ImGui::TableSetupColumn("Now");
+		ImGui::TableSetupColumn("Min");
+		ImGui::TableSetupColumn("Avg");
+		ImGui::TableSetupColumn("Max");
+		ImGui::TableSetupColumn("Budget");
+		ImGui::TableHeadersRow();
+
+		for (const Stat& stat : m_stats)
+		{
+			double current = 0.0;
+			double min = 0.0;
+			double max = 0.0;
+			double sum = 0.0;
+			if (stat.samplesCount > 0)
+			{
+				current = getLatestSample(stat);
+				min = stat.samples[0];
+				max = stat.samples[0];
+				// Order of samples doesn't matter here, and samples are at the beginning of the ring buffer until it's full
+				for (int i = 0; i < stat.samplesCount; i++)
+				{
+					min = std::min(min, stat.samples[i]);
+					max = std::max(max, stat.samples[i]);
+					sum += stat.samples[i];
+				}
+			}
+			const double avg = (stat.samplesCount > 0) ? sum / double(stat.samplesCount) : 0.0;
+
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(stat.name.c_str());
+
+			// Display values, highlighting ones that are over budget
+			const double values[4] = { current, min, avg, max };
+			for (double value : values)
+			{
+				ImGui::TableNextColumn();
+				if (isOverBudget(stat, value))
+				{
+					ImGui::TextColored(OVER_BUDGET_COLOR, "%.6g", value);
+				}
+				else
+				{
+					ImGui::Text("%.6g", value);
+				}
+			}
+
+			ImGui::TableNextColumn();
+			if (stat.budget >= 0.0)
+			{
+				ImGui::Text("%.6g", stat.budget);
+			}
+			else
+			{
+				ImGui::TextDisabled("-");
+			}
+		}
+
+		ImGui::EndTable();
+	}
+
+	double StatsDisplayWidget::getLatestSample(const Stat& stat)
+	{
+		PK_ASSERT_QUICK(stat.samplesCount > 0);
+
+		const int samplesSize = int(stat.samples.size());
+		return stat.samples[(stat.nextSampleIndex + samplesSize - 1) % samplesSize];
+	}
+
+	bool StatsDisplayWidget::isOverBudget(const Stat& stat, double value)
+	{
+		return stat.budget >= 0.0 && value > stat.budget;
+	}
+
+} // namespace GUI
+} // namespace Pekan
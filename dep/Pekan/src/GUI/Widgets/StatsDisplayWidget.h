@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Widget.h"
+
+#include <string>
+#include <vector>
+
+namespace Pekan
+{
+namespace GUI
+{
+
+	// A widget displaying a table of named per-frame stats,
+	// with their current value and their min, avg and max over a rolling window of recent samples.
+	// Each stat can have a budget, and values over budget are highlighted.
+	//
+	// Stats are registered once, with addStat(), and are displayed in that order.
+	// Samples and budgets are then given by stat's index, so that adding a sample every frame doesn't build any strings,
+	// and samples are kept in a fixed-size ring buffer of each stat, so that it doesn't allocate any memory either.
+	//
+	// NOTE: Instances of this class MUST be owned by a StatsDisplayWidget_Ptr
+	class StatsDisplayWidget : public Widget
+	{
+	public:
+
+		void create(GUIWindow* guiWindow);
+		void create(GUIWindow* guiWindow, int windowSamplesCount);
+		void destroy();
+
+		// Registers a stat with a given name and returns its index, to be given to the other functions.
+		// If a stat with that name is already registered, returns its index.
+		int addStat(const std::string& name);
+
+		// Adds a sample of a stat, overwriting its oldest sample if the rolling window is full
+		void addSample(int statIndex, double value);
+
+		// Sets the budget of a stat, which is the maximum value it's allowed to have
+		void setBudget(int statIndex, double budget);
+		// Removes budgets of all stats
+		void clearBudgets();
+
+		// Checks if the latest sample of a stat is over its budget
+		bool isOverBudget(int statIndex) const;
+
+		// Returns the number of samples in the rolling window that are over budget, for a given stat
+		int getOverBudgetSamplesCount(int statIndex) const;
+
+		// Returns the number of registered stats
+		int getStatsCount() const { return int(m_stats.size()); }
+
+	private: /* functions */
+
+		void _render() const override;
+
+		// A stat with its samples in the rolling window
+		struct Stat
+		{
+			std::string name;
+			// Ring buffer of stat's samples, with as many samples as the rolling window
+			std::vector<double> samples;
+			// Number of samples in the ring buffer, which is less than its size until the rolling window fills up
+			int samplesCount = 0;
+			// Index in the ring buffer where the next sample will be written, which is also where the oldest sample is, once it's full
+			int nextSampleIndex = 0;
+			// Stat's budget, or a negative value if stat has no budget
+			double budget = -1.0;
+		};
+
+		// Returns the latest sample of a given stat, which must have at least one sample
+		static double getLatestSample(const Stat& stat);
+
+		// Checks if a value is over a given stat's budget
+		static bool isOverBudget(const Stat& stat, double value);
+
+	private: /* variables */
+
+		std::vector<Stat> m_stats;
+
+		// Number of samples that each stat keeps
+		int m_windowSamplesCount = 0;
+	};
+
+	typedef std::shared_ptr<StatsDisplayWidget> StatsDisplayWidget_Ptr;
+	typedef std::shared_ptr<const StatsDisplayWidget> StatsDisplayWidget_ConstPtr;
+
+} // namespace GUI
+} // namespace Pekan
@@ -0,0 +1,499 @@
+#include "CookedTexture.h"
+
+#include "PekanLogger.h"
+#include "Image.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace Pekan
+{
+namespace Graphics
+{
+
+	// Magic bytes at the start of each cooked texture file
+	static constexpr char COOKED_TEXTURE_MAGIC[4] = { 'P', 'K', 'T', 'X' };
+	// Version of the cooked texture file layout. Files of other versions are not loaded.
+	static constexpr unsigned COOKED_TEXTURE_VERSION = 1;
+
+	// Size of cooked texture file's header, in bytes
+	static constexpr size_t HEADER_SIZE = 6 * 4;
+	// Size of an entry of a mip level in cooked texture file's table of mip levels, in bytes
+	static constexpr size_t MIP_LEVEL_ENTRY_SIZE = 2 * 8 + 2 * 4;
+	// Alignment of the data of each mip level inside of cooked texture file, in bytes
+	static constexpr size_t MIP_LEVEL_DATA_ALIGNMENT = 16;
+
+	// Maximum number of mip levels, enough for a texture of any supported size
+	static constexpr unsigned MAX_MIP_LEVELS_COUNT = 32;
+	// Maximum width and height of a cooked texture, larger than what any GPU supports,
+	// so that sizes of mip levels can be calculated without overflowing
+	static constexpr unsigned MAX_DIMENSION = 1 << 16;
+
+	static void writeUnsigned32(std::vector<unsigned char>& bytes, unsigned value)
+	{
+		for (int i = 0; i < 4; i++)
+		{
+			bytes.push_back((unsigned char)((value >> (8 * i)) & 0xFF));
+		}
+	}
+
+	static void writeUnsigned64(std::vector<unsigned char>& bytes, unsigned long long value)
+	{
+		for (int i = 0; i < 8; i++)
+		{
+			bytes.push_back((unsigned char)((value >> (8 * i)) & 0xFF));
+		}
+	}
+
+	static unsigned readUnsigned32(const unsigned char* bytes)
+	{
+		return unsigned(bytes[0]) | (unsigned(bytes[1]) << 8) | (unsigned(bytes[2]) << 16) | (unsigned(bytes[3]) << 24);
+	}
+
+	static unsigned long long readUnsigned64(const unsigned char* bytes)
+	{
+		return (unsigned long long)(readUnsigned32(bytes)) | ((unsigned long long)(readUnsigned32(bytes + 4)) << 32);
+	}
+
+	static size_t alignUp(size_t value, size_t alignment)
+	{
+		return (value + alignment - 1) / alignment * alignment;
+	}
+
+	// Returns the size, in bytes, of the data of a mip level with given format and dimensions
+	static unsigned long long getMipLevelSize(CookedTextureFormat format, unsigned width, unsigned height)
+	{
+		switch (format)
+		{
+			case CookedTextureFormat::R8:       return 1ull * width * height;
+			case CookedTextureFormat::RG8:      return 2ull * width * height;
+			case CookedTextureFormat::RGB8:     return 3ull * width * height;
+			case CookedTextureFormat::RGBA8:    return 4ull * width * height;
+			case CookedTextureFormat::BC1:      return 8ull * ((width + 3) / 4) * ((height + 3) / 4);
+			case CookedTextureFormat::BC3:      return 16ull * ((width + 3) / 4) * ((height + 3) / 4);
+		}
+		PK_ASSERT(false, "Unknown CookedTextureFormat, cannot determine size of a mip level.", "Pekan");
+		return 0;
+	}
+
+	// Generates the next, twice smaller, mip level from a given one, averaging each 2x2 texels into 1
+	static void generateNextMipLevel
+	(
+		const std::vector<unsigned char>& texels, int width, int height, int numChannels,
+		std::vector<unsigned char>& nextTexels, int& nextWidth, int& nextHeight
+	)
+	{
+		nextWidth = std::max(width / 2, 1);
+		nextHeight = std::max(height / 2, 1);
+		nextTexels.resize(size_t(nextWidth) * size_t(nextHeight) * size_t(numChannels));
+
+		for (int y = 0; y < nextHeight; y++)
+		{
+			// Clamp to last row, for textures that are 1 texel high
+			const int y0 = std::min(2 * y, height - 1);
+			const int y1 = std::min(2 * y + 1, height - 1);
+			for (int x = 0; x < nextWidth; x++)
+			{
+				// Clamp to last column, for textures that are 1 texel wide
+				const int x0 = std::min(2 * x, width - 1);
+				const int x1 = std::min(2 * x + 1, width - 1);
+				for (int c = 0; c < numChannels; c++)
+				{
+					const unsigned sum =
+						texels[(size_t(y0) * width + x0) * numChannels + c] + texels[(size_t(y0) * width + x1) * numChannels + c] +
+						texels[(size_t(y1) * width + x0) * numChannels + c] + texels[(size_t(y1) * width + x1) * numChannels + c];
+					nextTexels[(size_t(y) * nextWidth + x) * numChannels + c] = (unsigned char)((sum + 2) / 4);
+				}
+			}
+		}
+	}
+
+	// Packs a color into 16 bits, with 5 bits of red, 6 bits of green and 5 bits of blue
+	static unsigned short packRgb565(const int color[3])
+	{
+		const int r = (color[0] * 31 + 127) / 255;
+		const int g = (color[1] * 63 + 127) / 255;
+		const int b = (color[2] * 31 + 127) / 255;
+		return (unsigned short)((r << 11) | (g << 5) | b);
+	}
+
+	// Unpacks a color packed with packRgb565(), the same way the GPU does
+	static void unpackRgb565(unsigned short packed, int color[3])
+	{
+		const int r = (packed >> 11) & 0x1F;
+		const int g = (packed >> 5) & 0x3F;
+		const int b = packed & 0x1F;
+		color[0] = (r << 3) | (r >> 2);
+		color[1] = (g << 2) | (g >> 4);
+		color[2] = (b << 3) | (b >> 2);
+	}
+
+	// Compresses the colors of a block of 4x4 RGBA texels into 8 bytes of BC1,
+	// using the corners of the colors' bounding box, inset a bit, as endpoints
+	static void compressColorBlock(const unsigned char block[16 * 4], unsigned char* output)
+	{
+		int minColor[3] = { 255, 255, 255 };
+		int maxColor[3] = { 0, 0, 0 };
+		for (int i = 0; i < 16; i++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				minColor[c] = std::min(minColor[c], int(block[i * 4 + c]));
+				maxColor[c] = std::max(maxColor[c], int(block[i * 4 + c]));
+			}
+		}
+		// Inset bounding box, because its corners are rarely hit exactly, so this lowers the average error
+		for (int c = 0; c < 3; c++)
+		{
+			const int inset = (maxColor[c] - minColor[c]) / 16;
+			minColor[c] += inset;
+			maxColor[c] -= inset;
+		}
+
+		unsigned short color0 = packRgb565(maxColor);
+		unsigned short color1 = packRgb565(minColor);
+		// First endpoint must be greater, so that the block is decoded with 4 colors and no transparency
+		if (color0 < color1)
+		{
+			std::swap(color0, color1);
+		}
+
+		unsigned indices = 0;
+		if (color0 != color1)
+		{
+			int palette[4][3];
+			unpackRgb565(color0, palette[0]);
+			unpackRgb565(color1, palette[1]);
+			for (int c = 0; c < 3; c++)
+			{
+				palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+			}
+
+			for (int i = 0; i < 16; i++)
+			{
+				int bestIndex = 0;
+				int bestDistance = INT_MAX;
+				for (int p = 0; p < 4; p++)
+				{
+					int distance = 0;
+					for (int c = 0; c < 3; c++)
+					{
+						const int difference = int(block[i * 4 + c]) - palette[p][c];
+						distance += difference * difference;
+					}
+					if (distance < bestDistance)
+					{
+						bestDistance = distance;
+						bestIndex = p;
+					}
+				}
+				indices |= unsigned(bestIndex) << (2 * i);
+			}
+		}
+
+		output[0] = (unsigned char)(color0 & 0xFF);
+		output[1] = (unsigned char)(color0 >> 8);
+		output[2] = (unsigned char)(color1 & 0xFF);
+		output[3] = (unsigned char)(color1 >> 8);
+		for (int i = 0; i < 4; i++)
+		{
+			output[4 + i] = (unsigned char)((indices >> (8 * i)) & 0xFF);
+		}
+	}
+
+	// Compresses the alphas of a block of 4x4 RGBA texels into the 8 bytes of alpha of BC3,
+	// using the minimum and the maximum alpha as endpoints
+	static void compressAlphaBlock(const unsigned char block[16 * 4], unsigned char* output)
+	{
+		int minAlpha = 255;
+		int maxAlpha = 0;
+		for (int i = 0; i < 16; i++)
+		{
+			minAlpha = std::min(minAlpha, int(block[i * 4 + 3]));
+			maxAlpha = std::max(maxAlpha, int(block[i * 4 + 3]));
+		}
+
+		unsigned long long indices = 0;
+		if (maxAlpha != minAlpha)
+		{
+			// First endpoint is greater, so that the block is decoded with 8 alphas
+			int palette[8] = { maxAlpha, minAlpha };
+			for (int p = 1; p < 7; p++)
+			{
+				palette[p + 1] = ((7 - p) * maxAlpha + p * minAlpha) / 7;
+			}
+
+			for (int i = 0; i < 16; i++)
+			{
+				int bestIndex = 0;
+				int bestDistance = INT_MAX;
+				for (int p = 0; p < 8; p++)
+				{
+					const int distance = std::abs(int(block[i * 4 + 3]) - palette[p]);
+					if (distance < bestDistance)
+					{
+						bestDistance = distance;
+						bestIndex = p;
+					}
+				}
+				indices |= (unsigned long long)(bestIndex) << (3 * i);
+			}
+		}
+
+		output[0] = (unsigned char)(maxAlpha);
+		output[1] = (unsigned char)(minAlpha);
+		for (int i = 0; i < 6; i++)
+		{
+			output[2 + i] = (unsigned char)((indices >> (8 * i)) & 0xFF);
+		}
+	}
+
+	// Compresses a mip level into BC1, or into BC3 if it has alpha
+	static void compressMipLevel
+	(
+		const std::vector<unsigned char>& texels, int width, int height, int numChannels,
+		std::vector<unsigned char>& compressed
+	)
+	{
+		PK_ASSERT_QUICK(numChannels == 3 || numChannels == 4);
+
+		const bool hasAlpha = (numChannels == 4);
+		const size_t blockSize = hasAlpha ? 16 : 8;
+		const int blocksCountX = (width + 3) / 4;
+		const int blocksCountY = (height + 3) / 4;
+		compressed.resize(size_t(blocksCountX) * size_t(blocksCountY) * blockSize);
+
+		unsigned char block[16 * 4];
+		unsigned char* output = compressed.data();
+		for (int blockY = 0; blockY < blocksCountY; blockY++)
+		{
+			for (int blockX = 0; blockX < blocksCountX; blockX++)
+			{
+				// Gather block's texels as RGBA, repeating the last row and column for blocks crossing the edge
+				for (int i = 0; i < 16; i++)
+				{
+					const int x = std::min(blockX * 4 + i % 4, width - 1);
+					const int y = std::min(blockY * 4 + i / 4, height - 1);
+					const unsigned char* texel = &texels[(size_t(y) * width + x) * numChannels];
+					block[i * 4 + 0] = texel[0];
+					block[i * 4 + 1] = texel[1];
+					block[i * 4 + 2] = texel[2];
+					block[i * 4 + 3] = hasAlpha ? texel[3] : 255;
+				}
+
+				if (hasAlpha)
+				{
+					compressAlphaBlock(block, output);
+					output += 8;
+				}
+				compressColorBlock(block, output);
+				output += 8;
+			}
+		}
+	}
+
+	bool CookedTexture::cook(const Image& image, const char* filepath, bool isCompressed)
+	{
+		if (!image.isValid())
+		{
+			PK_LOG_ERROR("Trying to cook an invalid image into a cooked texture file: " << filepath, "Pekan");
+			return false;
+		}
+
+		const int numChannels = image.getNumChannels();
+		if (numChannels < 1 || numChannels > 4)
+		{
+			PK_LOG_ERROR("Trying to cook an image with an unsupported number of channels into a cooked texture file: " << filepath, "Pekan");
+			return false;
+		}
+		// Only images with colors can be block-compressed
+		isCompressed = isCompressed && numChannels >= 3;
+
+		CookedTextureFormat format = CookedTextureFormat(numChannels - 1);
+		if (isCompressed)
+		{
+			format = (numChannels == 4) ? CookedTextureFormat::BC3 : CookedTextureFormat::BC1;
+		}
+
+		// Generate the whole mip chain, down to 1x1
+		std::vector<std::vector<unsigned char>> mipLevelsTexels(1);
+		std::vector<int> mipLevelsWidths(1, image.getWidth());
+		std::vector<int> mipLevelsHeights(1, image.getHeight());
+		mipLevelsTexels[0].assign(image.getData(), image.getData() + size_t(image.getWidth()) * size_t(image.getHeight()) * size_t(numChannels));
+		while (mipLevelsWidths.back() > 1 || mipLevelsHeights.back() > 1)
+		{
+			std::vector<unsigned char> nextTexels;
+			int nextWidth = 0, nextHeight = 0;
+			generateNextMipLevel(mipLevelsTexels.back(), mipLevelsWidths.back(), mipLevelsHeights.back(), numChannels, nextTexels, nextWidth, nextHeight);
+			mipLevelsTexels.push_back(std::move(nextTexels));
+			mipLevelsWidths.push_back(nextWidth);
+			mipLevelsHeights.push_back(nextHeight);
+		}
+		const unsigned mipLevelsCount = unsigned(mipLevelsTexels.size());
+
+		if (isCompressed)
+		{
+			for (unsigned level = 0; level < mipLevelsCount; level++)
+			{
+				std::vector<unsigned char> compressed;
+				compressMipLevel(mipLevelsTexels[level], mipLevelsWidths[level], mipLevelsHeights[level], numChannels, compressed);
+				mipLevelsTexels[level] = std::move(compressed);
+			}
+		}
+
+		// Write header and table of mip levels
+		std::vector<unsigned char> bytes;
+		bytes.insert(bytes.end(), COOKED_TEXTURE_MAGIC, COOKED_TEXTURE_MAGIC + 4);
+		writeUnsigned32(bytes, COOKED_TEXTURE_VERSION);
+		writeUnsigned32(bytes, unsigned(image.getWidth()));
+		writeUnsigned32(bytes, unsigned(image.getHeight()));
+		writeUnsigned32(bytes, unsigned(format));
+		writeUnsigned32(bytes, mipLevelsCount);
+		size_t offset = alignUp(HEADER_SIZE + mipLevelsCount * MIP_LEVEL_ENTRY_SIZE, MIP_LEVEL_DATA_ALIGNMENT);
+		for (unsigned level = 0; level < mipLevelsCount; level++)
+		{
+			writeUnsigned64(bytes, offset);
+			writeUnsigned64(bytes, mipLevelsTexels[level].size());
+			writeUnsigned32(bytes, unsigned(mipLevelsWidths[level]));
+			writeUnsigned32(bytes, unsigned(mipLevelsHeights[level]));
+			offset = alignUp(offset + mipLevelsTexels[level].size(), MIP_LEVEL_DATA_ALIGNMENT);
+		}
+
+		// Write data of each mip level
+		for (unsigned level = 0; level < mipLevelsCount; level++)
+		{
+			bytes.resize(alignUp(bytes.size(), MIP_LEVEL_DATA_ALIGNMENT), 0);
+			bytes.insert(bytes.end(), mipLevelsTexels[level].begin(), mipLevelsTexels[level].end());
+		}
+
+		std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			PK_LOG_ERROR("Failed to open cooked texture file for writing: " << filepath, "Pekan");
+			return false;
+		}
+		file.write(reinterpret_cast<const char*>(bytes.data()), std::streamsize(bytes.size()));
+		if (!file.good())
+		{
+			PK_LOG_ERROR("Failed to write cooked texture file: " << filepath, "Pekan");
+			return false;
+		}
+
+		return true;
+	}
+
+	bool CookedTexture::load(const char* filepath)
+	{
+		unload();
+
+		if (!m_file.open(filepath))
+		{
+			return false;
+		}
+		const unsigned char* data = m_file.getData();
+		const size_t size = m_file.getSize();
+
+		// Validate header
+		if (size < HEADER_SIZE || std::memcmp(data, COOKED_TEXTURE_MAGIC, 4) != 0 || readUnsigned32(data + 4) != COOKED_TEXTURE_VERSION)
+		{
+			PK_LOG_ERROR("Trying to load a file that is not a cooked texture, or is of another version: " << filepath, "Pekan");
+			unload();
+			return false;
+		}
+		const unsigned width = readUnsigned32(data + 8);
+		const unsigned height = readUnsigned32(data + 12);
+		const unsigned format = readUnsigned32(data + 16);
+		const unsigned mipLevelsCount = readUnsigned32(data + 20);
+		if (width == 0 || height == 0 || width > MAX_DIMENSION || height > MAX_DIMENSION
+			|| format > unsigned(CookedTextureFormat::BC3) || mipLevelsCount == 0 || mipLevelsCount > MAX_MIP_LEVELS_COUNT
+			|| size < HEADER_SIZE + mipLevelsCount * MIP_LEVEL_ENTRY_SIZE)
+		{
+			PK_LOG_ERROR("Trying to load a corrupted cooked texture file: " << filepath, "Pekan");
+			unload();
+			return false;
+		}
+		m_format = CookedTextureFormat(format);
+
+		// Read table of mip levels, pointing each mip level into the mapping.
+		// Each mip level must be half as big as the previous one, starting from texture's size,
+		// and must have exactly as much data as its format and its dimensions need,
+		// otherwise the file is rejected, so that loadOrCook() cooks it again instead of uploading garbage to the GPU.
+		m_mipLevels.resize(mipLevelsCount);
+		unsigned expectedWidth = width;
+		unsigned expectedHeight = height;
+		for (unsigned level = 0; level < mipLevelsCount; level++)
+		{
+			const unsigned char* entry = data + HEADER_SIZE + level * MIP_LEVEL_ENTRY_SIZE;
+			const unsigned long long offset = readUnsigned64(entry);
+			const unsigned long long levelSize = readUnsigned64(entry + 8);
+			const unsigned levelWidth = readUnsigned32(entry + 16);
+			const unsigned levelHeight = readUnsigned32(entry + 20);
+			if (offset > size || levelSize > size - offset
+				|| levelWidth != expectedWidth || levelHeight != expectedHeight
+				|| levelSize != getMipLevelSize(m_format, levelWidth, levelHeight))
+			{
+				PK_LOG_ERROR("Trying to load a corrupted cooked texture file: " << filepath, "Pekan");
+				unload();
+				return false;
+			}
+			m_mipLevels[level].data = data + offset;
+			m_mipLevels[level].size = size_t(levelSize);
+			m_mipLevels[level].width = int(levelWidth);
+			m_mipLevels[level].height = int(levelHeight);
+
+			expectedWidth = std::max(expectedWidth / 2, 1u);
+			expectedHeight = std::max(expectedHeight / 2, 1u);
+		}
+
+		return true;
+	}
+
+	bool CookedTexture::loadOrCook(const char* imageFilepath, const char* cookedFilepath, bool isCompressed)
+	{
+		// Check if cooked texture file is up to date with the image file
+		std::error_code error;
+		bool isUpToDate = std::filesystem::exists(cookedFilepath, error);
+		if (isUpToDate)
+		{
+			const std::filesystem::file_time_type imageTime = std::filesystem::last_write_time(imageFilepath, error);
+			isUpToDate = error || std::filesystem::last_write_time(cookedFilepath, error) >= imageTime;
+		}
+
+		if (isUpToDate && load(cookedFilepath))
+		{
+			// Images without colors are never compressed, so their compression always matches
+			const bool hasColors = (m_format != CookedTextureFormat::R8 && m_format != CookedTextureFormat::RG8);
+			if (!hasColors || isCompressedFormat(m_format) == isCompressed)
+			{
+				return true;
+			}
+			unload();
+		}
+
+		PK_LOG_INFO("Cooking texture \"" << imageFilepath << "\" into \"" << cookedFilepath << "\".", "Pekan");
+		const Image image(imageFilepath);
+		if (!cook(image, cookedFilepath, isCompressed))
+		{
+			return false;
+		}
+		return load(cookedFilepath);
+	}
+
+	void CookedTexture::unload()
+	{
+		m_mipLevels.clear();
+		m_file.close();
+	}
+
+	bool CookedTexture::isCompressedFormat(CookedTextureFormat format)
+	{
+		return format == CookedTextureFormat::BC1 || format == CookedTextureFormat::BC3;
+	}
+
+} // namespace Graphics
+} // namespace Pekan
\ No newline at end of file
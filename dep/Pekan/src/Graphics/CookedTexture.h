@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Utils/MappedFile.h"
+
+#include <vector>
+
+namespace Pekan
+{
+namespace Graphics
+{
+
+	class Image;
+
+	// Enum for different formats of texels in a cooked texture
+	enum class CookedTextureFormat
+	{
+		// Uncompressed, 8 bits per channel, tightly packed rows
+		R8 = 0,
+		RG8 = 1,
+		RGB8 = 2,
+		RGBA8 = 3,
+		// Block-compressed, each block of 4x4 texels taking 8 bytes. Opaque.
+		BC1 = 4,
+		// Block-compressed, each block of 4x4 texels taking 16 bytes, with alpha
+		BC3 = 5
+	};
+
+	// A texture that is "cooked" ahead of time into a file, holding its whole mip chain
+	// in the exact layout that the GPU expects, optionally block-compressed.
+	//
+	// Loading a cooked texture maps its file into memory, without decoding anything,
+	// and Texture2D uploads each mip level straight from the mapping,
+	// so there is no image decoding and no mipmap generation at load time.
+	//
+	// Cooked texture file (.pktex) layout, all numbers are little-endian:
+	// - header: magic "PKTX", version, width, height, format, number of mip levels (6 x 32 bits)
+	// - for each mip level: offset and size of its data, in bytes (2 x 64 bits), width and height (2 x 32 bits)
+	// - data of each mip level, starting at a 16 byte aligned offset
+	//
+	// NOTE: Data of mip levels is valid only while cooked texture is loaded.
+	class CookedTexture
+	{
+	public:
+
+		// A single mip level of a cooked texture
+		struct MipLevel
+		{
+			const unsigned char* data = nullptr;
+			// Size of data, in bytes
+			size_t size = 0;
+			int width = 0;
+			int height = 0;
+		};
+
+		// Cooks a given image into a cooked texture file, generating its whole mip chain.
+		// If isCompressed is true, mip levels are block-compressed, with BC1 for images without alpha and BC3 for images with alpha.
+		// Returns true on success.
+		static bool cook(const Image& image, const char* filepath, bool isCompressed = false);
+
+		// Loads a cooked texture from a given cooked texture file.
+		// Returns true on success.
+		bool load(const char* filepath);
+
+		// Loads a cooked texture from a given cooked texture file,
+		// first cooking it from a given image file if it doesn't exist,
+		// or if it's older than the image file, or if its compression doesn't match.
+		// Returns true on success.
+		bool loadOrCook(const char* imageFilepath, const char* cookedFilepath, bool isCompressed = false);
+
+		// Unloads the cooked texture, unmapping its file
+		void unload();
+
+		inline int getWidth() const { return m_mipLevels.empty() ? 0 : m_mipLevels[0].width; }
+		inline int getHeight() const { return m_mipLevels.empty() ? 0 : m_mipLevels[0].height; }
+		inline CookedTextureFormat getFormat() const { return m_format; }
+
+		inline int getMipLevelsCount() const { return int(m_mipLevels.size()); }
+		inline const MipLevel& getMipLevel(int level) const { return m_mipLevels[level]; }
+
+		// Checks if given format is a block-compressed one
+		static bool isCompressedFormat(CookedTextureFormat format);
+
+		// Checks if cooked texture is valid, meaning that it has been loaded successfully and not yet unloaded
+		inline bool isValid() const { return m_file.isOpen(); }
+
+	private: /* variables */
+
+		// Cooked texture file, mapped into memory
+		MappedFile m_file;
+
+		CookedTextureFormat m_format = CookedTextureFormat::RGBA8;
+
+		// Mip levels, pointing into the mapped file, starting from the largest one
+		std::vector<MipLevel> m_mipLevels;
+	};
+
+} // namespace Graphics
+} // namespace Pekan
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include "GpuQueryRing.h"
+
+#include "GLCall.h"
+
+namespace Pekan
+{
+namespace Graphics
+{
+
+	void GpuQueryRing::create(int queriesPerSlot)
+	{
+		PK_ASSERT(!isValid(), "Trying to create a GpuQueryRing instance that is already created.", "Pekan");
+		PK_ASSERT(queriesPerSlot > 0 && queriesPerSlot <= MAX_QUERIES_PER_SLOT, "Trying to create a GpuQueryRing with an invalid number of queries per slot.", "Pekan");
+
+		m_queriesPerSlot = queriesPerSlot;
+		for (int i = 0; i < SLOTS_COUNT; i++)
+		{
+			GLCall(glGenQueries(m_queriesPerSlot, m_ids[i]));
+			m_isPending[i] = false;
+		}
+		m_currentSlot = 0;
+		m_latestSlot = -1;
+	}
+
+	void GpuQueryRing::destroy()
+	{
+		PK_ASSERT(isValid(), "Trying to destroy a GpuQueryRing instance that is not yet created.", "Pekan");
+
+		for (int i = 0; i < SLOTS_COUNT; i++)
+		{
+			GLCall(glDeleteQueries(m_queriesPerSlot, m_ids[i]));
+			for (int j = 0; j < MAX_QUERIES_PER_SLOT; j++)
+			{
+				m_ids[i][j] = 0;
+			}
+		}
+	}
+
+	bool GpuQueryRing::begin()
+	{
+		PK_ASSERT(isValid(), "Trying to begin a measurement with a GpuQueryRing that is not yet created.", "Pekan");
+
+		// If current slot is still not read, GPU is more than SLOTS_COUNT - 1 frames behind,
+		// so we have no choice but to wait for its results before reusing it.
+		if (m_isPending[m_currentSlot])
+		{
+			readSlot(m_currentSlot);
+			return true;
+		}
+		return false;
+	}
+
+	bool GpuQueryRing::end()
+	{
+		PK_ASSERT(isValid(), "Trying to end a measurement with a GpuQueryRing that is not yet created.", "Pekan");
+
+		m_isPending[m_currentSlot] = true;
+		m_currentSlot = (m_currentSlot + 1) % SLOTS_COUNT;
+
+		// Next slot to be used is the oldest one.
+		// Read it if its results are already available, without waiting for them.
+		// Last query of a slot is issued after the others, so if it's available then all of them are.
+		if (m_isPending[m_currentSlot])
+		{
+			int isAvailable = 0;
+			GLCall(glGetQueryObjectiv(m_ids[m_currentSlot][m_queriesPerSlot - 1], GL_QUERY_RESULT_AVAILABLE, &isAvailable));
+			if (isAvailable)
+			{
+				readSlot(m_currentSlot);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	unsigned GpuQueryRing::getCurrentId(int query) const
+	{
+		PK_ASSERT_QUICK(query >= 0 && query < m_queriesPerSlot);
+		return m_ids[m_currentSlot][query];
+	}
+
+	unsigned long long GpuQueryRing::getLatestResult(int query) const
+	{
+		PK_ASSERT_QUICK(query >= 0 && query < m_queriesPerSlot);
+		PK_ASSERT_QUICK(m_latestSlot >= 0);
+		return m_results[m_latestSlot][query];
+	}
+
+	void GpuQueryRing::readSlot(int slot)
+	{
+		PK_ASSERT_QUICK(slot >= 0 && slot < SLOTS_COUNT);
+
+		for (int i = 0; i < m_queriesPerSlot; i++)
+		{
+			GLuint64 result = 0;
+			GLCall(glGetQueryObjectui64v(m_ids[slot][i], GL_QUERY_RESULT, &result));
+			m_results[slot][i] = (unsigned long long)(result);
+		}
+		m_isPending[slot] = false;
+		m_latestSlot = slot;
+	}
+
+} // namespace Graphics
+} // namespace Pekan
\ No newline at end of file
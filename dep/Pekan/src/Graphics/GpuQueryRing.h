@@ -0,0 +1,79 @@
+#pragma once
+
+namespace Pekan
+{
+namespace Graphics
+{
+
+	// A ring of OpenGL queries, used by classes measuring something on the GPU, like GpuTimer and SamplesCounter.
+	//
+	// GPU executes commands some time after they are issued, so results of queries are read a few frames later
+	// to avoid stalling the CPU while waiting for the GPU.
+	//
+	// Ring consists of slots, one for each measurement, and each slot can hold multiple queries,
+	// for example one timestamp at the beginning and one at the end of the measurement.
+	// Queries of a slot must be issued in order, because the last one is used to check if the whole slot is available.
+	class GpuQueryRing
+	{
+	public:
+
+		// Maximum number of queries in a slot
+		static constexpr int MAX_QUERIES_PER_SLOT = 2;
+
+		// Number of slots in the ring.
+		// A slot is read this many frames minus one after it's issued.
+		static constexpr int SLOTS_COUNT = 4;
+
+		void create(int queriesPerSlot);
+		void destroy();
+
+		// Begins a new measurement in current slot.
+		// If current slot is still not read, waits for its results and reads them before reusing it.
+		// Returns true if results were read, in which case they are available through getLatestResult().
+		bool begin();
+		// Ends current measurement and moves to next slot.
+		// If next slot is still not read, reads it only if its results are already available, without waiting for them.
+		// Returns true if results were read, in which case they are available through getLatestResult().
+		bool end();
+
+		// Returns ID of a given query in current slot, to be issued between begin() and end()
+		unsigned getCurrentId(int query) const;
+		// Returns index of current slot, so that callers can keep their own data for each measurement
+		int getCurrentSlot() const { return m_currentSlot; }
+
+		// Returns the result of a given query in the latest read slot
+		unsigned long long getLatestResult(int query) const;
+		// Returns index of the latest read slot, or -1 if no slot has been read yet
+		int getLatestSlot() const { return m_latestSlot; }
+
+		// Checks if query ring is valid, meaning that it has been successfully created and not yet destroyed
+		bool isValid() const { return m_ids[0][0] != 0; }
+
+	private: /* functions */
+
+		// Reads the results of all queries in a given slot
+		void readSlot(int slot);
+
+	private: /* variables */
+
+		// IDs of queries on the GPU, for each slot
+		unsigned m_ids[SLOTS_COUNT][MAX_QUERIES_PER_SLOT] = {};
+
+		// Number of queries used in each slot
+		int m_queriesPerSlot = 0;
+
+		// Flags indicating which slots have been issued but not yet read
+		bool m_isPending[SLOTS_COUNT] = {};
+
+		// Results of queries in each slot, valid after the slot is read
+		unsigned long long m_results[SLOTS_COUNT][MAX_QUERIES_PER_SLOT] = {};
+
+		// Index of the slot to be used for the next measurement
+		int m_currentSlot = 0;
+
+		// Index of the latest read slot
+		int m_latestSlot = -1;
+	};
+
+} // namespace Graphics
+} // namespace Pekan
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "GpuTimer.h"
+
+#include "GLCall.h"
+
+namespace Pekan
+{
+namespace Graphics
+{
+
+	GpuTimer::~GpuTimer()
+	{
+		PK_ASSERT(!isValid(), "You forgot to destroy() a GpuTimer instance.", "Pekan");
+	}
+
+	// Indices of timestamp queries in each slot of the query ring
+	static constexpr int BEGIN_QUERY = 0;
+	static constexpr int END_QUERY = 1;
+
+	void GpuTimer::create()
+	{
+		PK_ASSERT(!isValid(), "Trying to create a GpuTimer instance that is already created.", "Pekan");
+
+		m_queries.create(2);
+		m_latestTime = -1.0;
+	}
+
+	void GpuTimer::destroy()
+	{
+		PK_ASSERT(isValid(), "Trying to destroy a GpuTimer instance that is not yet created.", "Pekan");
+
+		m_queries.destroy();
+	}
+
+	void GpuTimer::begin()
+	{
+		PK_ASSERT(isValid(), "Trying to begin measuring with a GpuTimer that is not yet created.", "Pekan");
+
+		if (m_queries.begin())
+		{
+			storeLatestResult();
+		}
+
+		GLCall(glQueryCounter(m_queries.getCurrentId(BEGIN_QUERY), GL_TIMESTAMP));
+	}
+
+	void GpuTimer::end()
+	{
+		PK_ASSERT(isValid(), "Trying to end measuring with a GpuTimer that is not yet created.", "Pekan");
+
+		GLCall(glQueryCounter(m_queries.getCurrentId(END_QUERY), GL_TIMESTAMP));
+
+		if (m_queries.end())
+		{
+			storeLatestResult();
+		}
+	}
+
+	void GpuTimer::storeLatestResult()
+	{
+		const unsigned long long beginNanoseconds = m_queries.getLatestResult(BEGIN_QUERY);
+		const unsigned long long endNanoseconds = m_queries.getLatestResult(END_QUERY);
+		m_latestTime = (endNanoseconds > beginNanoseconds) ? double(endNanoseconds - beginNanoseconds) / 1000000.0 : 0.0;
+	}
+
+} // namespace Graphics
+} // namespace Pekan
\ No newline at end of file
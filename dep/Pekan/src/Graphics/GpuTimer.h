@@ -0,0 +1,54 @@
+#pragma once
+
+#include "GpuQueryRing.h"
+
+namespace Pekan
+{
+namespace Graphics
+{
+
+	// A class for measuring how much time the GPU spends executing the commands issued between begin() and end().
+	//
+	// GPU executes commands some time after they are issued, so measurements are read a few frames later,
+	// from a GpuQueryRing of OpenGL timer queries, to avoid stalling the CPU while waiting for the GPU.
+	//
+	// Each measurement records a GPU timestamp at begin() and at end(),
+	// so GPU timers can be nested, and many of them can be measuring at the same time,
+	// for example one for the whole frame and one for each part of the frame.
+	class GpuTimer
+	{
+	public:
+
+		~GpuTimer();
+
+		void create();
+		void destroy();
+
+		// Begins/ends measuring GPU time.
+		// Calls to the same GpuTimer cannot be nested, but calls to different GpuTimers can.
+		void begin();
+		void end();
+
+		// Returns the latest available measured GPU time, in milliseconds,
+		// or a negative value if no measurement is available yet.
+		double getTime() const { return m_latestTime; }
+
+		// Checks if GPU timer is valid, meaning that it has been successfully created and not yet destroyed
+		bool isValid() const { return m_queries.isValid(); }
+
+	private: /* functions */
+
+		// Stores the latest read results of the query ring as the latest measured time
+		void storeLatestResult();
+
+	private: /* variables */
+
+		// Ring of timer queries, recording timestamps at the beginning and at the end of each measurement
+		GpuQueryRing m_queries;
+
+		// Latest available measured GPU time, in milliseconds
+		double m_latestTime = -1.0;
+	};
+
+} // namespace Graphics
+} // namespace Pekan
\ No newline at end of file
@@ -7,8 +7,16 @@
 #include "PekanLogger.h"
 #include "PekanEngine.h"
 #include "PekanApplication.h"
+#include "ShaderPreprocessor.h"
+#include "GpuTimer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 #define VERTEX_SHADER_FILEPATH PEKAN_GRAPHICS_ROOT_DIR "/Shaders/PostProcessor_VertexShader.glsl"
+#define UPSAMPLE_FRAGMENT_SHADER_FILEPATH PEKAN_GRAPHICS_ROOT_DIR "/Shaders/PostProcessor_BilateralUpsample_FragmentShader.glsl"
+#define FXAA_FRAGMENT_SHADER_FILEPATH PEKAN_GRAPHICS_ROOT_DIR "/Shaders/PostProcessor_FXAA_FragmentShader.glsl"
 
 namespace Pekan
 {
@@ -25,6 +33,28 @@ namespace Graphics
 	//     -> g_frameBufferFinal
 	//     -> g_renderObject with a post-processing shader applied
 	//     -> screen
+	//
+	// In reduced-resolution lighting mode it's this instead:
+	//     -> draw call
+	//     -> g_frameBufferMultisample    (only if using multisample rendering)
+	//     -> g_frameBufferFinal
+	//     -> g_renderObject with the lighting shader applied
+	//     -> g_frameBufferLight          (smaller than the window)
+	//     -> g_renderObjectUpsample with the bilateral upsample shader applied, also reading g_frameBufferFinal
+	//     -> screen
+	//
+	// Custom lighting mode is the same, except that g_renderLighting is called
+	// to render into g_frameBufferLight, instead of using g_renderObject.
+	//
+	// If there are passes added with addPass() (or FXAA mode is used, which adds an FXAA pass),
+	// instead of going to the screen the result goes through the pass graph:
+	//     -> g_renderTargets[g_compositeRenderTarget]
+	//     -> g_fusedPassRenderObjects[0]
+	//     -> g_renderTargets[g_fusedPasses[0].renderTarget]
+	//     -> g_fusedPassRenderObjects[1]
+	//     -> ...
+	//     -> g_fusedPassRenderObjects[last]
+	//     -> screen
 	///////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	// An intermediate frame buffer that will be used to render multisample frames.
@@ -34,6 +64,10 @@ namespace Graphics
 	// The final frame buffer that will be passed to the post-processing shader.
 	static FrameBuffer g_frameBufferFinal;
 
+	// A reduced-resolution, floating-point frame buffer where light is accumulated.
+	// Used only in reduced-resolution lighting mode and custom lighting mode.
+	static FrameBuffer g_frameBufferLight;
+
 	// Vertices of a rectangle covering the whole window/viewport
 	static constexpr float RECTANGLE_VERTICES[] =
 	{
@@ -50,14 +84,155 @@ namespace Graphics
 	// used to render rectangle with post-processed frame.
 	static RenderObject g_renderObject;
 
-	// Number of samples per pixel
-	static int g_samplesPerPixel = -1;
+	// Render object used to upsample the light buffer and multiply it with the rendered frame.
+	// Used only in reduced-resolution lighting mode and custom lighting mode.
+	static RenderObject g_renderObjectUpsample;
 
-	bool PostProcessor::init(const char* postProcessingShaderFilepath)
+	// Anti-aliasing mode to be used
+	static AntiAliasingMode g_antiAliasingMode = AntiAliasingMode::MSAA;
+
+	// Number of samples per pixel.
+	// Before init() a value of 0 means that application's number of samples should be used.
+	static int g_samplesPerPixel = 0;
+
+	// Divisor of the resolution at which lighting is rendered.
+	// A value of 1 means that we are NOT in reduced-resolution lighting mode.
+	static int g_lightingResolutionDivisor = 1;
+
+	// Resolution scale changes in steps of this size, so that small changes in GPU time don't cause constant resizing
+	static constexpr float RESOLUTION_SCALE_STEP = 0.05f;
+	// Minimum number of frames between 2 changes of resolution scale.
+	// Gives GPU time measurements the chance to reflect the last change.
+	static constexpr int RESOLUTION_CHANGE_COOLDOWN_FRAMES = 30;
+	// Weight of each new GPU time measurement in the smoothed GPU time
+	static constexpr double GPU_FRAME_TIME_SMOOTHING = 0.1;
+	// Resolution scale is increased only if GPU time at the new scale is predicted to stay below
+	// this fraction of the target frame time, so that it doesn't oscillate around the target
+	static constexpr double RESOLUTION_INCREASE_HEADROOM = 0.85;
+
+	// Timer measuring how much time the GPU spends on each frame
+	static GpuTimer g_gpuTimer;
+
+	// A flag indicating if dynamic resolution scaling is enabled
+	static bool g_isDynamicResolutionEnabled = false;
+	static DynamicResolutionProperties g_dynamicResolutionProperties;
+
+	// Scale of the resolution at which frames are rendered, relative to window's size
+	static float g_resolutionScale = 1.0f;
+
+	// GPU time of a frame, smoothed over multiple frames, in milliseconds.
+	// Negative if there are no measurements yet.
+	static double g_smoothedGpuFrameTime = -1.0;
+
+	// Number of frames since resolution scale was last changed
+	static int g_framesSinceResolutionChange = 0;
+
+	// Returns a given size scaled by a given scale, rounded up so that it always covers the whole size
+	static glm::ivec2 getScaledSize(glm::ivec2 size, float scale)
 	{
-		PK_ASSERT(!g_isInitialized, "Trying to initialize the PostProcessor but it's already initialized.", "Pekan");
+		return
+		{
+			std::max(int(std::ceil(float(size.x) * scale)), 1),
+			std::max(int(std::ceil(float(size.y) * scale)), 1)
+		};
+	}
+
+	// A pass of the pass graph as it's rendered.
+	// Consecutive per-pixel passes with the same scale are fused into a single rendered pass,
+	// so that they cost a single full-screen read/write instead of one for each pass.
+	struct FusedPass
+	{
+		// Range of passes in g_passes that are rendered by this fused pass
+		size_t firstPass = 0;
+		size_t passesCount = 0;
+
+		// Scale of pass's render target, relative to window's size
+		float scale = 1.0f;
+
+		// Index of the render target in g_renderTargets that this pass renders into,
+		// or -1 if it renders to the screen
+		int renderTarget = -1;
+	};
+
+	// Passes added with addPass(), in order of adding
+	static std::vector<PostProcessingPass> g_passes;
+
+	// Fused passes of the pass graph, in order of rendering
+	static std::vector<FusedPass> g_fusedPasses;
+	// Render objects of fused passes, one for each fused pass.
+	// Kept separately from fused passes because render objects cannot be copied.
+	static std::vector<RenderObject> g_fusedPassRenderObjects;
+
+	// Pool of render targets used by the pass graph.
+	// A render target is reused by any pass with the same scale that doesn't read from it,
+	// so a chain of passes ping-pongs between 2 render targets of each scale.
+	static std::vector<FrameBuffer> g_renderTargets;
+	// Scale of each render target in the pool
+	static std::vector<float> g_renderTargetScales;
 
-		// Get number of samples per pixel from application
+	// Index of the render target in g_renderTargets where the post-processed frame is rendered before the pass graph,
+	// or -1 if there are no passes and it's rendered directly to the screen
+	static int g_compositeRenderTarget = -1;
+
+	// Creates a render object with the rectangle covering the whole window and given fragment shader source
+	static void createRectangleRenderObjectFromSource(RenderObject& renderObject, const char* fragmentShaderSource)
+	{
+		renderObject.create
+		(
+			RECTANGLE_VERTICES, 4 * 2 * 2 * sizeof(float),
+			{ { ShaderDataType::Float2, "position" }, { ShaderDataType::Float2, "textureCoordinates"} },
+			BufferDataUsage::StaticDraw,
+			FileUtils::readTextFileToString(VERTEX_SHADER_FILEPATH).c_str(),
+			fragmentShaderSource
+		);
+		renderObject.setIndexData(RECTANGLE_INDICES, 6 * sizeof(unsigned));
+	}
+
+	// Creates a render object with the rectangle covering the whole window and given fragment shader
+	static void createRectangleRenderObject(RenderObject& renderObject, const char* fragmentShaderFilepath)
+	{
+		createRectangleRenderObjectFromSource(renderObject, FileUtils::readTextFileToString(fragmentShaderFilepath).c_str());
+	}
+
+	// Number of full-screen passes rendered in the last endFrame()
+	static int g_lastFramePassesCount = 0;
+
+	// Function used to render lighting into the light buffer.
+	// Used only in custom lighting mode.
+	static std::function<void()> g_renderLighting;
+
+	// Creates the frame buffers where the scene is rendered, with the size of the window scaled by current resolution scale
+	static void createSceneFrameBuffers()
+	{
+		const glm::ivec2 size = getScaledSize(PekanEngine::getWindow().getSize(), g_resolutionScale);
+		if (g_samplesPerPixel > 1)
+		{
+			g_frameBufferMultisample.create(size.x, size.y, g_samplesPerPixel);
+		}
+		g_frameBufferFinal.create(size.x, size.y, 1);
+		// When rendering at a lower resolution, the frame is upscaled to the window when post-processed
+		g_frameBufferFinal.setTextureMinifyFunction(TextureMinifyFunction::Linear);
+		g_frameBufferFinal.setTextureMagnifyFunction(TextureMagnifyFunction::Linear);
+	}
+
+	// Creates the light buffer, with the size of the window scaled by current resolution scale
+	// and reduced by the lighting resolution divisor
+	static void createLightFrameBuffer()
+	{
+		const glm::ivec2 size = getScaledSize(PekanEngine::getWindow().getSize(), g_resolutionScale / float(g_lightingResolutionDivisor));
+		g_frameBufferLight.create(size.x, size.y, 1, true);
+	}
+
+	// Creates underlying frame buffers where frames will be rendered.
+	static void createFrameBuffers()
+	{
+		// Only MSAA renders with more than 1 sample per pixel
+		if (g_antiAliasingMode != AntiAliasingMode::MSAA)
+		{
+			g_samplesPerPixel = 1;
+		}
+		// Get number of samples per pixel from application, unless explicitly set
+		else if (g_samplesPerPixel < 1)
 		{
 			const PekanApplication* application = PekanEngine::getApplication();
 			if (application != nullptr)
@@ -71,37 +246,326 @@ namespace Graphics
 			}
 		}
 
-		// Create underlying frame buffers with the size of the window
+		// With dynamic resolution start from the highest allowed resolution
+		g_resolutionScale = g_isDynamicResolutionEnabled ? g_dynamicResolutionProperties.maxScale : 1.0f;
+		createSceneFrameBuffers();
+	}
+
+	// Returns a render target from the pool with a given scale, that is different from a given render target.
+	// Creates a new render target if there is no such render target in the pool yet.
+	static int acquireRenderTarget(float scale, int excludedRenderTarget)
+	{
+		for (size_t i = 0; i < g_renderTargets.size(); i++)
+		{
+			if (g_renderTargetScales[i] == scale && int(i) != excludedRenderTarget)
+			{
+				return int(i);
+			}
+		}
+
+		g_renderTargetScales.push_back(scale);
+		g_renderTargets.emplace_back();
+		return int(g_renderTargets.size()) - 1;
+	}
+
+	// Generates the source of a fragment shader applying a range of per-pixel passes one after another
+	static std::string generateFusedShaderSource(size_t firstPass, size_t passesCount)
+	{
+		std::string source =
+			"#version 330 core\n"
+			"\n"
+			"in vec2 texCoords;\n"
+			"out vec4 FragColor;\n"
+			"\n"
+			"uniform sampler2D screenTexture;\n";
+
+		// Add each pass's uniforms and function, named after the pass
+		for (size_t i = firstPass; i < firstPass + passesCount; i++)
+		{
+			const PostProcessingPass& pass = g_passes[i];
+			source += "\n" + ShaderPreprocessor::substitute(pass.perPixelSource, { { "NAME", pass.name } }, pass.name) + "\n";
+		}
+
+		// Sample input once, and then apply each pass's function to the result of the previous one
+		source +=
+			"\n"
+			"void main()\n"
+			"{\n"
+			"    vec4 color = texture(screenTexture, texCoords);\n";
+		for (size_t i = firstPass; i < firstPass + passesCount; i++)
+		{
+			source += "    color = " + g_passes[i].name + "(color, texCoords);\n";
+		}
+		source +=
+			"    FragColor = color;\n"
+			"}\n";
+
+		return source;
+	}
+
+	// Creates the pass graph from passes added with addPass(),
+	// fusing per-pixel passes and assigning render targets from the pool
+	static void createPassGraph()
+	{
+		// FXAA is applied to the final result, so it's always the last pass
+		if (g_antiAliasingMode == AntiAliasingMode::FXAA)
+		{
+			PostProcessingPass fxaaPass;
+			fxaaPass.name = "FXAA";
+			fxaaPass.fragmentShaderFilepath = FXAA_FRAGMENT_SHADER_FILEPATH;
+			g_passes.push_back(fxaaPass);
+		}
+
+		if (g_passes.empty())
+		{
+			return;
+		}
+
+		// Fuse consecutive per-pixel passes with the same scale
+		for (size_t i = 0; i < g_passes.size(); i++)
+		{
+			const bool isPerPixel = !g_passes[i].perPixelSource.empty();
+			if (isPerPixel && !g_fusedPasses.empty())
+			{
+				FusedPass& previous = g_fusedPasses.back();
+				const bool isPreviousPerPixel = !g_passes[previous.firstPass].perPixelSource.empty();
+				if (isPreviousPerPixel && previous.scale == g_passes[i].scale)
+				{
+					previous.passesCount++;
+					continue;
+				}
+			}
+
+			FusedPass fusedPass;
+			fusedPass.firstPass = i;
+			fusedPass.passesCount = 1;
+			fusedPass.scale = g_passes[i].scale;
+			g_fusedPasses.push_back(fusedPass);
+		}
+
+		// Assign render targets. Each pass reads the render target of the previous pass,
+		// so it can render into any other render target with its scale.
+		// Post-processed frame goes into a full-resolution render target, and last pass renders to the screen.
+		g_compositeRenderTarget = acquireRenderTarget(1.0f, -1);
+		int inputRenderTarget = g_compositeRenderTarget;
+		for (size_t i = 0; i + 1 < g_fusedPasses.size(); i++)
+		{
+			g_fusedPasses[i].renderTarget = acquireRenderTarget(g_fusedPasses[i].scale, inputRenderTarget);
+			inputRenderTarget = g_fusedPasses[i].renderTarget;
+		}
+		g_fusedPasses.back().renderTarget = -1;
+
+		// Create render targets
 		const glm::ivec2 windowSize = PekanEngine::getWindow().getSize();
+		for (size_t i = 0; i < g_renderTargets.size(); i++)
+		{
+			const glm::ivec2 size = getScaledSize(windowSize, g_renderTargetScales[i]);
+			g_renderTargets[i].create(size.x, size.y, 1);
+			// Passes with different scales sample between texels of each other's render targets
+			g_renderTargets[i].setTextureMinifyFunction(TextureMinifyFunction::Linear);
+			g_renderTargets[i].setTextureMagnifyFunction(TextureMagnifyFunction::Linear);
+		}
+
+		// Create a render object for each fused pass.
+		// Each one expects its input on slot 0.
+		g_fusedPassRenderObjects.resize(g_fusedPasses.size());
+		for (size_t i = 0; i < g_fusedPasses.size(); i++)
+		{
+			const FusedPass& fusedPass = g_fusedPasses[i];
+			const PostProcessingPass& firstPass = g_passes[fusedPass.firstPass];
+			if (firstPass.perPixelSource.empty())
+			{
+				createRectangleRenderObject(g_fusedPassRenderObjects[i], firstPass.fragmentShaderFilepath.c_str());
+			}
+			else
+			{
+				const std::string source = generateFusedShaderSource(fusedPass.firstPass, fusedPass.passesCount);
+				createRectangleRenderObjectFromSource(g_fusedPassRenderObjects[i], source.c_str());
+			}
+			g_fusedPassRenderObjects[i].getShader().setUniform1i("screenTexture", 0);
+		}
+	}
+
+	// Binds a given render target from the pool, or the screen if it's -1,
+	// and sets the viewport to its size
+	static void bindRenderTarget(int renderTarget)
+	{
+		if (renderTarget >= 0)
+		{
+			FrameBuffer& frameBuffer = g_renderTargets[renderTarget];
+			frameBuffer.bind();
+			RenderState::setViewport(0, 0, frameBuffer.getWidth(), frameBuffer.getHeight());
+		}
+		else
+		{
+			// Unbind our frame buffer,
+			// effectively binding the default frame buffer which is the screen.
+			// (It doesn't matter which one we unbind)
+			g_frameBufferFinal.unbind();
+			const glm::ivec2 frameBufferSize = PekanEngine::getWindow().getFrameBufferSize();
+			RenderState::setViewport(0, 0, frameBufferSize.x, frameBufferSize.y);
+		}
+	}
+
+	// Creates the light buffer, and the render object that upsamples it and applies it to the rendered frame
+	static void createLightPass(int lightingResolutionDivisor)
+	{
+		if (lightingResolutionDivisor < 1)
+		{
+			PK_LOG_ERROR("Trying to initialize the PostProcessor with an invalid lighting resolution divisor " << lightingResolutionDivisor << ". Divisor 1 will be used.", "Pekan");
+			lightingResolutionDivisor = 1;
+		}
+		g_lightingResolutionDivisor = lightingResolutionDivisor;
+
+		// Create light buffer with a reduced resolution
+		createLightFrameBuffer();
+
+		// Create render object that will upsample the light buffer and apply it to the rendered frame.
+		// It expects the rendered frame on slot 0 and the light buffer on slot 1.
+		createRectangleRenderObject(g_renderObjectUpsample, UPSAMPLE_FRAGMENT_SHADER_FILEPATH);
+		g_renderObjectUpsample.getShader().setUniform1i("screenTexture", 0);
+		g_renderObjectUpsample.getShader().setUniform1i("lightTexture", 1);
+	}
+
+	// Sets the resolution scale at which frames are rendered, recreating frame buffers with the new size
+	static void setResolutionScale(float resolutionScale)
+	{
+		g_resolutionScale = resolutionScale;
+
 		if (g_samplesPerPixel > 1)
 		{
-			g_frameBufferMultisample.create(windowSize.x, windowSize.y, g_samplesPerPixel);
+			g_frameBufferMultisample.destroy();
+		}
+		g_frameBufferFinal.destroy();
+		createSceneFrameBuffers();
+
+		if (g_frameBufferLight.isValid())
+		{
+			g_frameBufferLight.destroy();
+			createLightFrameBuffer();
+		}
+
+		g_framesSinceResolutionChange = 0;
+	}
+
+	// Updates resolution scale based on measured GPU time, to hold the target frame time
+	static void updateDynamicResolution()
+	{
+		const double gpuFrameTime = g_gpuTimer.getTime();
+		if (gpuFrameTime < 0.0)
+		{
+			return;
+		}
+		g_smoothedGpuFrameTime = (g_smoothedGpuFrameTime < 0.0)
+			? gpuFrameTime
+			: g_smoothedGpuFrameTime + (gpuFrameTime - g_smoothedGpuFrameTime) * GPU_FRAME_TIME_SMOOTHING;
+
+		g_framesSinceResolutionChange++;
+		if (g_framesSinceResolutionChange < RESOLUTION_CHANGE_COOLDOWN_FRAMES)
+		{
+			return;
+		}
+
+		// GPU time is roughly proportional to the number of pixels, which is proportional to the square of the scale,
+		// so find the scale that would hit the target frame time, rounded down to a whole step
+		const DynamicResolutionProperties& properties = g_dynamicResolutionProperties;
+		const double idealScale = double(g_resolutionScale) * std::sqrt(properties.targetFrameTime / std::max(g_smoothedGpuFrameTime, 0.001));
+		float newScale = std::floor(float(idealScale) / RESOLUTION_SCALE_STEP) * RESOLUTION_SCALE_STEP;
+		newScale = std::clamp(newScale, properties.minScale, properties.maxScale);
+
+		if (newScale < g_resolutionScale)
+		{
+			setResolutionScale(newScale);
+		}
+		else if (newScale > g_resolutionScale)
+		{
+			// Increase only by a single step at a time, and only if there is enough headroom
+			const float increasedScale = std::min(g_resolutionScale + RESOLUTION_SCALE_STEP, properties.maxScale);
+			const double scaleRatio = double(increasedScale) / double(g_resolutionScale);
+			const double predictedGpuFrameTime = g_smoothedGpuFrameTime * scaleRatio * scaleRatio;
+			if (predictedGpuFrameTime < properties.targetFrameTime * RESOLUTION_INCREASE_HEADROOM)
+			{
+				setResolutionScale(increasedScale);
+			}
 		}
-		g_frameBufferFinal.create(windowSize.x, windowSize.y, 1);
+	}
+
+	bool PostProcessor::init(const char* postProcessingShaderFilepath)
+	{
+		return init(postProcessingShaderFilepath, 1);
+	}
+
+	bool PostProcessor::init(const char* lightingShaderFilepath, int lightingResolutionDivisor)
+	{
+		PK_ASSERT(!g_isInitialized, "Trying to initialize the PostProcessor but it's already initialized.", "Pekan");
+
+		createFrameBuffers();
 
 		// Create underlying render object with rectangle's vertices,
 		// default vertex shader, and given fragment shader
-		g_renderObject.create
-		(
-			RECTANGLE_VERTICES, 4 * 2 * 2 * sizeof(float),
-			{ { ShaderDataType::Float2, "position" }, { ShaderDataType::Float2, "textureCoordinates"} },
-			BufferDataUsage::StaticDraw,
-			FileUtils::readTextFileToString(VERTEX_SHADER_FILEPATH).c_str(),
-			FileUtils::readTextFileToString(postProcessingShaderFilepath).c_str()
-		);
-		g_renderObject.setIndexData(RECTANGLE_INDICES, 6 * sizeof(unsigned));
+		createRectangleRenderObject(g_renderObject, lightingShaderFilepath);
 		// Set "screenTexture" uniform inside the shader to 0,
 		// because we will always bind the frame buffer's texture on slot 0
 		g_renderObject.getShader().setUniform1i("screenTexture", 0);
 
+		// With a divisor of 1 there is no separate light pass,
+		// given shader is applied directly to the rendered frame
+		if (lightingResolutionDivisor > 1)
+		{
+			createLightPass(lightingResolutionDivisor);
+		}
+		createPassGraph();
+		g_gpuTimer.create();
+
 		g_isInitialized = true;
 		return true;
 	}
 
+	bool PostProcessor::init(const std::function<void()>& renderLighting, int lightingResolutionDivisor)
+	{
+		PK_ASSERT(!g_isInitialized, "Trying to initialize the PostProcessor but it's already initialized.", "Pekan");
+
+		if (!renderLighting)
+		{
+			PK_LOG_ERROR("Trying to initialize the PostProcessor with an empty lighting render function.", "Pekan");
+			return false;
+		}
+		g_renderLighting = renderLighting;
+
+		createFrameBuffers();
+		createLightPass(lightingResolutionDivisor);
+		createPassGraph();
+		g_gpuTimer.create();
+
+		g_isInitialized = true;
+		return true;
+	}
+
+	void PostProcessor::setAntiAliasingMode(AntiAliasingMode mode, int samplesPerPixel)
+	{
+		PK_ASSERT(!g_isInitialized, "Trying to set PostProcessor's anti-aliasing mode but it's already initialized.", "Pekan");
+
+		if (samplesPerPixel < 0)
+		{
+			PK_LOG_ERROR("Trying to set PostProcessor's anti-aliasing mode with an invalid number of samples per pixel " << samplesPerPixel << ". Application's number of samples will be used.", "Pekan");
+			samplesPerPixel = 0;
+		}
+
+		g_antiAliasingMode = mode;
+		g_samplesPerPixel = samplesPerPixel;
+	}
+
+	AntiAliasingMode PostProcessor::getAntiAliasingMode()
+	{
+		return g_antiAliasingMode;
+	}
+
 	void PostProcessor::beginFrame()
 	{
 		PK_ASSERT(g_isInitialized, "Trying to begin frame with the PostProcessor but it's not yet initialized.", "Pekan");
 
+		g_gpuTimer.begin();
+
 		// Bind the correct frame buffer depending on samples per pixel
 		if (g_samplesPerPixel > 1)
 		{
@@ -111,6 +575,8 @@ namespace Graphics
 		{
 			g_frameBufferFinal.bind();
 		}
+		// Render at frame buffer's resolution, which is smaller than the window's if resolution is scaled down
+		RenderState::setViewport(0, 0, g_frameBufferFinal.getWidth(), g_frameBufferFinal.getHeight());
 		// Clear both color and depth from frame buffer
 		RenderCommands::clear(true, true);
 	}
@@ -132,6 +598,10 @@ namespace Graphics
 		// effectively binding the default frame buffer which is the screen.
 		// (It doesn't matter which one we unbind)
 		g_frameBufferFinal.unbind();
+		{
+			const glm::ivec2 frameBufferSize = PekanEngine::getWindow().getFrameBufferSize();
+			RenderState::setViewport(0, 0, frameBufferSize.x, frameBufferSize.y);
+		}
 
 		// If depth testing is enabled, disable it as we don't need it to render the post-processed result onto the rectangle
 		bool originalIsEnabledDepthTest = RenderState::isEnabledDepthTest();
@@ -144,20 +614,177 @@ namespace Graphics
 		// because we want to access it in the post-processing shader.
 		// (Importantly, bind it to slot 0 because shader expects it there)
 		g_frameBufferFinal.bindTexture(0);
-		// Render the rectangle using the post-processing shader and the texture containing the rendered frame
-		g_renderObject.render();
+
+		int passesCount = 0;
+		if (g_frameBufferLight.isValid())
+		{
+			// Render lighting into the light buffer, at its reduced resolution
+			g_frameBufferLight.bind();
+			RenderState::setViewport(0, 0, g_frameBufferLight.getWidth(), g_frameBufferLight.getHeight());
+			if (g_renderLighting)
+			{
+				// Start from no light at all, no matter the background color, custom lighting will accumulate into the light buffer
+				const glm::vec4 backgroundColor = RenderState::getBackgroundColor();
+				RenderState::setBackgroundColor(0.0f, 0.0f, 0.0f, 0.0f);
+				RenderCommands::clear(true, false);
+				RenderState::setBackgroundColor(backgroundColor.r, backgroundColor.g, backgroundColor.b, backgroundColor.a);
+				g_renderLighting();
+			}
+			else
+			{
+				g_renderObject.render();
+			}
+			passesCount++;
+
+			// Go back to the screen at full resolution
+			g_frameBufferLight.unbind();
+			const glm::ivec2 frameBufferSize = PekanEngine::getWindow().getFrameBufferSize();
+			RenderState::setViewport(0, 0, frameBufferSize.x, frameBufferSize.y);
+		}
+
+		// If there is a pass graph, render the post-processed frame into its first render target instead of the screen
+		if (g_compositeRenderTarget >= 0)
+		{
+			bindRenderTarget(g_compositeRenderTarget);
+		}
+
+		if (g_frameBufferLight.isValid())
+		{
+			// Upsample light buffer and multiply it with the rendered frame
+			g_frameBufferLight.bindTexture(1);
+			g_renderObjectUpsample.render();
+		}
+		else
+		{
+			// Render the rectangle using the post-processing shader and the texture containing the rendered frame
+			g_renderObject.render();
+		}
+		passesCount++;
+
+		// Render each pass of the pass graph, reading the render target of the previous pass.
+		// Last pass renders to the screen and restores the viewport.
+		int inputRenderTarget = g_compositeRenderTarget;
+		for (size_t i = 0; i < g_fusedPasses.size(); i++)
+		{
+			bindRenderTarget(g_fusedPasses[i].renderTarget);
+			g_renderTargets[inputRenderTarget].bindTexture(0);
+			g_fusedPassRenderObjects[i].render();
+			inputRenderTarget = g_fusedPasses[i].renderTarget;
+			passesCount++;
+		}
+		g_lastFramePassesCount = passesCount;
 
 		// If depth testing was originally enabled, enable it again
 		if (originalIsEnabledDepthTest)
 		{
 			RenderState::enableDepthTest();
 		}
+
+		g_gpuTimer.end();
+		if (g_isDynamicResolutionEnabled)
+		{
+			updateDynamicResolution();
+		}
+	}
+
+	int PostProcessor::getLastFramePassesCount()
+	{
+		return g_lastFramePassesCount;
 	}
 
 	Shader* PostProcessor::getShader()
 	{
+		PK_ASSERT(!g_renderLighting, "Trying to get PostProcessor's shader, but PostProcessor uses a custom lighting render function and has no shader.", "Pekan");
 		return &g_renderObject.getShader();
 	}
 
+	void PostProcessor::enableDynamicResolution(const DynamicResolutionProperties& properties)
+	{
+		PK_ASSERT(!g_isInitialized, "Trying to enable dynamic resolution in the PostProcessor but it's already initialized.", "Pekan");
+
+		if (properties.minScale <= 0.0f || properties.minScale > properties.maxScale || properties.maxScale > 1.0f)
+		{
+			PK_LOG_ERROR("Trying to enable dynamic resolution in the PostProcessor with invalid scale bounds ["
+				<< properties.minScale << ", " << properties.maxScale << "]. Dynamic resolution will NOT be enabled.", "Pekan");
+			return;
+		}
+		if (properties.targetFrameTime <= 0.0)
+		{
+			PK_LOG_ERROR("Trying to enable dynamic resolution in the PostProcessor with an invalid target frame time "
+				<< properties.targetFrameTime << ". Dynamic resolution will NOT be enabled.", "Pekan");
+			return;
+		}
+
+		g_dynamicResolutionProperties = properties;
+		g_isDynamicResolutionEnabled = true;
+	}
+
+	float PostProcessor::getResolutionScale()
+	{
+		return g_resolutionScale;
+	}
+
+	double PostProcessor::getGpuFrameTime()
+	{
+		return g_gpuTimer.getTime();
+	}
+
+	bool PostProcessor::addPass(const PostProcessingPass& pass)
+	{
+		PK_ASSERT(!g_isInitialized, "Trying to add a pass to the PostProcessor but it's already initialized.", "Pekan");
+
+		if (pass.name.empty())
+		{
+			PK_LOG_ERROR("Trying to add a pass without a name to the PostProcessor.", "Pekan");
+			return false;
+		}
+		for (const PostProcessingPass& existingPass : g_passes)
+		{
+			if (existingPass.name == pass.name)
+			{
+				PK_LOG_ERROR("Trying to add a pass called " << pass.name << " to the PostProcessor, but there is already a pass with that name.", "Pekan");
+				return false;
+			}
+		}
+		if (pass.perPixelSource.empty() == pass.fragmentShaderFilepath.empty())
+		{
+			PK_LOG_ERROR("Trying to add a pass called " << pass.name << " to the PostProcessor, but it must have exactly one of a per-pixel source and a fragment shader filepath.", "Pekan");
+			return false;
+		}
+		if (pass.scale <= 0.0f)
+		{
+			PK_LOG_ERROR("Trying to add a pass called " << pass.name << " to the PostProcessor with an invalid scale " << pass.scale << ".", "Pekan");
+			return false;
+		}
+
+		g_passes.push_back(pass);
+		return true;
+	}
+
+	Shader* PostProcessor::getPassShader(const char* passName)
+	{
+		PK_ASSERT(g_isInitialized, "Trying to get a pass shader from the PostProcessor but it's not yet initialized.", "Pekan");
+
+		for (size_t i = 0; i < g_fusedPasses.size(); i++)
+		{
+			const FusedPass& fusedPass = g_fusedPasses[i];
+			for (size_t j = fusedPass.firstPass; j < fusedPass.firstPass + fusedPass.passesCount; j++)
+			{
+				if (g_passes[j].name == passName)
+				{
+					return &g_fusedPassRenderObjects[i].getShader();
+				}
+			}
+		}
+
+		PK_LOG_ERROR("Trying to get shader of a pass called " << passName << " from the PostProcessor, but there is no such pass.", "Pekan");
+		return nullptr;
+	}
+
+	int PostProcessor::getLightingResolutionDivisor()
+	{
+		return g_lightingResolutionDivisor;
+	}
+
 } // namespace Graphics
 } // namespace Pekan
\ No newline at end of file
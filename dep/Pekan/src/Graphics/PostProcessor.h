@@ -1,5 +1,8 @@
 #pragma once
 
+#include <functional>
+#include <string>
+
 namespace Pekan
 {
 namespace Graphics
@@ -7,6 +10,62 @@ namespace Graphics
 
 	class Shader;
 
+	// Anti-aliasing strategies that the post processor can use
+	enum class AntiAliasingMode
+	{
+		// No anti-aliasing at all
+		None,
+		// Multisample anti-aliasing.
+		// Frame is rendered into a multisample frame buffer and then resolved.
+		// Best quality on geometry edges, but memory and fill rate grow with the number of samples.
+		MSAA,
+		// Fast approximate anti-aliasing.
+		// Frame is rendered with a single sample, and then a single full-screen pass
+		// smooths edges found by differences in luminance. Cost is fixed, independent of the scene.
+		FXAA
+	};
+
+	// A single pass of PostProcessor's pass graph.
+	// Passes are applied in order of adding, after the frame is post-processed,
+	// each one reading the result of the previous one.
+	struct PostProcessingPass
+	{
+		// Name of the pass. Must be unique, and must be a valid GLSL identifier.
+		std::string name;
+
+		// GLSL source of a per-pixel pass - a pass that computes the color of each pixel
+		// only from the color of the same pixel in its input, like a vignette, a tint or a fade.
+		// Must define a function
+		//     vec4 {{NAME}}(vec4 color, vec2 texCoords)
+		// where {{NAME}} is replaced with pass's name, and can declare uniforms before it.
+		//
+		// NOTE: Consecutive per-pixel passes with the same scale are fused into a single shader,
+		//       so pass's uniforms should be prefixed with {{NAME}} to avoid collisions.
+		std::string perPixelSource;
+
+		// Filepath of the fragment shader of a general pass - a pass that can sample its input anywhere, like a blur.
+		// Shader receives pass's input in a sampler2D uniform called "screenTexture"
+		// and texture coordinates in a vec2 called "texCoords".
+		//
+		// NOTE: Exactly one of perPixelSource and fragmentShaderFilepath must be set.
+		std::string fragmentShaderFilepath;
+
+		// Scale of pass's render target relative to window's size, for example 0.5 for a half-resolution blur.
+		// Ignored for the last pass, which always renders to the screen.
+		float scale = 1.0f;
+	};
+
+	// Properties of dynamic resolution scaling
+	struct DynamicResolutionProperties
+	{
+		// GPU time of a frame that resolution scaling tries to hold, in milliseconds
+		double targetFrameTime = 12.0;
+
+		// Bounds of the resolution scale, relative to window's size
+		float minScale = 0.5f;
+		float maxScale = 1.0f;
+	};
+
 	// A static class for post-processing a frame after rendering before showing it on screen.
 	class PostProcessor
 	{
@@ -19,6 +78,76 @@ namespace Graphics
 		//       Inside of it the shader will receive the rendered frame.
 		static bool init(const char* postProcessingShaderFilepath);
 
+		// Initializes the post processor in reduced-resolution lighting mode.
+		// In this mode each frame is post-processed in 2 passes:
+		//     1. The given lighting shader is rendered into a light buffer
+		//        that is smaller than the window by a given divisor, for example 2 (half) or 4 (quarter).
+		//     2. The light buffer is upsampled to window's resolution with an edge-aware (bilateral) filter
+		//        and multiplied with the rendered frame.
+		// This is much cheaper than full-resolution post-processing for smooth lighting, like soft falloffs.
+		//
+		// NOTE: Given shader receives the rendered frame in a sampler2D uniform called "screenTexture",
+		//       and MUST output the amount of light at each pixel, NOT the final color.
+		//       Light buffer is floating-point, so light can go beyond 1.0
+		static bool init(const char* lightingShaderFilepath, int lightingResolutionDivisor);
+
+		// Initializes the post processor in custom lighting mode.
+		// Same as reduced-resolution lighting mode, except that instead of a full-screen lighting shader
+		// the given function is called each frame to render lighting into the light buffer,
+		// for example by drawing each light as a small additive quad covering only the pixels it affects.
+		//
+		// NOTE: Light buffer is bound and cleared to black before calling the given function,
+		//       and the viewport is set to light buffer's size.
+		static bool init(const std::function<void()>& renderLighting, int lightingResolutionDivisor = 1);
+
+		// Sets anti-aliasing mode to be used by the post processor.
+		// Number of samples per pixel is used only with MSAA,
+		// and if it's 0 then application's number of samples is used.
+		//
+		// NOTE: Must be called before init(). If not called, MSAA with application's number of samples is used.
+		//
+		// NOTE: For an even cheaper alternative, Renderer2D's analytic edge anti-aliasing
+		//       (PEKAN_ENABLE_2D_ANALYTIC_EDGE_ANTI_ALIASING) can be combined with AntiAliasingMode::None.
+		//       Round shapes and lines drawn as Renderer2D's SDF shapes (PEKAN_ENABLE_2D_SDF_SHAPES)
+		//       anti-alias their own edges, so they don't need MSAA either.
+		static void setAntiAliasingMode(AntiAliasingMode mode, int samplesPerPixel = 0);
+
+		// Returns anti-aliasing mode used by the post processor
+		static AntiAliasingMode getAntiAliasingMode();
+
+		// Enables dynamic resolution scaling.
+		// GPU time of each frame is measured, and the resolution at which frames are rendered
+		// is scaled down when GPU takes longer than the target frame time, and back up when it has headroom.
+		// Frames are upscaled to the window's resolution when post-processed.
+		//
+		// NOTE: Must be called before init().
+		static void enableDynamicResolution(const DynamicResolutionProperties& properties);
+
+		// Returns current scale of the resolution at which frames are rendered, relative to window's size
+		static float getResolutionScale();
+
+		// Returns the latest measured GPU time of a frame, from beginFrame() to the end of endFrame(), in milliseconds,
+		// or a negative value if there is no measurement yet.
+		//
+		// NOTE: Measurements are read a few frames after they are made, to avoid waiting for the GPU.
+		static double getGpuFrameTime();
+
+		// Returns the number of full-screen passes rendered in the last endFrame(),
+		// counting lighting, compositing of the frame and each fused pass of the pass graph.
+		static int getLastFramePassesCount();
+
+		// Adds a pass to the end of the pass graph.
+		// Render targets of the passes are pooled and reused between passes with the same scale.
+		//
+		// NOTE: Must be called before init().
+		static bool addPass(const PostProcessingPass& pass);
+
+		// Returns (a pointer to) the shader rendering a given pass.
+		// Can be used to set pass's uniforms.
+		//
+		// NOTE: Fused per-pixel passes share a shader.
+		static Shader* getPassShader(const char* passName);
+
 		// A function to be called before rendering a frame
 		// that needs to be post-processed.
 		static void beginFrame();
@@ -28,7 +157,14 @@ namespace Graphics
 
 		// Returns (a pointer to) underlying shader.
 		// Can be used to set uniforms.
+		//
+		// NOTE: In reduced-resolution lighting mode this is the lighting shader.
+		//       In custom lighting mode there is no such shader.
 		static Shader* getShader();
+
+		// Returns the divisor of the resolution at which lighting is rendered,
+		// or 1 if the post processor is NOT in reduced-resolution lighting mode.
+		static int getLightingResolutionDivisor();
 	};
 
 } // namespace Graphics
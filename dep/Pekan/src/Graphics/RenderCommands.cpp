@@ -2,6 +2,7 @@
 #include "PekanLogger.h"
 
 #include "GLCall.h"
+#include "Memory/FrameArena.h"
 
 namespace Pekan
 {
@@ -13,11 +14,50 @@ namespace Graphics
 		GLCall(glDrawArrays(getDrawModeOpenGLEnum(mode), 0, elementsCount));
 	}
 
+	void RenderCommands::drawRange(unsigned firstElement, unsigned elementsCount, DrawMode mode)
+	{
+		GLCall(glDrawArrays(getDrawModeOpenGLEnum(mode), firstElement, elementsCount));
+	}
+
 	void RenderCommands::drawIndexed(unsigned elementsCount, DrawMode mode)
 	{
 		GLCall(glDrawElements(getDrawModeOpenGLEnum(mode), elementsCount, GL_UNSIGNED_INT, 0));
 	}
 
+	void RenderCommands::drawIndexedBaseVertex(unsigned firstIndex, unsigned indicesCount, int baseVertex, DrawMode mode)
+	{
+		const void* offset = reinterpret_cast<const void*>(size_t(firstIndex) * sizeof(unsigned));
+		GLCall(glDrawElementsBaseVertex(getDrawModeOpenGLEnum(mode), indicesCount, GL_UNSIGNED_INT, offset, baseVertex));
+	}
+
+	void RenderCommands::multiDrawIndexedBaseVertex
+	(
+		const unsigned* firstIndices,
+		const int* indicesCounts,
+		const int* baseVertices,
+		unsigned rangesCount,
+		DrawMode mode
+	)
+	{
+		if (rangesCount == 0)
+		{
+			return;
+		}
+		if (rangesCount == 1)
+		{
+			drawIndexedBaseVertex(firstIndices[0], unsigned(indicesCounts[0]), baseVertices[0], mode);
+			return;
+		}
+
+		// OpenGL expects byte offsets into the index buffer, instead of first indices
+		FrameVector<const void*> offsets(rangesCount);
+		for (unsigned i = 0; i < rangesCount; i++)
+		{
+			offsets[i] = reinterpret_cast<const void*>(size_t(firstIndices[i]) * sizeof(unsigned));
+		}
+		GLCall(glMultiDrawElementsBaseVertex(getDrawModeOpenGLEnum(mode), indicesCounts, GL_UNSIGNED_INT, offsets.data(), GLsizei(rangesCount), baseVertices));
+	}
+
 	void RenderCommands::clear(bool doClearColorBuffer, bool doClearDepthBuffer)
 	{
 		if (doClearColorBuffer && doClearDepthBuffer)
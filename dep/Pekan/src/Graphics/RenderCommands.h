@@ -31,10 +31,29 @@ namespace Graphics
 
 		// Draws elements from currently bound vertex buffer in the order that they appear
 		static void draw(unsigned elementsCount, DrawMode mode = DrawMode::Triangles);
+		// Draws a range of elements from currently bound vertex buffer, starting from a given element
+		static void drawRange(unsigned firstElement, unsigned elementsCount, DrawMode mode = DrawMode::Triangles);
 
 		// Draws elements from currently bound vertex buffer.
 		// Uses currently bound index buffer to determine which elements to draw and in what order.
 		static void drawIndexed(unsigned elementsCount, DrawMode mode = DrawMode::Triangles);
+		// Draws elements from currently bound vertex buffer,
+		// using a range of indices from currently bound index buffer, and adding a base vertex to each index.
+		static void drawIndexedBaseVertex(unsigned firstIndex, unsigned indicesCount, int baseVertex, DrawMode mode = DrawMode::Triangles);
+		// Draws elements from currently bound vertex buffer,
+		// using multiple ranges of indices from currently bound index buffer, each one with its own base vertex, in a single command.
+		// @param[in] firstIndices - First index of each range
+		// @param[in] indicesCounts - Number of indices in each range
+		// @param[in] baseVertices - Base vertex added to each index of each range
+		// @param[in] rangesCount - Number of ranges
+		static void multiDrawIndexedBaseVertex
+		(
+			const unsigned* firstIndices,
+			const int* indicesCounts,
+			const int* baseVertices,
+			unsigned rangesCount,
+			DrawMode mode = DrawMode::Triangles
+		);
 
 		// Clears everything rendered on window.
 		// @param[in] doClearColorBuffer - a flag indicating whether color buffer should be cleared
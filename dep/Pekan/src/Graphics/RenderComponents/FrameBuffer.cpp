@@ -12,13 +12,15 @@ namespace Graphics
 		PK_ASSERT(!isValid(), "You forgot to destroy() a FrameBuffer instance.", "Pekan");
 	}
 
-	void FrameBuffer::create(int width, int height, int samplesPerPixel)
+	void FrameBuffer::create(int width, int height, int samplesPerPixel, bool isFloatingPoint)
 	{
 		PK_ASSERT(!isValid(), "Trying to create a FrameBuffer instance that is already created.", "Pekan");
+		PK_ASSERT(!isFloatingPoint || samplesPerPixel == 1, "Trying to create a multisample FrameBuffer with floating-point texels, which is not supported.", "Pekan");
 
 		m_samplesPerPixel = samplesPerPixel;
 		m_width = width;
 		m_height = height;
+		m_isFloatingPoint = isFloatingPoint;
 
 		GLCall(glGenFramebuffers(1, &m_id));
 		bind();
@@ -101,6 +103,22 @@ namespace Graphics
 		}
 	}
 
+	void FrameBuffer::setTextureMinifyFunction(TextureMinifyFunction function)
+	{
+		PK_ASSERT(isValid(), "Trying to set a minify function to a FrameBuffer's texture but FrameBuffer is not yet created.", "Pekan");
+		PK_ASSERT(m_samplesPerPixel == 1, "Trying to set a minify function to a multisample FrameBuffer's texture.", "Pekan");
+
+		m_texture.setMinifyFunction(function);
+	}
+
+	void FrameBuffer::setTextureMagnifyFunction(TextureMagnifyFunction function)
+	{
+		PK_ASSERT(isValid(), "Trying to set a magnify function to a FrameBuffer's texture but FrameBuffer is not yet created.", "Pekan");
+		PK_ASSERT(m_samplesPerPixel == 1, "Trying to set a magnify function to a multisample FrameBuffer's texture.", "Pekan");
+
+		m_texture.setMagnifyFunction(function);
+	}
+
 	void FrameBuffer::resolveMultisampleToSinglesample(FrameBuffer& targetFrameBuffer)
 	{
 		PK_ASSERT(m_samplesPerPixel > 1, "Trying to resolve a multisample FrameBuffer to a single-sample FrameBuffer,"
@@ -131,7 +149,8 @@ namespace Graphics
 		m_texture.create();
 		// Set texture's size to frame buffer's width and height.
 		// Make it have 3 channels - RGB, as we don't need A, we'll have a separate depth buffer.
-		m_texture.setSize(m_width, m_height, 3);
+		// A floating-point frame buffer gets 4 channels, so that A can hold an additional value.
+		m_texture.setSize(m_width, m_height, m_isFloatingPoint ? 4 : 3, m_isFloatingPoint);
 		// Configure minify/magnify functions and wrap mode
 		m_texture.setMinifyFunction(TextureMinifyFunction::Nearest);
 		m_texture.setMagnifyFunction(TextureMagnifyFunction::Nearest);
@@ -16,8 +16,13 @@ namespace Graphics
 
 		~FrameBuffer();
 
-		// Creates the frame buffer object, and binds it
-		void create(int width, int height, int samplesPerPixel = 1);
+		// Creates the frame buffer object, and binds it.
+		// A floating-point frame buffer can hold color values outside of the [0, 1] range,
+		// which is useful for intermediate results like light accumulation.
+		// Unlike a normal frame buffer, it also has an alpha channel that can hold a 4th value.
+		//
+		// NOTE: Only single-sample frame buffers can be floating-point.
+		void create(int width, int height, int samplesPerPixel = 1, bool isFloatingPoint = false);
 		void destroy();
 
 		void bind() const;
@@ -28,10 +33,21 @@ namespace Graphics
 		void bindTexture() const;
 		void bindTexture(unsigned slot) const;
 
+		// Sets minify/magnify functions to be used for sampling the underlying texture.
+		// By default frame buffer's texture is sampled with the Nearest function.
+		//
+		// NOTE: Available only for single-sample frame buffers.
+		void setTextureMinifyFunction(TextureMinifyFunction function);
+		void setTextureMagnifyFunction(TextureMagnifyFunction function);
+
 		// Resolves a multisample frame buffer to a given target single-sample buffer,
 		// effectively copying all pixel data, but changing it from multisample to single-sample.
 		void resolveMultisampleToSinglesample(FrameBuffer& targetFrameBuffer);
 
+		// Returns frame buffer's width and height, in pixels
+		int getWidth() const { return m_width; }
+		int getHeight() const { return m_height; }
+
 		// Checks if frame buffer is valid, meaning that it has been successfully created and not yet destroyed
 		bool isValid() const;
 
@@ -52,6 +68,9 @@ namespace Graphics
 		int m_width = -1;
 		int m_height = -1;
 
+		// A flag indicating if frame buffer's color texture has floating-point texels
+		bool m_isFloatingPoint = false;
+
 		// Underlying 2D texture containing the colors of frame buffer's pixels.
 		// Can be used in fragment shader to sample the frame buffer.
 		//
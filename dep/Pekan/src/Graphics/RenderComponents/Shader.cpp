@@ -99,6 +99,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform1f(location, value));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniform1fv(const char* uniformName, int count, const float* values)
@@ -113,6 +114,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform1fv(location, count, values));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniform1i(const char* uniformName, int value)
@@ -122,6 +124,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform1i(location, value));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniform1iv(const char* uniformName, int count, const int* values)
@@ -136,6 +139,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform1iv(location, count, values));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniform2f(const char* uniformName, glm::vec2 value)
@@ -145,6 +149,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform2f(location, value.x, value.y));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniform2fv(const char* uniformName, int count, const glm::vec2* values)
@@ -159,6 +164,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform2fv(location, count, glm::value_ptr(*values)));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniform2i(const char* uniformName, glm::ivec2 value)
@@ -168,6 +174,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform2i(location, value.x, value.y));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniform2iv(const char* uniformName, int count, const glm::ivec2* values)
@@ -182,6 +189,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform2iv(location, count, glm::value_ptr(*values)));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniform3f(const char* uniformName, glm::vec3 value)
@@ -191,6 +199,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform3f(location, value.x, value.y, value.z));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniform3fv(const char* uniformName, int count, const glm::vec3* values)
@@ -205,6 +214,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform3fv(location, count, glm::value_ptr(*values)));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniform3i(const char* uniformName, glm::ivec3 value)
@@ -214,6 +224,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform3i(location, value.x, value.y, value.z));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniform3iv(const char* uniformName, int count, const glm::ivec3* values)
@@ -228,6 +239,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform3iv(location, count, glm::value_ptr(*values)));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniform4f(const char* uniformName, glm::vec4 value)
@@ -237,6 +249,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform4f(location, value.x, value.y, value.z, value.w));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniform4fv(const char* uniformName, int count, const glm::vec4* values)
@@ -251,6 +264,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform4fv(location, count, glm::value_ptr(*values)));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniform4i(const char* uniformName, glm::ivec4 value)
@@ -260,6 +274,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform4i(location, value.x, value.y, value.z, value.w));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniform4iv(const char* uniformName, int count, const glm::ivec4* values)
@@ -274,6 +289,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniform4iv(location, count, glm::value_ptr(*values)));
+		m_uniformSetsCount++;
 	}
 
 	void Shader::setUniformMatrix4fv(const char* uniformName, const glm::mat4& value)
@@ -283,6 +299,7 @@ namespace Graphics {
 		bind();
 		const int location = getUniformLocation(uniformName);
 		GLCall(glUniformMatrix4fv(location, 1, GL_FALSE, &value[0][0]));
+		m_uniformSetsCount++;
 	}
 
 	unsigned Shader::compileShader(unsigned shaderType, const char* sourceCode) {
@@ -302,21 +319,22 @@ namespace Graphics {
 		return shaderID;
 	}
 
-	int Shader::getUniformLocation(const std::string& uniformName) const {
+	int Shader::getUniformLocation(const char* uniformName) const {
 		PK_ASSERT(isValid(), "Trying to get uniform location from a Shader that is not yet created.", "Pekan");
 
 		// If we have the location of this uniform cached, retrieve it from cache
-		const auto cacheIt = m_uniformLocationCache.find(uniformName);
+		m_uniformLocationCacheKey.assign(uniformName);
+		const auto cacheIt = m_uniformLocationCache.find(m_uniformLocationCacheKey);
 		if (cacheIt != m_uniformLocationCache.end()) {
 			return cacheIt->second;
 		}
 		// Otherwise retrieve it by asking OpenGL for the location
-		GLCall(const int location = glGetUniformLocation(m_id, uniformName.c_str()));
+		GLCall(const int location = glGetUniformLocation(m_id, uniformName));
 		if (location < 0) {
 			PK_LOG_ERROR("Trying to set value for uniform \"" << uniformName << "\" inside a shader, but such uniform doesn't exist.", "Pekan");
 		}
 		// Cache the location so that it can be reused in next calls to this function
-		m_uniformLocationCache[uniformName] = location;
+		m_uniformLocationCache[m_uniformLocationCacheKey] = location;
 		return location;
 	}
 
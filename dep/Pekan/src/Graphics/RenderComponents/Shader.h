@@ -55,6 +55,10 @@ namespace Graphics {
 
 		void setUniformMatrix4fv(const char* uniformName, const glm::mat4& value);
 
+		// Returns the number of times a uniform has been set inside the shader so far.
+		// Difference between two calls gives the number of uniforms set in between, for example while rendering a frame.
+		long long getUniformSetsCount() const { return m_uniformSetsCount; }
+
 		// Checks if shader is valid, meaning that it has been successfully created and not yet destroyed
 		bool isValid() const { return m_id != 0; }
 
@@ -68,7 +72,7 @@ namespace Graphics {
 
 		// Returns the location inside the shader of the uniform with the given name.
 		// If such uniform doesn't exist, returns -1.
-		int getUniformLocation(const std::string& uniformName) const;
+		int getUniformLocation(const char* uniformName) const;
 
 		// Detaches and deletes all shaders currently attached to this shader program
 		void detachAndDeleteShaders();
@@ -84,10 +88,16 @@ namespace Graphics {
 		// and next times when we need it we can just read it from the cache.
 		// It maps uniform names to uniform locations.
 		mutable std::unordered_map<std::string, int> m_uniformLocationCache;
+		// A string used as a key for looking up the cache.
+		// Reused between lookups so that looking up a long uniform name doesn't allocate memory every time.
+		mutable std::string m_uniformLocationCacheKey;
 
 		// Flag indicating if shader program currently has any shaders attached
 		bool m_hasShadersAttached = false;
 
+		// Number of times a uniform has been set inside the shader
+		long long m_uniformSetsCount = 0;
+
 		// Shader's ID on the GPU
 		unsigned m_id = 0;
 	};
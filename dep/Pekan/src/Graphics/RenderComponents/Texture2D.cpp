@@ -8,6 +8,18 @@
 #include <glm/glm.hpp>
 
 static const unsigned DEFAULT_PIXEL_TYPE = GL_UNSIGNED_BYTE;
+static const unsigned FLOATING_POINT_PIXEL_TYPE = GL_FLOAT;
+
+// S3TC formats, from the EXT_texture_compression_s3tc extension
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+// Index of the last mip level of a texture, if it's not limited. This is OpenGL's default.
+static const int UNLIMITED_MAX_MIP_LEVEL = 1000;
 
 namespace Pekan {
 namespace Graphics {
@@ -48,6 +60,14 @@ namespace Graphics {
 		setImage(image);
 	}
 
+	void Texture2D::create(const CookedTexture& cookedTexture)
+	{
+		PK_ASSERT(!isValid(), "Trying to create a Texture2D instance that is already created.", "Pekan");
+
+		create();
+		setImage(cookedTexture);
+	}
+
 	void Texture2D::destroy()
 	{
 		PK_ASSERT(isValid(), "Trying to destroy a Texture2D instance that is not yet created.", "Pekan");
@@ -73,10 +93,54 @@ namespace Graphics {
 		getFormat(image, format, internalFormat);
 		GLCall(glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, image.getWidth(), image.getHeight(), 0, format, DEFAULT_PIXEL_TYPE, image.getData()));
 		// Generate mipmaps
+		setMaxMipLevel(UNLIMITED_MAX_MIP_LEVEL);
 		GLCall(glGenerateMipmap(GL_TEXTURE_2D));
 	}
 
-	void Texture2D::setSize(int width, int height, int numChannels)
+	void Texture2D::setImage(const CookedTexture& cookedTexture)
+	{
+		PK_ASSERT(isValid(), "Trying to set image to a Texture2D that is not yet created.", "Pekan");
+
+		if (!cookedTexture.isValid())
+		{
+			PK_LOG_ERROR("Trying to set an invalid cooked texture to a texture.", "Pekan");
+			return;
+		}
+		const bool isCompressed = CookedTexture::isCompressedFormat(cookedTexture.getFormat());
+		if (isCompressed && !RenderState::isSupportedTextureCompressionS3TC())
+		{
+			PK_LOG_ERROR("Trying to set a block-compressed cooked texture to a texture, but S3TC compression is not supported.", "Pekan");
+			return;
+		}
+
+		bind();
+
+		unsigned format = 0, internalFormat = 0;
+		getFormat(cookedTexture.getFormat(), format, internalFormat);
+
+		// Rows of cooked textures are tightly packed
+		GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+		// Upload each mip level straight from the cooked texture
+		const int mipLevelsCount = cookedTexture.getMipLevelsCount();
+		for (int level = 0; level < mipLevelsCount; level++)
+		{
+			const CookedTexture::MipLevel& mipLevel = cookedTexture.getMipLevel(level);
+			if (isCompressed)
+			{
+				GLCall(glCompressedTexImage2D(GL_TEXTURE_2D, level, internalFormat, mipLevel.width, mipLevel.height, 0, GLsizei(mipLevel.size), mipLevel.data));
+			}
+			else
+			{
+				GLCall(glTexImage2D(GL_TEXTURE_2D, level, internalFormat, mipLevel.width, mipLevel.height, 0, format, DEFAULT_PIXEL_TYPE, mipLevel.data));
+			}
+		}
+		GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+
+		// Sample only mip levels that are there, in case mip chain doesn't go all the way to 1x1
+		setMaxMipLevel(mipLevelsCount - 1);
+	}
+
+	void Texture2D::setSize(int width, int height, int numChannels, bool isFloatingPoint)
 	{
 		PK_ASSERT(isValid(), "Trying to set size of a Texture2D that is not yet created.", "Pekan");
 
@@ -85,8 +149,18 @@ namespace Graphics {
 		// Set texture's image data to null,
 		// but providing given size, effectively allocating memory for that many texels, leaving the data empty
 		unsigned format = 0, internalFormat = 0;
-		getFormat(numChannels, format, internalFormat);
-		GLCall(glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, DEFAULT_PIXEL_TYPE, nullptr));
+		if (isFloatingPoint)
+		{
+			getFormatFloatingPoint(numChannels, format, internalFormat);
+			GLCall(glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, FLOATING_POINT_PIXEL_TYPE, nullptr));
+		}
+		else
+		{
+			getFormat(numChannels, format, internalFormat);
+			GLCall(glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, DEFAULT_PIXEL_TYPE, nullptr));
+		}
+		// Texture has no mipmaps, so it's complete only if it's limited to its first mip level
+		setMaxMipLevel(0);
 	}
 
 	void Texture2D::bind() const
@@ -210,5 +284,38 @@ namespace Graphics {
 		}
 	}
 
+	void Texture2D::getFormat(CookedTextureFormat cookedFormat, unsigned& format, unsigned& internalFormat)
+	{
+		switch (cookedFormat)
+		{
+			case CookedTextureFormat::R8:       getFormat(1, format, internalFormat); break;
+			case CookedTextureFormat::RG8:      getFormat(2, format, internalFormat); break;
+			case CookedTextureFormat::RGB8:     getFormat(3, format, internalFormat); break;
+			case CookedTextureFormat::RGBA8:    getFormat(4, format, internalFormat); break;
+			case CookedTextureFormat::BC1:      format = GL_RGB;     internalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT;     break;
+			case CookedTextureFormat::BC3:      format = GL_RGBA;    internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;    break;
+			default: PK_LOG_ERROR("Trying to get texture format for an unsupported cooked texture format.", "Pekan"); break;
+		}
+	}
+
+	void Texture2D::setMaxMipLevel(int level)
+	{
+		GLCall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level));
+	}
+
+	void Texture2D::getFormatFloatingPoint(int numChannels, unsigned& format, unsigned& internalFormat)
+	{
+		PK_ASSERT_QUICK(numChannels >= 0);
+
+		switch (numChannels)
+		{
+			case 1:    format = GL_RED;     internalFormat = GL_R16F;       break;
+			case 2:    format = GL_RG;      internalFormat = GL_RG16F;      break;
+			case 3:    format = GL_RGB;     internalFormat = GL_RGB16F;     break;
+			case 4:    format = GL_RGBA;    internalFormat = GL_RGBA16F;    break;
+			default: PK_LOG_ERROR("Trying to get floating-point texture format for an unsupported number of channels.", "Pekan"); break;
+		}
+	}
+
 } // namespace Pekan
 } // namespace Graphics
\ No newline at end of file
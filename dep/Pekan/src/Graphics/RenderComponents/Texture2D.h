@@ -1,6 +1,7 @@
 #pragma once
 
 #include "RenderState.h"
+#include "CookedTexture.h"
 
 #include <memory>
 
@@ -21,14 +22,22 @@ namespace Graphics {
 		void create();
 		// Creates a texture from a given image
 		void create(const Image& image);
+		// Creates a texture from a given cooked texture
+		void create(const CookedTexture& cookedTexture);
 		void destroy();
 
-		// Sets a new image to the texture
+		// Sets a new image to the texture, generating its mipmaps
 		void setImage(const Image& image);
+		// Sets a new image to the texture, with all of its mipmaps, from a given cooked texture.
+		// Each mip level is uploaded straight from cooked texture's memory mapped file.
+		void setImage(const CookedTexture& cookedTexture);
 		// Sets texture's size,
 		// allocating memory for that many texels,
 		// but NOT filling them with data.
-		void setSize(int width, int height, int numChannels = 4);
+		// Texture will have no mipmaps, so it can be sampled even with a minify function using mipmaps.
+		// If isFloatingPoint is true, texels will be 16-bit floats instead of 8-bit normalized values,
+		// so they can hold values outside of the [0, 1] range.
+		void setSize(int width, int height, int numChannels = 4, bool isFloatingPoint = false);
 
 		// Binds/unbinds texture to currently active texture slot
 		void bind() const;
@@ -68,6 +77,15 @@ namespace Graphics {
 		// Determines the format (and internal format) that a texture must have to support a given number of channels
 		static void getFormat(int numChannels, unsigned& format, unsigned& internalFormat);
 
+		// Determines the format (and internal format) that a texture must have to support a given cooked texture format
+		static void getFormat(CookedTextureFormat cookedFormat, unsigned& format, unsigned& internalFormat);
+
+		// Sets the index of texture's last mip level, so that only mip levels up to it are sampled
+		void setMaxMipLevel(int level);
+
+		// Determines the format (and internal format) that a floating-point texture must have to support a given number of channels
+		static void getFormatFloatingPoint(int numChannels, unsigned& format, unsigned& internalFormat);
+
 	private: /* variables */
 
 		// Texture's ID on the GPU
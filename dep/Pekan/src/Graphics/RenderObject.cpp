@@ -93,6 +93,27 @@ namespace Graphics
 		}
 	}
 
+	void RenderObject::renderRange(unsigned firstVertex, unsigned verticesCount, DrawMode mode) const
+	{
+		bind();
+		RenderCommands::drawRange(firstVertex, verticesCount, mode);
+	}
+
+	void RenderObject::renderIndexRanges
+	(
+		const unsigned* firstIndices,
+		const int* indicesCounts,
+		const int* baseVertices,
+		unsigned rangesCount,
+		DrawMode mode
+	) const
+	{
+		PK_ASSERT(m_indexBuffer.hasData(), "Trying to render index ranges of a RenderObject that has no index data.", "Pekan");
+
+		bind();
+		RenderCommands::multiDrawIndexedBaseVertex(firstIndices, indicesCounts, baseVertices, rangesCount, mode);
+	}
+
 	void RenderObject::setVertexData(const void* data, long long size)
 	{
 		PK_ASSERT(isValid(), "Trying to set vertex data to a RenderObject that is not yet created.", "Pekan");
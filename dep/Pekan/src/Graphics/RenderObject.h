@@ -47,6 +47,18 @@ namespace Graphics
 
 		// Renders the object
 		void render(DrawMode mode = DrawMode::Triangles) const;
+		// Renders a range of object's vertices, ignoring index data
+		void renderRange(unsigned firstVertex, unsigned verticesCount, DrawMode mode = DrawMode::Triangles) const;
+		// Renders multiple ranges of object's index data with a single draw call,
+		// adding a base vertex to each index of a range, so that index data can be shared between ranges.
+		void renderIndexRanges
+		(
+			const unsigned* firstIndices,
+			const int* indicesCounts,
+			const int* baseVertices,
+			unsigned rangesCount,
+			DrawMode mode = DrawMode::Triangles
+		) const;
 
 		// Sets new vertex data to the render object (old data usage will be used)
 		void setVertexData(const void* data, long long size);
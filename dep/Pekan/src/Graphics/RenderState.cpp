@@ -3,11 +3,20 @@
 
 #include "GLCall.h"
 
+#include <cstring>
+
 // Default number of samples to be used for Multisample Anti-Aliasing (MSAA)
 static constexpr int DEFAULT_NUMBER_OF_SAMPLES = 8;
 
 // A flag indicating if depth testing is currently enabled
 static bool g_isEnabledDepthTest = false;
+// A flag indicating if blending is currently enabled
+static bool g_isEnabledBlending = false;
+// Factors of the function currently used for blending
+static Pekan::Graphics::BlendFactor g_blendSourceFactor = Pekan::Graphics::BlendFactor::One;
+static Pekan::Graphics::BlendFactor g_blendDestinationFactor = Pekan::Graphics::BlendFactor::Zero;
+// Current background color
+static glm::vec4 g_backgroundColor = { 0.0f, 0.0f, 0.0f, 0.0f };
 
 namespace Pekan
 {
@@ -18,16 +27,83 @@ namespace Graphics
 	void RenderState::setBackgroundColor(float r, float g, float b, float a)
 	{
 		GLCall(glClearColor(r, g, b, a));
+		g_backgroundColor = { r, g, b, a };
+	}
+
+	glm::vec4 RenderState::getBackgroundColor()
+	{
+		return g_backgroundColor;
+	}
+
+	void RenderState::setViewport(int x, int y, int width, int height)
+	{
+		GLCall(glViewport(x, y, width, height));
+	}
+
+	glm::ivec4 RenderState::getViewport()
+	{
+		int viewport[4] = {};
+		GLCall(glGetIntegerv(GL_VIEWPORT, viewport));
+		return { viewport[0], viewport[1], viewport[2], viewport[3] };
+	}
+
+	unsigned RenderState::getBoundFrameBufferId()
+	{
+		int id = 0;
+		GLCall(glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &id));
+		return unsigned(id);
+	}
+
+	void RenderState::bindFrameBuffer(unsigned id)
+	{
+		GLCall(glBindFramebuffer(GL_FRAMEBUFFER, id));
+	}
+
+	int RenderState::getBoundFrameBufferSamplesPerPixel()
+	{
+		int samples = 0;
+		GLCall(glGetIntegerv(GL_SAMPLES, &samples));
+		// A frame buffer that is not multisample has 0 samples, but each of its pixels is still a single sample
+		return (samples > 1) ? samples : 1;
 	}
 
 	void RenderState::enableBlending()
 	{
 		GLCall(glEnable(GL_BLEND));
+		g_isEnabledBlending = true;
+	}
+
+	void RenderState::disableBlending()
+	{
+		GLCall(glDisable(GL_BLEND));
+		g_isEnabledBlending = false;
+	}
+
+	bool RenderState::isEnabledBlending()
+	{
+		return g_isEnabledBlending;
 	}
 
 	void RenderState::setBlendFunction(BlendFactor sourceFactor, BlendFactor destinationFactor)
 	{
 		GLCall(glBlendFunc(getBlendFactorOpenGLEnum(sourceFactor), getBlendFactorOpenGLEnum(destinationFactor)));
+		g_blendSourceFactor = sourceFactor;
+		g_blendDestinationFactor = destinationFactor;
+	}
+
+	BlendFactor RenderState::getBlendSourceFactor()
+	{
+		return g_blendSourceFactor;
+	}
+
+	BlendFactor RenderState::getBlendDestinationFactor()
+	{
+		return g_blendDestinationFactor;
+	}
+
+	void RenderState::setBlendEquation(BlendEquation equation)
+	{
+		GLCall(glBlendEquation(getBlendEquationOpenGLEnum(equation)));
 	}
 
 	void RenderState::enableDepthTest()
@@ -47,6 +123,21 @@ namespace Graphics
 		return g_isEnabledDepthTest;
 	}
 
+	void RenderState::enableDepthWriting()
+	{
+		GLCall(glDepthMask(GL_TRUE));
+	}
+
+	void RenderState::disableDepthWriting()
+	{
+		GLCall(glDepthMask(GL_FALSE));
+	}
+
+	void RenderState::setDepthFunction(DepthFunction function)
+	{
+		GLCall(glDepthFunc(getDepthFunctionOpenGLEnum(function)));
+	}
+
 	void RenderState::enableMultisampleAntiAliasing()
 	{
 		GLCall(glEnable(GL_MULTISAMPLE));
@@ -81,6 +172,9 @@ namespace Graphics
 			case ShaderDataType::Int3:      return GL_INT;
 			case ShaderDataType::Int4:      return GL_INT;
 			case ShaderDataType::Bool:      return GL_BOOL;
+			case ShaderDataType::UnsignedByte4:     return GL_UNSIGNED_BYTE;
+			case ShaderDataType::UnsignedShort2:    return GL_UNSIGNED_SHORT;
+			case ShaderDataType::HalfFloat4:        return GL_HALF_FLOAT;
 		}
 		PK_ASSERT(false, "Unknown ShaderDataType, cannot determine OpenGL base type.", "Pekan");
 		return 0;
@@ -109,6 +203,37 @@ namespace Graphics
 		return 0;
 	}
 
+	unsigned RenderState::getBlendEquationOpenGLEnum(BlendEquation blendEquation)
+	{
+		switch (blendEquation)
+		{
+			case BlendEquation::Add:                return GL_FUNC_ADD;
+			case BlendEquation::Subtract:           return GL_FUNC_SUBTRACT;
+			case BlendEquation::ReverseSubtract:    return GL_FUNC_REVERSE_SUBTRACT;
+			case BlendEquation::Min:                return GL_MIN;
+			case BlendEquation::Max:                return GL_MAX;
+		}
+		PK_ASSERT(false, "Unknown BlendEquation, cannot determine OpenGL enum.", "Pekan");
+		return 0;
+	}
+
+	unsigned RenderState::getDepthFunctionOpenGLEnum(DepthFunction depthFunction)
+	{
+		switch (depthFunction)
+		{
+			case DepthFunction::Never:             return GL_NEVER;
+			case DepthFunction::Less:              return GL_LESS;
+			case DepthFunction::Equal:             return GL_EQUAL;
+			case DepthFunction::LessOrEqual:       return GL_LEQUAL;
+			case DepthFunction::Greater:           return GL_GREATER;
+			case DepthFunction::NotEqual:          return GL_NOTEQUAL;
+			case DepthFunction::GreaterOrEqual:    return GL_GEQUAL;
+			case DepthFunction::Always:            return GL_ALWAYS;
+		}
+		PK_ASSERT(false, "Unknown DepthFunction, cannot determine OpenGL enum.", "Pekan");
+		return 0;
+	}
+
 	unsigned RenderState::getBufferDataUsageOpenGLEnum(BufferDataUsage dataUsage)
 	{
 		switch (dataUsage)
@@ -142,6 +267,9 @@ namespace Graphics
 			case ShaderDataType::Int3:      return 4 * 3;
 			case ShaderDataType::Int4:      return 4 * 4;
 			case ShaderDataType::Bool:      return 1;
+			case ShaderDataType::UnsignedByte4:     return 1 * 4;
+			case ShaderDataType::UnsignedShort2:    return 2 * 2;
+			case ShaderDataType::HalfFloat4:        return 2 * 4;
 		}
 		PK_ASSERT(false, "Unknown ShaderDataType, cannot determine its size.", "Pekan");
 		return 0;
@@ -162,6 +290,9 @@ namespace Graphics
 			case ShaderDataType::Int3:      return 3;
 			case ShaderDataType::Int4:      return 4;
 			case ShaderDataType::Bool:      return 1;
+			case ShaderDataType::UnsignedByte4:     return 4;
+			case ShaderDataType::UnsignedShort2:    return 2;
+			case ShaderDataType::HalfFloat4:        return 4;
 		}
 		PK_ASSERT(false, "Unknown ShaderDataType, cannot determine its components count.", "Pekan");
 		return 0;
@@ -239,6 +370,27 @@ namespace Graphics
 		return maxTextureSize;
 	}
 
+	bool RenderState::isSupportedTextureCompressionS3TC()
+	{
+		static int isSupported = -1;
+		if (isSupported == -1)
+		{
+			isSupported = 0;
+			int extensionsCount = 0;
+			glGetIntegerv(GL_NUM_EXTENSIONS, &extensionsCount);
+			for (int i = 0; i < extensionsCount; i++)
+			{
+				const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, unsigned(i)));
+				if (extension != nullptr && std::strcmp(extension, "GL_EXT_texture_compression_s3tc") == 0)
+				{
+					isSupported = 1;
+					break;
+				}
+			}
+		}
+		return isSupported == 1;
+	}
+
 	unsigned RenderState::getTextureMinifyFunctionOpenGLEnum(TextureMinifyFunction function)
 	{
 		switch (function)
@@ -246,9 +398,9 @@ namespace Graphics
 			case TextureMinifyFunction::Nearest:                   return GL_NEAREST;
 			case TextureMinifyFunction::Linear:                    return GL_LINEAR;
 			case TextureMinifyFunction::NearestOnNearestMipmap:    return GL_NEAREST_MIPMAP_NEAREST;
-			case TextureMinifyFunction::LinearOnNearestMipmap:     return GL_NEAREST;
-			case TextureMinifyFunction::NearestOnLinearMipmap:     return GL_NEAREST;
-			case TextureMinifyFunction::LinearOnLinearMipmap:      return GL_NEAREST;
+			case TextureMinifyFunction::LinearOnNearestMipmap:     return GL_LINEAR_MIPMAP_NEAREST;
+			case TextureMinifyFunction::NearestOnLinearMipmap:     return GL_NEAREST_MIPMAP_LINEAR;
+			case TextureMinifyFunction::LinearOnLinearMipmap:      return GL_LINEAR_MIPMAP_LINEAR;
 		};
 		PK_ASSERT(false, "Unknown TextureMinifyFunction, cannot determine OpenGL enum.", "Pekan");
 		return 0;
@@ -11,7 +11,11 @@ namespace Graphics
 	// They are mapped to concrete data types of GLSL, HLSL, etc.
 	enum class ShaderDataType
 	{
-		None = 0, Float = 1, Float2 = 2, Float3 = 3, Float4 = 4, Mat3 = 5, Mat4 = 6, Int = 7, Int2 = 8, Int3 = 9, Int4 = 10, Bool = 11
+		None = 0, Float = 1, Float2 = 2, Float3 = 3, Float4 = 4, Mat3 = 5, Mat4 = 6, Int = 7, Int2 = 8, Int3 = 9, Int4 = 10, Bool = 11,
+		// Types read as floats in the shader, either as they are, or normalized to the range from 0 to 1
+		UnsignedByte4 = 12, UnsignedShort2 = 13,
+		// Type read as floats in the shader, stored as 16-bit floats
+		HalfFloat4 = 14
 	};
 
 	// Enum for different types of blending factors
@@ -33,6 +37,36 @@ namespace Graphics
 		OneMinusConstantAlpha
 	};
 
+	// Enum for different equations used for blending
+	// the incoming (source) values with the values that are already in the frame buffer (destination).
+	enum class BlendEquation
+	{
+		// source * sourceFactor + destination * destinationFactor
+		Add,
+		// source * sourceFactor - destination * destinationFactor
+		Subtract,
+		// destination * destinationFactor - source * sourceFactor
+		ReverseSubtract,
+		// min(source, destination), blend factors are ignored
+		Min,
+		// max(source, destination), blend factors are ignored
+		Max
+	};
+
+	// Enum for different functions used for depth testing,
+	// comparing the incoming (source) depth with the depth that is already in the depth buffer (destination).
+	enum class DepthFunction
+	{
+		Never,
+		Less,
+		Equal,
+		LessOrEqual,
+		Greater,
+		NotEqual,
+		GreaterOrEqual,
+		Always
+	};
+
 	// Enum for different types of usage of a buffer
 	enum class BufferDataUsage
 	{
@@ -118,15 +152,47 @@ namespace Graphics
 
 		// Sets background's color, used to clear window
 		static void setBackgroundColor(float r, float g, float b, float a);
+		// Returns background's color
+		static glm::vec4 getBackgroundColor();
+
+		// Sets the viewport - the rectangle of the current frame buffer, in pixels, where rendering will happen
+		static void setViewport(int x, int y, int width, int height);
+		// Returns current viewport as (x, y, width, height)
+		static glm::ivec4 getViewport();
 
-		// Enables blending capability
+		// Returns the ID of the frame buffer that is currently bound for drawing,
+		// where 0 is the default frame buffer, which is the screen.
+		// Together with bindFrameBuffer() it allows code to render to its own frame buffer and then restore whatever was bound before.
+		//
+		// NOTE: This function queries OpenGL, so it's relatively slow and should NOT be called every frame outside of debug code.
+		static unsigned getBoundFrameBufferId();
+		// Binds the frame buffer with a given ID, as returned by getBoundFrameBufferId()
+		static void bindFrameBuffer(unsigned id);
+		// Returns the number of samples per pixel of the frame buffer that is currently bound for drawing,
+		// which is 1 if it's not a multisample frame buffer.
+		//
+		// NOTE: This function queries OpenGL, so it's relatively slow and should NOT be called every frame outside of debug code.
+		static int getBoundFrameBufferSamplesPerPixel();
+
+		// Enables/disables blending capability
 		static void enableBlending();
+		static void disableBlending();
+		// Checks if blending is enabled.
+		static bool isEnabledBlending();
 
 		// Sets the function used for blending.
 		// This function is used to blend the incoming (source) RGBA values
 		// with the RGBA values that are already in the frame buffer (destination).
 		// NOTE: You need to enable blending with enableBlending() before using this function
 		static void setBlendFunction(BlendFactor sourceFactor, BlendFactor destinationFactor);
+		// Returns the factors of the function currently used for blending
+		static BlendFactor getBlendSourceFactor();
+		static BlendFactor getBlendDestinationFactor();
+
+		// Sets the equation used for blending, combining source and destination values after they are multiplied by their blend factors.
+		// Default equation is Add.
+		// NOTE: You need to enable blending with enableBlending() before using this function
+		static void setBlendEquation(BlendEquation equation);
 
 		// Enables/disables depth testing.
 		// Usually used so that overlapping primitives can be drawn correctly,
@@ -136,6 +202,16 @@ namespace Graphics
 		// Checks if depth testing is enabled.
 		static bool isEnabledDepthTest();
 
+		// Enables/disables writing to the depth buffer.
+		// Writing is enabled by default. If it's disabled, depth testing still works, but the depth buffer doesn't change.
+		static void enableDepthWriting();
+		static void disableDepthWriting();
+
+		// Sets the function used for depth testing.
+		// Default function is Less, meaning that a fragment passes if it's closer than what's already drawn.
+		// NOTE: You need to enable depth testing with enableDepthTest() before this function has any effect
+		static void setDepthFunction(DepthFunction function);
+
 		// Enables Multisample Anti-Aliasing (MSAA) for removing jagged edges of shapes and lines.
 		// IMPORTANT: In order for MSAA to work you need to have a window
 		//            with numberOfSamples greater than 1, preferably 4, 8, 16, 32 or 64.
@@ -161,6 +237,9 @@ namespace Graphics
 		// and a 2D texture can have at most 1024 * 1024 = 1048576 texels.
 		static int getMaxTextureSize();
 
+		// Checks if S3TC (also known as DXT, or BC1-BC3) compressed textures are supported on current hardware
+		static bool isSupportedTextureCompressionS3TC();
+
 	private: /* functions */
 
 		// Returns the OpenGL base data type corresponding to the given shader data type.
@@ -171,6 +250,12 @@ namespace Graphics
 		// Returns the OpenGL enum value corresponding to the given blend factor
 		static unsigned getBlendFactorOpenGLEnum(BlendFactor blendFactor);
 
+		// Returns the OpenGL enum value corresponding to the given blend equation
+		static unsigned getBlendEquationOpenGLEnum(BlendEquation blendEquation);
+
+		// Returns the OpenGL enum value corresponding to the given depth function
+		static unsigned getDepthFunctionOpenGLEnum(DepthFunction depthFunction);
+
 		// Returns the OpenGL enum value corresponding to the given buffer data usage
 		static unsigned getBufferDataUsageOpenGLEnum(BufferDataUsage dataUsage);
 
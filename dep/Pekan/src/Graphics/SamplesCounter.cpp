@@ -0,0 +1,63 @@
+#include "SamplesCounter.h"
+
+#include "GLCall.h"
+
+namespace Pekan
+{
+namespace Graphics
+{
+
+	SamplesCounter::~SamplesCounter()
+	{
+		PK_ASSERT(!isValid(), "You forgot to destroy() a SamplesCounter instance.", "Pekan");
+	}
+
+	void SamplesCounter::create()
+	{
+		PK_ASSERT(!isValid(), "Trying to create a SamplesCounter instance that is already created.", "Pekan");
+
+		m_queries.create(1);
+		m_latestSamplesCount = -1;
+		m_latestTargetSamplesCount = 0;
+	}
+
+	void SamplesCounter::destroy()
+	{
+		PK_ASSERT(isValid(), "Trying to destroy a SamplesCounter instance that is not yet created.", "Pekan");
+
+		m_queries.destroy();
+	}
+
+	void SamplesCounter::begin(long long targetSamplesCount)
+	{
+		PK_ASSERT(isValid(), "Trying to begin counting with a SamplesCounter that is not yet created.", "Pekan");
+
+		if (m_queries.begin())
+		{
+			storeLatestResult();
+		}
+
+		m_targetSamplesCounts[m_queries.getCurrentSlot()] = targetSamplesCount;
+		GLCall(glBeginQuery(GL_SAMPLES_PASSED, m_queries.getCurrentId(0)));
+	}
+
+	void SamplesCounter::end()
+	{
+		PK_ASSERT(isValid(), "Trying to end counting with a SamplesCounter that is not yet created.", "Pekan");
+
+		GLCall(glEndQuery(GL_SAMPLES_PASSED));
+
+		if (m_queries.end())
+		{
+			storeLatestResult();
+		}
+	}
+
+	void SamplesCounter::storeLatestResult()
+	{
+		m_latestSamplesCount = (long long)(m_queries.getLatestResult(0));
+		m_latestTargetSamplesCount = m_targetSamplesCounts[m_queries.getLatestSlot()];
+	}
+
+} // namespace Graphics
+} // namespace Pekan
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "GpuQueryRing.h"
+
+namespace Pekan
+{
+namespace Graphics
+{
+
+	// A class for counting how many samples pass all tests and are written by the commands issued between begin() and end().
+	// Dividing the number of samples by the number of samples of the target being drawn to,
+	// which is its number of pixels times its number of samples per pixel,
+	// gives how many times each pixel is drawn on average, which is a measure of overdraw.
+	//
+	// Like GpuTimer, counts are read a few frames later, from a GpuQueryRing of OpenGL queries,
+	// to avoid stalling the CPU while waiting for the GPU.
+	//
+	// NOTE: Calls to different SamplesCounters cannot be nested.
+	class SamplesCounter
+	{
+	public:
+
+		~SamplesCounter();
+
+		void create();
+		void destroy();
+
+		// Begins/ends counting samples.
+		// Number of samples of the target being drawn to is kept together with the count,
+		// so that they match even if the target changes before the count is available.
+		void begin(long long targetSamplesCount = 0);
+		void end();
+
+		// Returns the latest available number of samples,
+		// or a negative value if no count is available yet.
+		long long getSamplesCount() const { return m_latestSamplesCount; }
+		// Returns the number of samples of the target that the latest available count was made in, as given to begin()
+		long long getTargetSamplesCount() const { return m_latestTargetSamplesCount; }
+
+		// Checks if samples counter is valid, meaning that it has been successfully created and not yet destroyed
+		bool isValid() const { return m_queries.isValid(); }
+
+	private: /* functions */
+
+		// Stores the latest read result of the query ring as the latest number of samples
+		void storeLatestResult();
+
+	private: /* variables */
+
+		// Ring of queries counting samples
+		GpuQueryRing m_queries;
+
+		// Number of samples of the target that each slot of the query ring counts samples in
+		long long m_targetSamplesCounts[GpuQueryRing::SLOTS_COUNT] = {};
+
+		// Latest available number of samples
+		long long m_latestSamplesCount = -1;
+		// Number of samples of the target that the latest available number of samples was counted in
+		long long m_latestTargetSamplesCount = 0;
+	};
+
+} // namespace Graphics
+} // namespace Pekan
\ No newline at end of file
@@ -21,6 +21,15 @@ namespace Graphics
         // Generates a corresponding .glsl file with the resulting shader
         // in the same path, same name, with .glsl extension.
         static void preprocess(const std::string& pkshadFilepath, const std::unordered_map<std::string, std::string>& substitutions);
+
+        // Replaces all {{PLACEHOLDER}}s in given shader source with their values from a given list of substitutions,
+        // and returns the result. Given source name is used only for error messages.
+        static std::string substitute
+        (
+            const std::string& content,
+            const std::unordered_map<std::string, std::string>& substitutions,
+            const std::string& sourceName
+        );
     };
 
 } // namespace Graphics
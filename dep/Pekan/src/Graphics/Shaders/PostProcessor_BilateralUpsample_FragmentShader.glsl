@@ -0,0 +1,56 @@
+#version 330 core
+
+in vec2 texCoords;
+out vec4 FragColor;
+
+// Rendered frame, at full resolution
+uniform sampler2D screenTexture;
+// Accumulated light, at reduced resolution
+uniform sampler2D lightTexture;
+
+// How strongly a difference in frame's luminance reduces the weight of a light sample.
+// Higher values preserve edges better, lower values give a smoother (more bilinear) result.
+const float edgeSharpness = 8.0;
+
+float luminance(vec3 color)
+{
+    return dot(color, vec3(0.2126, 0.7152, 0.0722));
+}
+
+void main()
+{
+    vec3 baseColor = texture(screenTexture, texCoords).rgb;
+    float baseLuminance = luminance(baseColor);
+
+    // Find the 4 light texels surrounding current fragment,
+    // and fragment's position between them
+    ivec2 lightSize = textureSize(lightTexture, 0);
+    vec2 lightCoords = texCoords * vec2(lightSize) - 0.5;
+    ivec2 lightTexel = ivec2(floor(lightCoords));
+    vec2 t = fract(lightCoords);
+
+    // Accumulate the 4 light samples with bilinear weights,
+    // reduced where the frame at the light sample differs from the frame at current fragment.
+    // This way light doesn't bleed across edges in the frame.
+    vec3 lightSum = vec3(0.0);
+    float weightSum = 0.0;
+    for (int y = 0; y <= 1; y++)
+    {
+        for (int x = 0; x <= 1; x++)
+        {
+            ivec2 texel = clamp(lightTexel + ivec2(x, y), ivec2(0), lightSize - 1);
+            vec2 texelCoords = (vec2(texel) + 0.5) / vec2(lightSize);
+
+            float bilinearWeight = (x == 0 ? 1.0 - t.x : t.x) * (y == 0 ? 1.0 - t.y : t.y);
+            float guideLuminance = luminance(texture(screenTexture, texelCoords).rgb);
+            float edgeWeight = exp(-abs(guideLuminance - baseLuminance) * edgeSharpness);
+            float weight = bilinearWeight * edgeWeight + 0.0001;
+
+            lightSum += texelFetch(lightTexture, texel, 0).rgb * weight;
+            weightSum += weight;
+        }
+    }
+    vec3 light = lightSum / weightSum;
+
+    FragColor = vec4(baseColor * light, 1.0);
+}
\ No newline at end of file
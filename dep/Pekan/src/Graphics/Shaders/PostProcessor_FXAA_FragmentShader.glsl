@@ -0,0 +1,65 @@
+#version 330 core
+
+in vec2 texCoords;
+out vec4 FragColor;
+
+// Post-processed frame, sampled with linear filtering
+uniform sampler2D screenTexture;
+
+// Maximum length of the blur along an edge, in pixels
+const float spanMax = 8.0;
+// How much the blur direction is reduced based on local luminance.
+// Keeps noise in dark areas from being treated as edges.
+const float reduceMultiplier = 1.0 / 8.0;
+const float reduceMin = 1.0 / 128.0;
+
+float luminance(vec3 color)
+{
+    return dot(color, vec3(0.299, 0.587, 0.114));
+}
+
+void main()
+{
+    vec2 texelSize = 1.0 / vec2(textureSize(screenTexture, 0));
+
+    // Sample luminance at current fragment and its 4 diagonal neighbours
+    vec3 colorM = texture(screenTexture, texCoords).rgb;
+    float lumaM = luminance(colorM);
+    float lumaNW = luminance(texture(screenTexture, texCoords + vec2(-1.0, -1.0) * texelSize).rgb);
+    float lumaNE = luminance(texture(screenTexture, texCoords + vec2(1.0, -1.0) * texelSize).rgb);
+    float lumaSW = luminance(texture(screenTexture, texCoords + vec2(-1.0, 1.0) * texelSize).rgb);
+    float lumaSE = luminance(texture(screenTexture, texCoords + vec2(1.0, 1.0) * texelSize).rgb);
+
+    float lumaMin = min(lumaM, min(min(lumaNW, lumaNE), min(lumaSW, lumaSE)));
+    float lumaMax = max(lumaM, max(max(lumaNW, lumaNE), max(lumaSW, lumaSE)));
+
+    // Find the direction along the edge, which is perpendicular to the luminance gradient
+    vec2 direction;
+    direction.x = -((lumaNW + lumaNE) - (lumaSW + lumaSE));
+    direction.y = ((lumaNW + lumaSW) - (lumaNE + lumaSE));
+
+    // Scale direction so that its smaller component is 1 pixel, limiting the blur to spanMax pixels
+    float directionReduce = max((lumaNW + lumaNE + lumaSW + lumaSE) * 0.25 * reduceMultiplier, reduceMin);
+    float inverseDirectionMin = 1.0 / (min(abs(direction.x), abs(direction.y)) + directionReduce);
+    direction = clamp(direction * inverseDirectionMin, vec2(-spanMax), vec2(spanMax)) * texelSize;
+
+    // Blur along the edge with 2 taps close to the fragment,
+    // and with 2 more taps further away
+    vec3 colorA = 0.5 * (
+        texture(screenTexture, texCoords + direction * (1.0 / 3.0 - 0.5)).rgb +
+        texture(screenTexture, texCoords + direction * (2.0 / 3.0 - 0.5)).rgb);
+    vec3 colorB = colorA * 0.5 + 0.25 * (
+        texture(screenTexture, texCoords + direction * -0.5).rgb +
+        texture(screenTexture, texCoords + direction * 0.5).rgb);
+
+    // If the further taps went past the edge, use only the close ones
+    float lumaB = luminance(colorB);
+    if (lumaB < lumaMin || lumaB > lumaMax)
+    {
+        FragColor = vec4(colorA, 1.0);
+    }
+    else
+    {
+        FragColor = vec4(colorB, 1.0);
+    }
+}
@@ -17,6 +17,9 @@ namespace Renderer2D
 	//       For an actual game/application it's better to use
 	//           class LineShape
 	//       It is better optimized and allows control of line's thickness.
+	//       For rendering many lines at once, like debug overlays, it's better to use
+	//           class Polyline
+	//       It renders any number of segments with a single draw call.
 	//
 	// NOTE: Another difference between Line and LineShape is that a Line always has a thickness of 1 pixel,
 	//       no matter how much you zoom in/out with a camera,
@@ -0,0 +1,377 @@
+#include "Polyline.h"
+
+#include "PekanLogger.h"
+#include "Utils/FileUtils.h"
+#include "Renderer2DSystem.h"
+
+#include <glm/gtc/constants.hpp>
+#include <algorithm>
+#include <cmath>
+
+#define VERTEX_SHADER_FILEPATH PEKAN_RENDERER2D_ROOT_DIR "/Shaders/2D_Polyline_VertexShader.glsl"
+#define FRAGMENT_SHADER_FILEPATH PEKAN_RENDERER2D_ROOT_DIR "/Shaders/2D_Polyline_FragmentShader.glsl"
+
+static const float PI = glm::pi<float>();
+
+// Maximum angle covered by a single triangle of a round join.
+// A join turning by 180 degrees is made of 8 triangles.
+static const float ROUND_JOIN_MAX_ANGLE_STEP = PI / 8.0f;
+
+// Segments with a length smaller than that are considered degenerate and are not rendered
+static constexpr float MIN_SEGMENT_LENGTH = 1e-6f;
+// Joints where segments' directions are closer than that to being parallel are not filled
+static constexpr float MIN_JOINT_SINE = 1e-4f;
+
+using namespace Pekan::Graphics;
+
+namespace Pekan
+{
+namespace Renderer2D
+{
+
+	// Returns the vector rotated by 90 degrees counter-clockwise
+	static glm::vec2 getPerpendicular(glm::vec2 vector)
+	{
+		return { -vector.y, vector.x };
+	}
+
+	void Polyline::create(LineJoin join)
+	{
+		m_join = join;
+
+		m_renderObject.create
+		(
+			nullptr, 0,
+			{
+				{ ShaderDataType::Float2, "position" },
+				{ ShaderDataType::Float4, "color" }
+			},
+			BufferDataUsage::DynamicDraw,
+			FileUtils::readTextFileToString(VERTEX_SHADER_FILEPATH).c_str(),
+			FileUtils::readTextFileToString(FRAGMENT_SHADER_FILEPATH).c_str()
+		);
+		m_vertexBufferCapacity = 0;
+
+		// Set shader's view projection matrix uniform to an identity matrix
+		static const glm::mat4 defaultViewProjectionMatrix = glm::mat4(1.0f);
+		m_renderObject.getShader().setUniformMatrix4fv("uViewProjectionMatrix", defaultViewProjectionMatrix);
+	}
+
+	void Polyline::destroy()
+	{
+		PK_ASSERT(m_renderObject.isValid(), "Trying to destroy a Polyline that is not yet created.", "Pekan");
+		m_renderObject.destroy();
+
+		m_segments.clear();
+		m_vertices.clear();
+		m_vertexBufferCapacity = 0;
+		m_needUpdateVertices = false;
+	}
+
+	void Polyline::addSegment(glm::vec2 pointA, glm::vec2 pointB, glm::vec4 color, float thickness)
+	{
+		PK_ASSERT(thickness >= 0.0f, "Polyline's segment thickness must be greater than or equal to 0.", "Pekan");
+
+		Segment segment;
+		segment.pointA = pointA;
+		segment.pointB = pointB;
+		segment.color = color;
+		segment.thickness = thickness;
+		m_segments.push_back(segment);
+
+		m_needUpdateVertices = true;
+	}
+
+	void Polyline::addPolyline(const glm::vec2* points, int pointsCount, const glm::vec4* colors, const float* thicknesses, bool isClosed)
+	{
+		PK_ASSERT(points != nullptr && colors != nullptr && thicknesses != nullptr, "Trying to add a polyline with null points, colors or thicknesses.", "Pekan");
+		if (pointsCount < 2)
+		{
+			PK_LOG_ERROR("Trying to add a polyline with less than 2 points. It will not be added.", "Pekan");
+			return;
+		}
+
+		const int firstSegmentIndex = int(m_segments.size());
+		const int segmentsCount = isClosed ? pointsCount : pointsCount - 1;
+		m_segments.reserve(m_segments.size() + segmentsCount);
+		for (int i = 0; i < segmentsCount; i++)
+		{
+			PK_ASSERT(thicknesses[i] >= 0.0f, "Polyline's segment thickness must be greater than or equal to 0.", "Pekan");
+
+			Segment segment;
+			segment.pointA = points[i];
+			segment.pointB = points[(i + 1) % pointsCount];
+			segment.color = colors[i];
+			segment.thickness = thicknesses[i];
+			// Join each segment to the next one, and the last segment to the first one if polyline is closed
+			if (i + 1 < segmentsCount)
+			{
+				segment.nextSegmentIndex = firstSegmentIndex + i + 1;
+			}
+			else if (isClosed)
+			{
+				segment.nextSegmentIndex = firstSegmentIndex;
+			}
+			m_segments.push_back(segment);
+		}
+
+		m_needUpdateVertices = true;
+	}
+
+	void Polyline::addPolyline(const glm::vec2* points, int pointsCount, glm::vec4 color, float thickness, bool isClosed)
+	{
+		PK_ASSERT(points != nullptr, "Trying to add a polyline with null points.", "Pekan");
+		PK_ASSERT(thickness >= 0.0f, "Polyline's segment thickness must be greater than or equal to 0.", "Pekan");
+		if (pointsCount < 2)
+		{
+			PK_LOG_ERROR("Trying to add a polyline with less than 2 points. It will not be added.", "Pekan");
+			return;
+		}
+
+		const int firstSegmentIndex = int(m_segments.size());
+		const int segmentsCount = isClosed ? pointsCount : pointsCount - 1;
+		m_segments.reserve(m_segments.size() + segmentsCount);
+		for (int i = 0; i < segmentsCount; i++)
+		{
+			Segment segment;
+			segment.pointA = points[i];
+			segment.pointB = points[(i + 1) % pointsCount];
+			segment.color = color;
+			segment.thickness = thickness;
+			if (i + 1 < segmentsCount)
+			{
+				segment.nextSegmentIndex = firstSegmentIndex + i + 1;
+			}
+			else if (isClosed)
+			{
+				segment.nextSegmentIndex = firstSegmentIndex;
+			}
+			m_segments.push_back(segment);
+		}
+
+		m_needUpdateVertices = true;
+	}
+
+	void Polyline::clear()
+	{
+		if (!m_segments.empty())
+		{
+			m_segments.clear();
+			m_needUpdateVertices = true;
+		}
+	}
+
+	void Polyline::update()
+	{
+		PK_ASSERT(m_renderObject.isValid(), "Trying to update a Polyline that is not yet created.", "Pekan");
+
+		if (m_needUpdateVertices)
+		{
+			updateVertices();
+			m_needUpdateVertices = false;
+		}
+
+		// Get current camera
+		Camera2D_ConstPtr camera = Renderer2DSystem::getCamera();
+		if (camera != nullptr)
+		{
+			// Set shader's view projection matrix uniform to camera's transform
+			const glm::mat4& viewProjectionMatrix = camera->getViewProjectionMatrix();
+			m_renderObject.getShader().setUniformMatrix4fv("uViewProjectionMatrix", viewProjectionMatrix);
+		}
+		else
+		{
+			// Set shader's view projection matrix uniform to a default view projection matrix
+			static const glm::mat4 defaultViewProjectionMatrix = glm::mat4(1.0f);
+			m_renderObject.getShader().setUniformMatrix4fv("uViewProjectionMatrix", defaultViewProjectionMatrix);
+		}
+	}
+
+	void Polyline::render() const
+	{
+		PK_ASSERT(m_renderObject.isValid(), "Trying to render a Polyline that is not yet created.", "Pekan");
+		PK_ASSERT(!m_needUpdateVertices, "Trying to render a Polyline whose segments have changed since last update. Call update() before render().", "Pekan");
+
+		if (m_vertices.empty())
+		{
+			return;
+		}
+		// Render all segments with a single draw call
+		m_renderObject.renderRange(0, unsigned(m_vertices.size()), DrawMode::Triangles);
+	}
+
+	void Polyline::setJoin(LineJoin join)
+	{
+		if (m_join != join)
+		{
+			m_join = join;
+			m_needUpdateVertices = true;
+		}
+	}
+
+	void Polyline::setMiterLimit(float miterLimit)
+	{
+		PK_ASSERT(miterLimit >= 1.0f, "Polyline's miter limit must be greater than or equal to 1.", "Pekan");
+		if (m_miterLimit != miterLimit)
+		{
+			m_miterLimit = miterLimit;
+			m_needUpdateVertices = true;
+		}
+	}
+
+	void Polyline::updateVertices()
+	{
+		m_vertices.clear();
+		// Each segment is 2 triangles, and most joins are 1 or 2 triangles
+		m_vertices.reserve(m_segments.size() * 12);
+
+		for (int i = 0; i < int(m_segments.size()); i++)
+		{
+			const Segment& segment = m_segments[i];
+			const glm::vec2 direction = segment.pointB - segment.pointA;
+			const float length = glm::length(direction);
+			if (length < MIN_SEGMENT_LENGTH)
+			{
+				continue;
+			}
+
+			// Expand segment into a quad, made of 2 triangles
+			const glm::vec2 offset = getPerpendicular(direction) * (0.5f * segment.thickness / length);
+			addTriangle(segment.pointA + offset, segment.pointA - offset, segment.pointB - offset, segment.color);
+			addTriangle(segment.pointA + offset, segment.pointB - offset, segment.pointB + offset, segment.color);
+
+			if (segment.nextSegmentIndex >= 0)
+			{
+				addJoin(i, segment.nextSegmentIndex);
+			}
+		}
+
+		// Upload vertices to vertex buffer, growing it if they don't fit
+		const long long size = (long long)(m_vertices.size() * sizeof(Vertex));
+		if (size > m_vertexBufferCapacity)
+		{
+			m_vertexBufferCapacity = std::max(size, 2 * m_vertexBufferCapacity);
+			m_renderObject.setVertexData(nullptr, m_vertexBufferCapacity);
+		}
+		if (size > 0)
+		{
+			m_renderObject.setVertexSubData(m_vertices.data(), 0, size);
+		}
+	}
+
+	void Polyline::addJoin(int segmentIndex, int nextSegmentIndex)
+	{
+		const Segment& segment = m_segments[segmentIndex];
+		const Segment& nextSegment = m_segments[nextSegmentIndex];
+
+		const glm::vec2 direction = segment.pointB - segment.pointA;
+		const glm::vec2 nextDirection = nextSegment.pointB - nextSegment.pointA;
+		const float length = glm::length(direction);
+		const float nextLength = glm::length(nextDirection);
+		if (length < MIN_SEGMENT_LENGTH || nextLength < MIN_SEGMENT_LENGTH)
+		{
+			return;
+		}
+		const glm::vec2 unitDirection = direction / length;
+		const glm::vec2 nextUnitDirection = nextDirection / nextLength;
+
+		// Sine and cosine of the angle that polyline turns by at the joint
+		const float sine = unitDirection.x * nextUnitDirection.y - unitDirection.y * nextUnitDirection.x;
+		const float cosine = glm::dot(unitDirection, nextUnitDirection);
+		// If segments continue in the same direction there is no gap to be filled
+		if (std::abs(sine) < MIN_JOINT_SINE && cosine > 0.0f)
+		{
+			return;
+		}
+
+		// The gap is on the outer side of the turn, so on the right side if polyline turns left,
+		// and on the left side if polyline turns right.
+		const float side = (sine > 0.0f) ? -1.0f : 1.0f;
+		const glm::vec2 normal = getPerpendicular(unitDirection) * side;
+		const glm::vec2 nextNormal = getPerpendicular(nextUnitDirection) * side;
+		const float halfThickness = 0.5f * segment.thickness;
+		const float nextHalfThickness = 0.5f * nextSegment.thickness;
+
+		// Corners of the 2 segments on the outer side of the joint
+		const glm::vec2 joint = segment.pointB;
+		const glm::vec2 outerCorner = joint + normal * halfThickness;
+		const glm::vec2 nextOuterCorner = joint + nextNormal * nextHalfThickness;
+		// Join is drawn with the color of the next segment
+		const glm::vec4 color = nextSegment.color;
+
+		switch (m_join)
+		{
+			case LineJoin::Miter:
+			{
+				// Miter's corner lies on the bisector of the 2 normals,
+				// at a distance that is inversely proportional to the cosine of half the angle between them.
+				const glm::vec2 bisector = normal + nextNormal;
+				const float bisectorLength = glm::length(bisector);
+				if (bisectorLength > MIN_SEGMENT_LENGTH)
+				{
+					const glm::vec2 unitBisector = bisector / bisectorLength;
+					const float halfAngleCosine = glm::dot(unitBisector, normal);
+					if (halfAngleCosine * m_miterLimit >= 1.0f)
+					{
+						const float averageHalfThickness = 0.5f * (halfThickness + nextHalfThickness);
+						const glm::vec2 miterCorner = joint + unitBisector * (averageHalfThickness / halfAngleCosine);
+						addTriangle(joint, outerCorner, miterCorner, color);
+						addTriangle(joint, miterCorner, nextOuterCorner, color);
+						return;
+					}
+				}
+				// Corner is too sharp, so fall back to a bevel join
+				addTriangle(joint, outerCorner, nextOuterCorner, color);
+				return;
+			}
+			case LineJoin::Round:
+			{
+				// Fill the gap with a fan of triangles around the joint,
+				// rotating from segment's normal to next segment's normal, in the direction that polyline turns
+				const float angle = std::atan2(std::abs(sine), cosine);
+				const float rotationDirection = -side;
+				const int stepsCount = std::max(1, int(std::ceil(angle / ROUND_JOIN_MAX_ANGLE_STEP)));
+				glm::vec2 previousPoint = outerCorner;
+				for (int step = 1; step <= stepsCount; step++)
+				{
+					const float t = float(step) / float(stepsCount);
+					const float stepAngle = rotationDirection * angle * t;
+					const float stepSine = std::sin(stepAngle);
+					const float stepCosine = std::cos(stepAngle);
+					const glm::vec2 stepNormal =
+					{
+						normal.x * stepCosine - normal.y * stepSine,
+						normal.x * stepSine + normal.y * stepCosine
+					};
+					const glm::vec2 point = (step == stepsCount)
+						? nextOuterCorner
+						: joint + stepNormal * glm::mix(halfThickness, nextHalfThickness, t);
+					addTriangle(joint, previousPoint, point, color);
+					previousPoint = point;
+				}
+				return;
+			}
+			case LineJoin::Bevel:
+			{
+				addTriangle(joint, outerCorner, nextOuterCorner, color);
+				return;
+			}
+		}
+	}
+
+	void Polyline::addTriangle(glm::vec2 a, glm::vec2 b, glm::vec2 c, glm::vec4 color)
+	{
+		// Swap 2 of the vertices if triangle is clockwise, so that it's not culled if face culling is enabled
+		const glm::vec2 ab = b - a;
+		const glm::vec2 ac = c - a;
+		if (ab.x * ac.y - ab.y * ac.x < 0.0f)
+		{
+			std::swap(b, c);
+		}
+		m_vertices.push_back({ a, color });
+		m_vertices.push_back({ b, color });
+		m_vertices.push_back({ c, color });
+	}
+
+} // namespace Renderer2D
+} // namespace Pekan
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "RenderObject.h"
+#include "Camera2D.h"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+namespace Pekan
+{
+namespace Renderer2D
+{
+
+	// Enum for different ways of joining 2 consecutive segments of a polyline
+	enum class LineJoin
+	{
+		// The gap on the outer side of the joint is filled with a single triangle, cutting the corner off
+		Bevel = 0,
+		// Outer edges of both segments are extended until they meet, giving a sharp corner.
+		// Falls back to a bevel join if the corner would be too long, see Polyline::setMiterLimit().
+		Miter = 1,
+		// The gap on the outer side of the joint is filled with an arc, giving a rounded corner
+		Round = 2
+	};
+
+	// A class representing a list of 2D line segments, where each segment has its own color and thickness,
+	// and consecutive segments of a polyline are joined with miter, bevel or round joins.
+	//
+	// All segments are expanded into triangles in a single pass on the CPU, only when segments have changed,
+	// and are rendered with a single draw call, so it's suitable for rendering tens of thousands of segments,
+	// for example debug overlays like collision boxes and navigation graphs.
+	//
+	// NOTE: Like LineShape, segments have a world-space thickness, so if you zoom in they will appear thicker
+	//       and if you zoom out they will appear thinner.
+	//
+	// NOTE: Like Line, a Polyline owns its own render object and is NOT rendered as part of the 2D batch.
+	//       Call update() after changing segments or camera, and then render().
+	class Polyline
+	{
+	public:
+
+		void create(LineJoin join = LineJoin::Miter);
+		void destroy();
+
+		// Adds a single segment between 2 points, not joined to any other segment
+		void addSegment(glm::vec2 pointA, glm::vec2 pointB, glm::vec4 color, float thickness);
+
+		// Adds a polyline going through given points, where consecutive segments are joined.
+		// @param[in] points - Points of the polyline
+		// @param[in] pointsCount - Number of points. Must be at least 2.
+		// @param[in] colors - Color of each segment. There must be (pointsCount - 1) colors, or pointsCount colors if polyline is closed.
+		// @param[in] thicknesses - Thickness of each segment. There must be as many thicknesses as there are colors.
+		// @param[in] isClosed - A flag indicating if last point should be connected back to the first one
+		void addPolyline(const glm::vec2* points, int pointsCount, const glm::vec4* colors, const float* thicknesses, bool isClosed = false);
+		// Adds a polyline going through given points, where all segments have the same color and thickness
+		void addPolyline(const glm::vec2* points, int pointsCount, glm::vec4 color, float thickness, bool isClosed = false);
+
+		// Removes all segments
+		void clear();
+
+		void update();
+		void render() const;
+
+		void setJoin(LineJoin join);
+		inline LineJoin getJoin() const { return m_join; }
+
+		// Sets the maximum ratio between the length of a miter join's corner and half of the segments' thickness.
+		// Sharper corners are joined with a bevel join instead.
+		void setMiterLimit(float miterLimit);
+		inline float getMiterLimit() const { return m_miterLimit; }
+
+		inline int getSegmentsCount() const { return int(m_segments.size()); }
+
+		// Checks if polyline is valid, meaning that it has been successfully created and not yet destroyed.
+		inline bool isValid() const { return m_renderObject.isValid(); }
+
+	private: /* functions */
+
+		// Expands all segments, and joins between them, into triangles,
+		// and uploads resulting vertices to render object's vertex buffer
+		void updateVertices();
+
+		// Adds triangles filling the gap between 2 consecutive segments, at the end of the first one
+		void addJoin(int segmentIndex, int nextSegmentIndex);
+
+		// Adds a triangle with a given color, making sure that it's counter-clockwise
+		void addTriangle(glm::vec2 a, glm::vec2 b, glm::vec2 c, glm::vec4 color);
+
+	private: /* variables */
+
+		// A segment between 2 points
+		struct Segment
+		{
+			glm::vec2 pointA = { 0.0f, 0.0f };
+			glm::vec2 pointB = { 0.0f, 0.0f };
+			glm::vec4 color = { 1.0f, 1.0f, 1.0f, 1.0f };
+			float thickness = 1.0f;
+			// Index of the segment that this segment is joined to at its point B, or -1 if there is no such segment
+			int nextSegmentIndex = -1;
+		};
+
+		// A vertex of a triangle that a segment, or a join, is expanded into
+		struct Vertex
+		{
+			glm::vec2 position = { 0.0f, 0.0f };
+			glm::vec4 color = { 1.0f, 1.0f, 1.0f, 1.0f };
+		};
+
+		Graphics::RenderObject m_renderObject;
+
+		std::vector<Segment> m_segments;
+
+		// Vertices of all triangles, in world space.
+		// Kept between updates, so that their memory is reused.
+		std::vector<Vertex> m_vertices;
+		// Size of render object's vertex buffer, in bytes.
+		// Vertex buffer grows when vertices don't fit into it, and never shrinks.
+		long long m_vertexBufferCapacity = 0;
+
+		LineJoin m_join = LineJoin::Miter;
+		float m_miterLimit = 4.0f;
+
+		// Flag indicating if vertices need to be updated, because segments or join have changed since last update
+		bool m_needUpdateVertices = false;
+	};
+
+} // namespace Renderer2D
+} // namespace Pekan
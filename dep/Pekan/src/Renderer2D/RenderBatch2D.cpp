@@ -2,6 +2,13 @@
 
 #include "PekanLogger.h"
 #include "Utils/FileUtils.h"
+#include "Memory/FrameArena.h"
+
+#include <algorithm>
+#include <cmath>
+#if PEKAN_USE_PACKED_2D_VERTICES && PEKAN_ENABLE_2D_SDF_SHAPES
+#include <glm/gtc/packing.hpp>
+#endif
 
 using namespace Pekan::Graphics;
 
@@ -27,18 +34,174 @@ namespace Renderer2D
 	// A batch's capacity for vertices.
 	// Used only when nothing else limits the batch from growing infinitely.
 	static constexpr int CAPACITY_VERTICES = 100000;
-	// A batch's capacity for indices.
+	// A batch's capacity for indices of index blocks.
 	// Used only when nothing else limits the batch from growing infinitely
 	static constexpr int CAPACITY_INDICES = 150000;
 #endif
 
+	// Indices of a quad, which rectangles, lines, SDF shapes and sprites all share
+	static constexpr unsigned QUAD_INDICES[6] = { 0, 1, 2, 0, 2, 3 };
+	// Maximum number of quads in a single range of quads.
+	// Indices of that many consecutive quads are kept at the beginning of each batch's index buffer,
+	// and are shared by all ranges of quads, so they are uploaded only once.
+	static constexpr int MAX_QUADS_PER_RANGE = 4096;
+	static constexpr int SHARED_QUAD_INDICES_COUNT = MAX_QUADS_PER_RANGE * 6;
+	// Maximum number of indices that index blocks can hold before they are all removed, when batch is cleared.
+	// Keeps index blocks from growing forever when primitives keep changing their topology.
+	static constexpr size_t MAX_INDEX_BLOCKS_INDICES_COUNT = 65536;
+
+	// Returns indices of MAX_QUADS_PER_RANGE consecutive quads { 0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7, ... }
+	static const std::vector<unsigned>& getSharedQuadIndices()
+	{
+		static std::vector<unsigned> quadIndices;
+		if (quadIndices.empty())
+		{
+			quadIndices.resize(SHARED_QUAD_INDICES_COUNT);
+			for (int i = 0; i < SHARED_QUAD_INDICES_COUNT; i++)
+			{
+				quadIndices[i] = unsigned(i / 6) * 4 + QUAD_INDICES[i % 6];
+			}
+		}
+		return quadIndices;
+	}
+
+	// Checks if given indices are the indices of a quad
+	static bool isQuad(const unsigned* indices, int indicesCount)
+	{
+		return indicesCount == 6 && std::equal(indices, indices + 6, QUAD_INDICES);
+	}
+
+#if PEKAN_USE_PACKED_2D_VERTICES
+	// Texture index of packed vertices that have no texture
+	static constexpr unsigned char PACKED_NO_TEXTURE_INDEX = 255;
+	// Maximum exponent of the power of 2 that packed texture coordinates are scaled down by
+	static constexpr int PACKED_TEXTURE_COORDINATES_MAX_EXPONENT = 15;
+
+	// Packs a value from the range from 0 to 1 into a 16-bit normalized integer
+	static unsigned short packUnorm16(float value)
+	{
+		return (unsigned short)(std::min(std::max(value, 0.0f), 1.0f) * 65535.0f + 0.5f);
+	}
+
+	// Packs a value from the range from 0 to 1 into an 8-bit normalized integer
+	static unsigned char packUnorm8(float value)
+	{
+		return (unsigned char)(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+	}
+
+	// Packs a vertex into a compact format, matching the packed vertex layout of the batch shaders
+	static PackedVertex2D packVertex(const Vertex2D& vertex)
+	{
+		PackedVertex2D packed;
+		packed.position = vertex.position;
+
+		glm::vec2 textureCoordinates = vertex.textureCoordinates;
+#if PEKAN_ENABLE_2D_SDF_SHAPES
+		for (int i = 0; i < 4; i++)
+		{
+			packed.sdfParameters[i] = glm::packHalf1x16(vertex.sdfParameters[i]);
+		}
+		if (vertex.sdfParameters.x >= 0.0f)
+		{
+			// Box coordinates of SDF shapes are packed relative to box's half size, so that they are around the range from -1 to 1,
+			// and vertex shader scales them back by the half size that it reads, which is rounded to a 16-bit float
+			const float halfWidth = glm::unpackHalf1x16(packed.sdfParameters[0]);
+			const float halfHeight = glm::unpackHalf1x16(packed.sdfParameters[1]);
+			textureCoordinates.x = (halfWidth > 0.0f) ? textureCoordinates.x / halfWidth : 0.0f;
+			textureCoordinates.y = (halfHeight > 0.0f) ? textureCoordinates.y / halfHeight : 0.0f;
+		}
+#endif
+		// Find the smallest power of 2 that texture coordinates fit into.
+		// Usually texture coordinates are in the range from 0 to 1, so it's 1 and they are packed as they are.
+		const float maxAbsTextureCoordinate = std::max(std::abs(textureCoordinates.x), std::abs(textureCoordinates.y));
+		int exponent = 0;
+		while (exponent < PACKED_TEXTURE_COORDINATES_MAX_EXPONENT && maxAbsTextureCoordinate > float(1 << exponent))
+		{
+			exponent++;
+		}
+		glm::vec2 normalizedTextureCoordinates = textureCoordinates / float(1 << exponent);
+		const bool isSigned = (textureCoordinates.x < 0.0f || textureCoordinates.y < 0.0f);
+		if (isSigned)
+		{
+			normalizedTextureCoordinates = normalizedTextureCoordinates * 0.5f + 0.5f;
+		}
+		packed.textureCoordinates[0] = packUnorm16(normalizedTextureCoordinates.x);
+		packed.textureCoordinates[1] = packUnorm16(normalizedTextureCoordinates.y);
+		packed.textureCoordinatesExponent = (unsigned char)(exponent);
+		packed.isTextureCoordinatesSigned = isSigned ? 1 : 0;
+
+		packed.textureIndex = (vertex.textureIndex >= 0.0f) ? (unsigned char)(vertex.textureIndex + 0.5f) : PACKED_NO_TEXTURE_INDEX;
+#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
+		packed.shapeIndex = vertex.shapeIndex;
+#else
+		for (int i = 0; i < 4; i++)
+		{
+			packed.color[i] = packUnorm8(vertex.color[i]);
+		}
+#endif
+#if PEKAN_ENABLE_2D_ANALYTIC_EDGE_ANTI_ALIASING
+		packed.edgeCoordinates[0] = packUnorm16(vertex.edgeCoordinates.x);
+		packed.edgeCoordinates[1] = packUnorm16(vertex.edgeCoordinates.y);
+#endif
+		return packed;
+	}
+
+	// Adds given vertices to the end of a list of packed vertices
+	static void appendVertices(std::vector<PackedVertex2D>& batchVertices, const Vertex2D* vertices, int verticesCount)
+	{
+		const size_t oldSize = batchVertices.size();
+		batchVertices.resize(oldSize + verticesCount);
+		for (int i = 0; i < verticesCount; i++)
+		{
+			batchVertices[oldSize + i] = packVertex(vertices[i]);
+		}
+	}
+
+	// Sets "textureIndex" attribute of the last given number of packed vertices in a list
+	static void setLastVerticesTextureIndex(std::vector<PackedVertex2D>& batchVertices, int verticesCount, int textureIndex)
+	{
+		for (size_t i = batchVertices.size() - verticesCount; i < batchVertices.size(); i++)
+		{
+			batchVertices[i].textureIndex = (unsigned char)(textureIndex);
+		}
+	}
+#else
+	// Adds given vertices to the end of a list of vertices
+	static void appendVertices(std::vector<Vertex2D>& batchVertices, const Vertex2D* vertices, int verticesCount)
+	{
+		batchVertices.insert(batchVertices.end(), vertices, vertices + verticesCount);
+	}
+
+	// Sets "textureIndex" attribute of the last given number of vertices in a list
+	static void setLastVerticesTextureIndex(std::vector<Vertex2D>& batchVertices, int verticesCount, int textureIndex)
+	{
+		for (size_t i = batchVertices.size() - verticesCount; i < batchVertices.size(); i++)
+		{
+			batchVertices[i].textureIndex = float(textureIndex);
+		}
+	}
+#endif
+
+#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
+	// Sets "shapeIndex" attribute of the last given number of vertices in a list,
+	// which is stored the same way in packed and in unpacked vertices
+	template <typename BatchVertex>
+	static void setLastVerticesShapeIndex(std::vector<BatchVertex>& batchVertices, int verticesCount, int shapeIndex)
+	{
+		for (size_t i = batchVertices.size() - verticesCount; i < batchVertices.size(); i++)
+		{
+			batchVertices[i].shapeIndex = float(shapeIndex);
+		}
+	}
+#endif
+
 	// Sets "uTextures" uniform inside a given shader
 	// to a list of texture slots { 0, 1, 2, 3, ... } or { 1, 2, 3, 4, ... }
 	// (depending on whether we are using a 1D texture which is bound on slot 0)
 	// with as many texture slots as is batch's capacity.
 	static void setTexturesUniform(Shader& shader, size_t capacityTextures)
 	{
-		std::vector<int> textures(capacityTextures);
+		FrameVector<int> textures(capacityTextures);
 		for (size_t i = 0; i < capacityTextures; i++)
 		{
 #if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
@@ -82,38 +245,74 @@ namespace Renderer2D
 		// Set batch's capacity for textures to be the maximum number of texture slots supported on current hardware.
 		m_capacityTextures = RenderState::getMaxTextureSlots();
 #endif
+#if PEKAN_USE_PACKED_2D_VERTICES
+		// Packed vertices hold texture index in 8 bits, where the largest value means no texture
+		m_capacityTextures = std::min(m_capacityTextures, int(PACKED_NO_TEXTURE_INDEX));
+#endif
 
 		// Create underlying render object with empty vertex data
 		m_renderObject.create
 		(
 			nullptr,
 			0,
+#if PEKAN_USE_PACKED_2D_VERTICES
+			{
+				{ ShaderDataType::Float2, "position" },
+				{ ShaderDataType::UnsignedShort2, "textureCoordinates", true },
+				{ ShaderDataType::UnsignedByte4, "textureInfo" },
 #if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
+				{ ShaderDataType::Float, "shapeIndex" },
+#else
+				{ ShaderDataType::UnsignedByte4, "color", true },
+#endif
+#if PEKAN_ENABLE_2D_ANALYTIC_EDGE_ANTI_ALIASING
+				{ ShaderDataType::UnsignedShort2, "edgeCoordinates", true },
+#endif
+#if PEKAN_ENABLE_2D_SDF_SHAPES
+				{ ShaderDataType::HalfFloat4, "sdfParameters" }
+#endif
+			},
+#elif PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
 			{
 				{ ShaderDataType::Float2, "position" },
 				{ ShaderDataType::Float2, "textureCoordinates" },
 				{ ShaderDataType::Float, "textureIndex" },
-				{ ShaderDataType::Float, "shapeIndex" }
+				{ ShaderDataType::Float, "shapeIndex" },
+#if PEKAN_ENABLE_2D_ANALYTIC_EDGE_ANTI_ALIASING
+				{ ShaderDataType::Float2, "edgeCoordinates" },
+#endif
+#if PEKAN_ENABLE_2D_SDF_SHAPES
+				{ ShaderDataType::Float4, "sdfParameters" }
+#endif
 			},
 #else
 			{
 				{ ShaderDataType::Float2, "position" },
 				{ ShaderDataType::Float2, "textureCoordinates" },
 				{ ShaderDataType::Float, "textureIndex" },
-				{ ShaderDataType::Float4, "color" }
+				{ ShaderDataType::Float4, "color" },
+#if PEKAN_ENABLE_2D_ANALYTIC_EDGE_ANTI_ALIASING
+				{ ShaderDataType::Float2, "edgeCoordinates" },
+#endif
+#if PEKAN_ENABLE_2D_SDF_SHAPES
+				{ ShaderDataType::Float4, "sdfParameters" }
+#endif
 			},
 #endif
 			BufferDataUsage::DynamicDraw,
 			FileUtils::readTextFileToString(VERTEX_SHADER_FILEPATH).c_str(),
 			FileUtils::readTextFileToString(FRAGMENT_SHADER_FILEPATH).c_str()
 		);
-		// and empty index data
-		// (we need to explicitly set empty index data because we are also setting data usage)
-		m_renderObject.setIndexData(nullptr, 0, BufferDataUsage::DynamicDraw);
+		// and index data containing only the shared quad indices.
+		// Indices of other primitives will be uploaded after them.
+		const std::vector<unsigned>& sharedQuadIndices = getSharedQuadIndices();
+		m_indexBufferCapacity = (long long)(sharedQuadIndices.size() * sizeof(unsigned));
+		m_renderObject.setIndexData(sharedQuadIndices.data(), m_indexBufferCapacity, BufferDataUsage::DynamicDraw);
 
 		// Set shader's view projection matrix uniform to a default view projection matrix
 		static const glm::mat4 defaultViewProjectionMatrix = glm::mat4(1.0f);
 		m_renderObject.getShader().setUniformMatrix4fv("uViewProjectionMatrix", defaultViewProjectionMatrix);
+		m_renderObject.getShader().setUniform1f("uDepth", m_depth);
 
 #if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
 		// Create underlying texture object with empty data
@@ -139,6 +338,8 @@ namespace Renderer2D
 #endif
 
 		clear();
+		clearIndexBlocks();
+		m_indexBufferCapacity = 0;
 
 		m_isValid = false;
 	}
@@ -148,43 +349,61 @@ namespace Renderer2D
 		PK_ASSERT(m_isValid, "Trying to add a shape to a RenderBatch2D that is not yet created.", "Pekan");
 
 		// Get shape's vertices
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-		const Vertex2D* vertices = shape.getVertices(float(m_colorsCount));
-#else
 		const Vertex2D* vertices = shape.getVertices();
-#endif
 		const int verticesCount = shape.getVerticesCount();
 		// Get shape's indices
 		const unsigned* zeroBasedIndices = shape.getIndices();
 		const int indicesCount = shape.getIndicesCount();
+		// Quads are drawn with the shared quad indices, and other shapes with an index block holding their indices,
+		// so only shapes with a new topology add indices to the batch
+		const bool isShapeQuad = isQuad(zeroBasedIndices, indicesCount);
+		const long long indexBlockFirstIndex = isShapeQuad ? -1 : findIndexBlock(zeroBasedIndices, indicesCount);
+		const int newIndicesCount = (isShapeQuad || indexBlockFirstIndex >= 0) ? 0 : indicesCount;
 #if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
 		// Get shape's color
 		glm::vec4 color = shape.getColor();
 #endif
 
+		// If shape is outside of culling bounds, skip it
+		if (isCulled(vertices, verticesCount))
+		{
+			if (m_stats != nullptr)
+			{
+				m_stats->shapesCulled++;
+			}
+			return true;
+		}
+
 		// If adding this shape would overflow the batch, don't add it
-		if (wouldShapeOverflowBatch(verticesCount, indicesCount))
+		if (wouldShapeOverflowBatch(verticesCount, newIndicesCount))
 		{
+			m_lastOverflowReason = getShapeOverflowReason(verticesCount, newIndicesCount);
 			return false;
 		}
 
 		const unsigned oldVerticesSize = unsigned(m_vertices.size());
-		const size_t oldIndicesSize = m_indices.size();
 
 		// Add shape's vertices to the batch
-		m_vertices.insert(m_vertices.end(), vertices, vertices + verticesCount);
+		appendVertices(m_vertices, vertices, verticesCount);
+#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
+		// Shape's index inside of the batch is the index of its color in the colors texture
+		setLastVerticesShapeIndex(m_vertices, verticesCount, m_colorsCount);
+#endif
 
-		// Add shape's indices to the batch,
-		// first making each index relative to where shape's vertices begin in the vertices list.
-		// Shape's indices are "zero based" meaning they are relative to 0, starting at 0.
-		// That's because internally shape's vertices also start at 0,
-		// but now that we added them to the vertices list they no longer start at 0.
-		// They start at however many vertices there were in the list before adding them,
-		// so that's why we add oldVerticesSize to each index.
-		m_indices.resize(m_indices.size() + indicesCount);
-		for (size_t i = oldIndicesSize; i < m_indices.size(); i++)
+		if (isShapeQuad)
+		{
+			// Quads don't need their own indices, they are drawn with the shared quad indices
+			addQuad(oldVerticesSize);
+		}
+		else
 		{
-			m_indices[i] = zeroBasedIndices[i - oldIndicesSize] + oldVerticesSize;
+			// Shape's indices are "zero based" meaning they are relative to 0, starting at 0,
+			// while shape's vertices start at however many vertices there were in the list before adding them,
+			// so shape's index block is drawn as a separate range with oldVerticesSize as a base vertex,
+			// and the GPU adds it to each index.
+			const unsigned firstIndex = (indexBlockFirstIndex >= 0) ? unsigned(indexBlockFirstIndex) : addIndexBlock(zeroBasedIndices, indicesCount);
+			addIndexRange(firstIndex, indicesCount, int(oldVerticesSize));
+			m_isLastRangeQuads = false;
 		}
 
 #if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
@@ -201,39 +420,54 @@ namespace Renderer2D
 	{
 		PK_ASSERT(m_isValid, "Trying to add a sprite to a RenderBatch2D that is not yet created.", "Pekan");
 
-		// If adding this sprite would overflow the batch, don't add it.
-		if (wouldSpriteOverflowBatch())
+		// Find sprite's texture among batch's textures, so that sprites with the same texture share a texture slot.
+		// Search starts from the last texture, because consecutive sprites often have the same texture.
+		const Texture2D_ConstPtr& texture = sprite.getTexture();
+		int textureIndex = -1;
+		for (int i = int(m_textures.size()) - 1; i >= 0; i--)
 		{
-			return false;
+			if (m_textures[i] == texture)
+			{
+				textureIndex = i;
+				break;
+			}
+		}
+		const bool isNewTexture = (textureIndex < 0);
+
+		// Get sprite's vertices
+		const Vertex2D* vertices = sprite.getVertices();
+
+		// If sprite is outside of culling bounds, skip it, without adding its texture
+		if (isCulled(vertices, 4))
+		{
+			if (m_stats != nullptr)
+			{
+				m_stats->spritesCulled++;
+			}
+			return true;
+		}
+
+		if (isNewTexture)
+		{
+			// If adding this sprite's texture would overflow the batch, don't add the sprite.
+			if (wouldSpriteOverflowBatch())
+			{
+				m_lastOverflowReason = BatchOverflowReason2D::TextureSlots;
+				return false;
+			}
+			// Add sprite's texture to the batch, after the last one
+			textureIndex = int(m_textures.size());
+			m_textures.push_back(texture);
 		}
 
 		const unsigned oldVerticesSize = unsigned(m_vertices.size());
-		const size_t oldIndicesSize = m_indices.size();
 
-		// Get sprite's vertices
-		const Vertex2D* vertices = sprite.getVertices(float(m_textures.size()));
 		// Add sprite's vertices to the batch
-		m_vertices.insert(m_vertices.end(), vertices, vertices + 4);
-
-		// Add sprites's indices { 0, 1, 2, 0, 2, 3 } to the batch,
-		// first making each index relative to where sprite's vertices begin in the vertices list.
-		// Sprite's indices are "zero based" meaning they are relative to 0, starting at 0.
-		// That's because internally sprite's vertices also start at 0,
-		// but now that we added them to the vertices list they no longer start at 0.
-		// They start at however many vertices there were in the list before adding them,
-		// so that's why we add oldVerticesSize to each index.
-		m_indices.resize(m_indices.size() + 6);
-		m_indices[oldIndicesSize + 0] = oldVerticesSize + 0;
-		m_indices[oldIndicesSize + 1] = oldVerticesSize + 1;
-		m_indices[oldIndicesSize + 2] = oldVerticesSize + 2;
-		m_indices[oldIndicesSize + 3] = oldVerticesSize + 0;
-		m_indices[oldIndicesSize + 4] = oldVerticesSize + 2;
-		m_indices[oldIndicesSize + 5] = oldVerticesSize + 3;
-
-		// Get sprite's textures
-		const Texture2D_ConstPtr& texture = sprite.getTexture();
-		// Add sprite's texture to the batch
-		m_textures.push_back(texture);
+		appendVertices(m_vertices, vertices, 4);
+		setLastVerticesTextureIndex(m_vertices, 4, textureIndex);
+
+		// Sprite is a quad, so it's drawn with the shared quad indices
+		addQuad(oldVerticesSize);
 
 		return true;
 	}
@@ -242,10 +476,37 @@ namespace Renderer2D
 	{
 		PK_ASSERT(m_isValid, "Trying to render a RenderBatch2D that is not yet created.", "Pekan");
 
+		// There is nothing to render in an empty batch
+		if (isEmpty())
+		{
+			return;
+		}
+
 		// Set underlying render object's vertex data and index data
 		// to the data of our vertices list and indices list
-		m_renderObject.setVertexData(m_vertices.data(), m_vertices.size() * sizeof(Vertex2D));
-		m_renderObject.setIndexData(m_indices.data(), m_indices.size() * sizeof(unsigned));
+		m_renderObject.setVertexData(m_vertices.data(), m_vertices.size() * sizeof(BatchVertex));
+		// Upload indices of index blocks added since last render after the already uploaded ones,
+		// growing the index buffer if they don't fit, in which case all indices need to be uploaded again.
+		const long long sharedQuadIndicesSize = (long long)(SHARED_QUAD_INDICES_COUNT * sizeof(unsigned));
+		const long long indexBlocksSize = (long long)(m_indexBlocksIndices.size() * sizeof(unsigned));
+		if (sharedQuadIndicesSize + indexBlocksSize > m_indexBufferCapacity)
+		{
+			m_indexBufferCapacity = std::max(sharedQuadIndicesSize + indexBlocksSize, 2 * m_indexBufferCapacity);
+			m_renderObject.setIndexData(nullptr, m_indexBufferCapacity);
+			m_renderObject.setIndexSubData(getSharedQuadIndices().data(), 0, sharedQuadIndicesSize);
+			m_uploadedIndexBlocksIndicesCount = 0;
+		}
+		const long long indicesUploadedCount = (long long)(m_indexBlocksIndices.size() - m_uploadedIndexBlocksIndicesCount);
+		if (indicesUploadedCount > 0)
+		{
+			m_renderObject.setIndexSubData
+			(
+				m_indexBlocksIndices.data() + m_uploadedIndexBlocksIndicesCount,
+				sharedQuadIndicesSize + (long long)(m_uploadedIndexBlocksIndicesCount * sizeof(unsigned)),
+				indicesUploadedCount * (long long)(sizeof(unsigned))
+			);
+			m_uploadedIndexBlocksIndicesCount = m_indexBlocksIndices.size();
+		}
 
 #if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
 		// Set the colors of the underlying colors texture to our list of colors
@@ -255,7 +516,13 @@ namespace Renderer2D
 #endif
 
 		Shader& shader = m_renderObject.getShader();
+		const long long uniformSetsCountBefore = shader.getUniformSetsCount();
 		setViewProjectionMatrixUniform(shader, camera);
+		shader.setUniform1f("uDepth", m_depth);
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+		shader.setUniform1i("uDebugVisualizationMode", int(m_debugVisualizationMode));
+		shader.setUniform3f("uDebugTint", m_debugTint);
+#endif
 #if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
 		// Set shader's "uColorsTexture" uniform to be 0, matching the slot where colors texture is bound.
 		shader.setUniform1i("uColorsTexture", 0);
@@ -276,9 +543,37 @@ namespace Renderer2D
 #endif
 		// Set the value of "uTextures" uniform inside the shader
 		setTexturesUniform(shader, size_t(m_capacityTextures));
+		const int uniformSetsCount = int(shader.getUniformSetsCount() - uniformSetsCountBefore);
 
-		// Render the underlying render object, drawing all triangles making up all primitives from the batch
-		m_renderObject.render();
+		// Render the underlying render object, drawing all triangles making up all primitives from the batch,
+		// with a single draw call drawing all ranges of indices
+		m_renderObject.renderIndexRanges
+		(
+			m_rangesFirstIndices.data(),
+			m_rangesIndicesCounts.data(),
+			m_rangesBaseVertices.data(),
+			unsigned(m_rangesFirstIndices.size())
+		);
+
+		if (m_stats != nullptr)
+		{
+			recordRenderStats(indicesUploadedCount, uniformSetsCount);
+		}
+	}
+
+	void RenderBatch2D::recordRenderStats(long long indicesUploadedCount, int uniformSetsCount) const
+	{
+		m_stats->drawCalls++;
+		m_stats->verticesUploaded += (long long)(m_vertices.size());
+		m_stats->indicesUploaded += indicesUploadedCount;
+		m_stats->bytesUploaded += (long long)(m_vertices.size() * sizeof(BatchVertex)) + indicesUploadedCount * (long long)(sizeof(unsigned));
+		m_stats->textureBinds += int(m_textures.size());
+		m_stats->uniformSets += uniformSetsCount;
+#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
+		m_stats->bytesUploaded += (long long)(m_colors.size() * sizeof(glm::vec4));
+		// Colors texture
+		m_stats->textureBinds += 1;
+#endif
 	}
 
 	void RenderBatch2D::clear()
@@ -286,22 +581,83 @@ namespace Renderer2D
 		PK_ASSERT(m_isValid, "Trying to clear a RenderBatch2D that is not yet created.", "Pekan");
 
 		m_vertices.clear();
-		m_indices.clear();
+		m_rangesFirstIndices.clear();
+		m_rangesIndicesCounts.clear();
+		m_rangesBaseVertices.clear();
+		m_isLastRangeQuads = false;
 		m_textures.clear();
 #if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
 		m_colors.clear();
 
 		m_colorsCount = 0;
 #endif
+
+		// Index blocks are kept for next batches, unless there are too many of them
+		if (m_indexBlocksIndices.size() > MAX_INDEX_BLOCKS_INDICES_COUNT)
+		{
+			clearIndexBlocks();
+		}
+	}
+
+	void RenderBatch2D::addQuad(unsigned firstVertex)
+	{
+		// Quads are added one after another, so if last range is a range of quads, this quad's vertices follow its vertices
+		if (m_isLastRangeQuads && m_rangesIndicesCounts.back() < SHARED_QUAD_INDICES_COUNT)
+		{
+			m_rangesIndicesCounts.back() += 6;
+			return;
+		}
+		addIndexRange(0, 6, int(firstVertex));
+		m_isLastRangeQuads = true;
+	}
+
+	void RenderBatch2D::addIndexRange(unsigned firstIndex, int indicesCount, int baseVertex)
+	{
+		m_rangesFirstIndices.push_back(firstIndex);
+		m_rangesIndicesCounts.push_back(indicesCount);
+		m_rangesBaseVertices.push_back(baseVertex);
+	}
+
+	long long RenderBatch2D::findIndexBlock(const unsigned* indices, int indicesCount) const
+	{
+		const auto it = m_indexBlocksFirstIndicesByCount.find(indicesCount);
+		if (it == m_indexBlocksFirstIndicesByCount.end())
+		{
+			return -1;
+		}
+		for (unsigned firstIndex : it->second)
+		{
+			const unsigned* indexBlockIndices = m_indexBlocksIndices.data() + (firstIndex - SHARED_QUAD_INDICES_COUNT);
+			if (std::equal(indices, indices + indicesCount, indexBlockIndices))
+			{
+				return (long long)(firstIndex);
+			}
+		}
+		return -1;
+	}
+
+	unsigned RenderBatch2D::addIndexBlock(const unsigned* indices, int indicesCount)
+	{
+		const unsigned firstIndex = unsigned(SHARED_QUAD_INDICES_COUNT + m_indexBlocksIndices.size());
+		m_indexBlocksIndices.insert(m_indexBlocksIndices.end(), indices, indices + indicesCount);
+		m_indexBlocksFirstIndicesByCount[indicesCount].push_back(firstIndex);
+		return firstIndex;
 	}
 
-	bool RenderBatch2D::wouldShapeOverflowBatch(int verticesCount, int indicesCount) const
+	void RenderBatch2D::clearIndexBlocks()
+	{
+		m_indexBlocksIndices.clear();
+		m_indexBlocksFirstIndicesByCount.clear();
+		m_uploadedIndexBlocksIndicesCount = 0;
+	}
+
+	bool RenderBatch2D::wouldShapeOverflowBatch(int verticesCount, int newIndicesCount) const
 	{
 #if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
 		return (m_colors.size() + 1 > m_capacityColors);
 #else
 		return (m_vertices.size() + verticesCount > CAPACITY_VERTICES
-			|| m_indices.size() + indicesCount > CAPACITY_INDICES);
+			|| m_indexBlocksIndices.size() + newIndicesCount > CAPACITY_INDICES);
 #endif
 	}
 
@@ -310,5 +666,58 @@ namespace Renderer2D
 		return (m_textures.size() + 1 > m_capacityTextures);
 	}
 
+	BatchOverflowReason2D RenderBatch2D::getShapeOverflowReason(int verticesCount, int newIndicesCount) const
+	{
+#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
+		return BatchOverflowReason2D::Colors;
+#else
+		if (m_vertices.size() + verticesCount > CAPACITY_VERTICES)
+		{
+			return BatchOverflowReason2D::Vertices;
+		}
+		return BatchOverflowReason2D::Indices;
+#endif
+	}
+
+	const char* getBatchOverflowReasonName(BatchOverflowReason2D reason)
+	{
+		switch (reason)
+		{
+			case BatchOverflowReason2D::None:            return "none";
+			case BatchOverflowReason2D::Vertices:        return "vertices";
+			case BatchOverflowReason2D::Indices:         return "indices";
+			case BatchOverflowReason2D::Colors:          return "colors";
+			case BatchOverflowReason2D::TextureSlots:    return "texture slots";
+		}
+		PK_ASSERT(false, "Unknown BatchOverflowReason2D, cannot determine its name.", "Pekan");
+		return "";
+	}
+
+	void RenderBatch2D::setCullingBounds(glm::vec2 boundsMin, glm::vec2 boundsMax)
+	{
+		m_cullingBoundsMin = boundsMin;
+		m_cullingBoundsMax = boundsMax;
+		m_isCullingEnabled = true;
+	}
+
+	bool RenderBatch2D::isCulled(const Vertex2D* vertices, int verticesCount) const
+	{
+		if (!m_isCullingEnabled || verticesCount <= 0)
+		{
+			return false;
+		}
+
+		// Find primitive's bounding box, and check if it doesn't overlap culling bounds
+		glm::vec2 verticesMin = vertices[0].position;
+		glm::vec2 verticesMax = vertices[0].position;
+		for (int i = 1; i < verticesCount; i++)
+		{
+			verticesMin = glm::min(verticesMin, vertices[i].position);
+			verticesMax = glm::max(verticesMax, vertices[i].position);
+		}
+		return (verticesMax.x < m_cullingBoundsMin.x || verticesMin.x > m_cullingBoundsMax.x
+			|| verticesMax.y < m_cullingBoundsMin.y || verticesMin.y > m_cullingBoundsMax.y);
+	}
+
 } // namespace Renderer2D
 } // namespace Pekan
\ No newline at end of file
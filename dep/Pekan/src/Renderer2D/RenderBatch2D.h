@@ -5,18 +5,46 @@
 #include "RenderObject.h"
 #include "Camera2D.h"
 #include "Texture2D.h"
+#include "RenderStats2D.h"
 
 #if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
 #include "Texture1D.h"
 #endif
 
 #include <vector>
+#include <unordered_map>
 
 namespace Pekan
 {
 namespace Renderer2D
 {
 
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+	// Enum for different ways of visualizing how 2D primitives are rendered, for debugging
+	enum class DebugVisualizationMode2D
+	{
+		// Primitives are rendered normally
+		None = 0,
+		// Each pixel is colored by how many fragments were drawn in it, from black (none), through blue, green, yellow and red, to white (10 or more)
+		Overdraw = 1,
+		// Primitives are tinted with a different color for each draw call of the batch
+		BatchIds = 2
+	};
+#endif
+
+	// Enum for different reasons why a batch can be full
+	enum class BatchOverflowReason2D
+	{
+		None = 0,
+		Vertices,
+		Indices,
+		Colors,
+		TextureSlots
+	};
+
+	// Returns a human-readable name of a given batch overflow reason
+	const char* getBatchOverflowReasonName(BatchOverflowReason2D reason);
+
 	// A batch of 2D primitives.
 	// Allows you to render many primitives at once in a single draw call.
 	class RenderBatch2D
@@ -28,12 +56,12 @@ namespace Renderer2D
 		void destroy();
 
 		// Adds a shape to the batch.
-		// Returns true, if shape was successfully added to the batch.
+		// Returns true, if shape was successfully added to the batch, or culled.
 		// If false is returned, it means that the shape was NOT added to the batch because it would overflow the batch.
 		// In such case the batch needs to be rendered, cleared and the shape can be added to the next batch.
 		bool addShape(const Shape& shape);
 		// Adds a sprite to the batch.
-		// Returns true, if sprite was successfully added to the batch.
+		// Returns true, if sprite was successfully added to the batch, or culled.
 		// If false is returned, it means that the sprite was NOT added to the batch because it would overflow the batch.
 		// In such case the batch needs to be rendered, cleared and the sprite can be added to the next batch.
 		bool addSprite(const Sprite& sprite);
@@ -46,20 +74,98 @@ namespace Renderer2D
 		// Clears batch, removing all primitives, leaving it empty
 		void clear();
 
+		// Checks if batch is empty, meaning that it has no primitives
+		bool isEmpty() const { return m_rangesFirstIndices.empty(); }
+
+		// Sets the depth, in normalized device coordinates (-1 to 1), at which all primitives of the batch are rendered.
+		// Depth is kept when batch is cleared. Default depth is 0.
+		//
+		// NOTE: Depth only matters if depth testing is enabled. It allows a renderer to draw opaque primitives front-to-back,
+		//       so that fragments hidden behind them are rejected by the depth test, before the fragment shader is run.
+		void setDepth(float depth) { m_depth = depth; }
+		float getDepth() const { return m_depth; }
+
+		// Enables culling, so that primitives completely outside of given bounds, in world space, are skipped when they are added.
+		// Culling is disabled by default.
+		void setCullingBounds(glm::vec2 boundsMin, glm::vec2 boundsMax);
+		void disableCulling() { m_isCullingEnabled = false; }
+
+		// Sets stats that batch records its work into, or nullptr if batch's work shouldn't be recorded
+		void setStats(RenderStats2D* stats) { m_stats = stats; }
+
+		// Returns the reason why the last primitive, that couldn't be added to the batch, would overflow the batch
+		BatchOverflowReason2D getLastOverflowReason() const { return m_lastOverflowReason; }
+
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+		// Sets the debug visualization mode that batch is rendered with
+		void setDebugVisualizationMode(DebugVisualizationMode2D mode) { m_debugVisualizationMode = mode; }
+		// Sets the color that batch's primitives are tinted with, when visualizing batch IDs
+		void setDebugTint(glm::vec3 tint) { m_debugTint = tint; }
+#endif
+
 	private: /* functions */
 
-		// Checks if adding a shape with given vertices count and indices count would overflow the batch
-		bool wouldShapeOverflowBatch(int verticesCount, int indicesCount) const;
-		// Checks if adding a sprite would overflow the batch
+		// Adds a quad, whose 4 vertices start at a given vertex, to the last range of quads,
+		// or starts a new range of quads if last range is not a range of quads or it's full.
+		void addQuad(unsigned firstVertex);
+		// Adds a range of indices, drawn with a given base vertex added to each index
+		void addIndexRange(unsigned firstIndex, int indicesCount, int baseVertex);
+
+		// Returns the first index of the index block holding given indices, or -1 if there is no such index block yet
+		long long findIndexBlock(const unsigned* indices, int indicesCount) const;
+		// Adds an index block holding given indices, to be uploaded on next render, and returns its first index
+		unsigned addIndexBlock(const unsigned* indices, int indicesCount);
+		// Removes all index blocks
+		void clearIndexBlocks();
+
+		// Checks if adding a shape with given vertices count, that adds a given number of new indices, would overflow the batch
+		bool wouldShapeOverflowBatch(int verticesCount, int newIndicesCount) const;
+		// Checks if adding a sprite with a texture that is not yet in the batch would overflow the batch
 		bool wouldSpriteOverflowBatch() const;
+		// Returns which capacity of the batch would be overflown by adding a shape with given vertices count,
+		// that adds a given number of new indices
+		BatchOverflowReason2D getShapeOverflowReason(int verticesCount, int newIndicesCount) const;
+
+		// Checks if a primitive with given vertices is completely outside of culling bounds, if culling is enabled
+		bool isCulled(const Vertex2D* vertices, int verticesCount) const;
+
+		// Records the work done by a single call to render(), that uploaded a given number of indices
+		// and set a given number of uniforms, into batch's stats
+		void recordRenderStats(long long indicesUploadedCount, int uniformSetsCount) const;
 
 	private: /* variables */
 
+#if PEKAN_USE_PACKED_2D_VERTICES
+		using BatchVertex = PackedVertex2D;
+#else
+		using BatchVertex = Vertex2D;
+#endif
+
 		// Vertices of all primitives in the batch
-		std::vector<Vertex2D> m_vertices;
-		// Indices of all primitives in the batch
-		std::vector<unsigned> m_indices;
-		// Textures of all primitives in the batch
+		std::vector<BatchVertex> m_vertices;
+		// Indices of all index blocks, in the order they are kept in the index buffer, after the shared quad indices.
+		// Each primitive that is not a quad is drawn as a separate range of indices, with its first vertex as a base vertex,
+		// so its indices are kept zero based, as primitives give them. That way primitives with the same topology,
+		// for example circles with the same number of segments, are drawn with the same index block,
+		// which is uploaded only once and persists when batch is cleared, until index blocks hold too many indices.
+		std::vector<unsigned> m_indexBlocksIndices;
+		// First indices of index blocks, grouped by their indices count
+		std::unordered_map<int, std::vector<unsigned>> m_indexBlocksFirstIndicesByCount;
+		// Number of indices, from the beginning of m_indexBlocksIndices, that are already uploaded to the index buffer
+		size_t m_uploadedIndexBlocksIndicesCount = 0;
+
+		// Ranges of indices to be drawn, each one with a base vertex added to its indices.
+		// Consecutive quads are drawn as a single range of the shared quad indices.
+		std::vector<unsigned> m_rangesFirstIndices;
+		std::vector<int> m_rangesIndicesCounts;
+		std::vector<int> m_rangesBaseVertices;
+		// Flag indicating if last range is a range of quads, so that the next quad can be added to it
+		bool m_isLastRangeQuads = false;
+
+		// Size of the underlying index buffer, in bytes.
+		// Index buffer grows when indices don't fit into it, and never shrinks.
+		long long m_indexBufferCapacity = 0;
+		// Textures of all primitives in the batch, each one only once
 		std::vector<Graphics::Texture2D_ConstPtr> m_textures;
 #if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
 		// Colors of all primitives in the batch
@@ -83,6 +189,25 @@ namespace Renderer2D
 		int m_colorsCount = 0;
 #endif
 
+		// Depth at which all primitives of the batch are rendered, in normalized device coordinates
+		float m_depth = 0.0f;
+
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+		DebugVisualizationMode2D m_debugVisualizationMode = DebugVisualizationMode2D::None;
+		glm::vec3 m_debugTint = glm::vec3(1.0f, 1.0f, 1.0f);
+#endif
+
+		// Reason why the last primitive, that couldn't be added to the batch, would overflow the batch
+		BatchOverflowReason2D m_lastOverflowReason = BatchOverflowReason2D::None;
+
+		// Bounds, in world space, outside of which primitives are culled, if culling is enabled
+		glm::vec2 m_cullingBoundsMin = { 0.0f, 0.0f };
+		glm::vec2 m_cullingBoundsMax = { 0.0f, 0.0f };
+		bool m_isCullingEnabled = false;
+
+		// Stats that batch records its work into, or nullptr if batch's work isn't recorded
+		RenderStats2D* m_stats = nullptr;
+
 		// Flag indicating if shapes batch is valid, meaning that it has been created and not yet destroyed
 		bool m_isValid = false;
 	};
@@ -0,0 +1,128 @@
+#include "RenderQueue2D.h"
+
+#include "PekanLogger.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace Pekan
+{
+namespace Renderer2D
+{
+
+	// Number of bytes in a sort key, each one sorted in a separate pass of the radix sort
+	static constexpr int SORT_KEY_BYTES_COUNT = 8;
+
+	// Position of each part of a sort key
+	static constexpr int SORT_KEY_LAYER_SHIFT = 48;
+	static constexpr int SORT_KEY_TRANSLUCENCY_SHIFT = 47;
+	static constexpr int SORT_KEY_TEXTURE_SHIFT = 32;
+
+	// Number of different values of the texture part of a sort key
+	static constexpr unsigned SORT_KEY_TEXTURES_COUNT = 0x7FFF;
+
+	// Makes a sort key from given parts
+	static unsigned long long makeSortKey(int layer, bool isTranslucent, unsigned textureKey, size_t submissionIndex)
+	{
+		PK_ASSERT_QUICK(layer >= -32768 && layer <= 32767);
+
+		// Offset layer, so that negative layers come before positive ones
+		const unsigned long long layerKey = (unsigned long long)(std::min(std::max(layer + 32768, 0), 0xFFFF));
+		return (layerKey << SORT_KEY_LAYER_SHIFT)
+			| ((isTranslucent ? 1ull : 0ull) << SORT_KEY_TRANSLUCENCY_SHIFT)
+			| ((unsigned long long)(textureKey) << SORT_KEY_TEXTURE_SHIFT)
+			| (unsigned long long)(submissionIndex & 0xFFFFFFFF);
+	}
+
+	void RenderQueue2D::addShape(const Shape& shape)
+	{
+		// Shapes have no texture, so opaque shapes have a texture key of 0, grouping them before opaque sprites
+		const bool isTranslucent = !shape.isOpaque();
+		Item item;
+		item.sortKey = makeSortKey(shape.getLayer(), isTranslucent, 0, m_items.size());
+		item.shape = &shape;
+		m_items.push_back(item);
+	}
+
+	void RenderQueue2D::addSprite(const Sprite& sprite)
+	{
+		// Only opaque sprites are grouped by texture,
+		// so a translucent sprite's texture key is 0, leaving it in the order it was submitted in.
+		// Texture key of opaque sprites is made from texture's address, and it's never 0.
+		// Different textures can have the same texture key, in which case they are just not grouped perfectly.
+		const bool isTranslucent = !sprite.isOpaque();
+		unsigned textureKey = 0;
+		if (!isTranslucent)
+		{
+			const uintptr_t textureAddress = reinterpret_cast<uintptr_t>(sprite.getTexture().get());
+			textureKey = 1 + unsigned((textureAddress >> 4) % (SORT_KEY_TEXTURES_COUNT - 1));
+		}
+
+		Item item;
+		item.sortKey = makeSortKey(sprite.getLayer(), isTranslucent, textureKey, m_items.size());
+		item.sprite = &sprite;
+		m_items.push_back(item);
+	}
+
+	void RenderQueue2D::sort()
+	{
+		const size_t itemsCount = m_items.size();
+		if (itemsCount < 2)
+		{
+			return;
+		}
+		m_sortBuffer.resize(itemsCount);
+
+		// Count how many times each value of each byte appears in the sort keys, for all bytes in a single pass
+		size_t counts[SORT_KEY_BYTES_COUNT][256] = {};
+		for (const Item& item : m_items)
+		{
+			for (int i = 0; i < SORT_KEY_BYTES_COUNT; i++)
+			{
+				counts[i][(item.sortKey >> (8 * i)) & 0xFF]++;
+			}
+		}
+
+		// Sort items by each byte of their sort keys, starting from the least significant byte.
+		// Each pass is stable, so after the last pass items are sorted by whole sort keys.
+		std::vector<Item>* source = &m_items;
+		std::vector<Item>* destination = &m_sortBuffer;
+		for (int i = 0; i < SORT_KEY_BYTES_COUNT; i++)
+		{
+			const int shift = 8 * i;
+			// Skip bytes that are the same in all sort keys, because sorting by them wouldn't change the order.
+			// Usually most of the bytes of layer and texture are.
+			if (counts[i][(source->front().sortKey >> shift) & 0xFF] == itemsCount)
+			{
+				continue;
+			}
+
+			// Find where items with each value of current byte begin in the destination
+			size_t offsets[256];
+			size_t offset = 0;
+			for (int value = 0; value < 256; value++)
+			{
+				offsets[value] = offset;
+				offset += counts[i][value];
+			}
+			for (const Item& item : *source)
+			{
+				(*destination)[offsets[(item.sortKey >> shift) & 0xFF]++] = item;
+			}
+			std::swap(source, destination);
+		}
+
+		// If sorted items ended up in the sort buffer, swap it with items list
+		if (source != &m_items)
+		{
+			m_items.swap(m_sortBuffer);
+		}
+	}
+
+	void RenderQueue2D::clear()
+	{
+		m_items.clear();
+	}
+
+} // namespace Renderer2D
+} // namespace Pekan
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Shape.h"
+#include "Sprite.h"
+
+#include <vector>
+
+namespace Pekan
+{
+namespace Renderer2D
+{
+
+	// A queue of 2D primitives submitted for rendering, that can be sorted so that they are batched with as few draw calls as possible.
+	//
+	// Each primitive gets a 64-bit sort key, made of, from the most significant bits to the least significant:
+	// - layer (16 bits) - primitives in lower layers are drawn first
+	// - translucency (1 bit) - in each layer, opaque primitives are drawn first, then translucent ones
+	// - texture (15 bits) - opaque primitives in the same layer are grouped by texture, translucent ones are not
+	// - submission order (32 bits) - everything else being equal, primitives are drawn in the order they are submitted
+	// so translucent primitives are always drawn back-to-front in their layer.
+	//
+	// NOTE: Primitives are kept as pointers, so they must not be changed or destroyed until the queue is cleared.
+	class RenderQueue2D
+	{
+	public:
+
+		// An item of the queue, holding either a shape or a sprite
+		struct Item
+		{
+			unsigned long long sortKey = 0;
+			const Shape* shape = nullptr;
+			const Sprite* sprite = nullptr;
+
+			// Returns the layer that item's primitive is in
+			int getLayer() const { return int(sortKey >> 48) - 32768; }
+			// Checks if item's primitive is translucent
+			bool isTranslucent() const { return ((sortKey >> 47) & 1ull) != 0; }
+		};
+
+		// Adds a shape to the end of the queue
+		void addShape(const Shape& shape);
+		// Adds a sprite to the end of the queue
+		void addSprite(const Sprite& sprite);
+
+		// Sorts queue's items by their sort keys, using a radix sort
+		void sort();
+
+		// Removes all items from the queue
+		void clear();
+
+		const std::vector<Item>& getItems() const { return m_items; }
+
+		bool isEmpty() const { return m_items.empty(); }
+
+	private: /* variables */
+
+		std::vector<Item> m_items;
+		// A buffer of the same size as items list, used while sorting.
+		// Kept between frames, so that its memory is reused.
+		std::vector<Item> m_sortBuffer;
+	};
+
+} // namespace Renderer2D
+} // namespace Pekan
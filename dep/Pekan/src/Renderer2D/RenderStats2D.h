@@ -0,0 +1,52 @@
+#pragma once
+
+namespace Pekan
+{
+namespace Renderer2D
+{
+
+	// Counters of the work that Renderer2D does in a frame.
+	// Can be used for setting and tracking budgets, for example a maximum number of draw calls in a level.
+	struct RenderStats2D
+	{
+		// Number of draw calls made by the 2D batch
+		int drawCalls = 0;
+
+		// Number of times the batch was rendered early, because it ran out of each of its capacities
+		int flushesOutOfVertices = 0;
+		int flushesOutOfIndices = 0;
+		int flushesOutOfColors = 0;
+		int flushesOutOfTextureSlots = 0;
+		// Number of times the batch was rendered because render state changed, for example when the opaque depth pass moved on to another layer
+		int flushesForStateChanges = 0;
+		// Number of times the batch was rendered at the end of a frame
+		int flushesAtEndOfFrame = 0;
+
+		// Number of vertices and indices uploaded to the GPU by the batch
+		long long verticesUploaded = 0;
+		long long indicesUploaded = 0;
+		// Number of bytes uploaded to the GPU by the batch, including vertices, indices and colors
+		long long bytesUploaded = 0;
+
+		// Number of textures bound by the batch
+		int textureBinds = 0;
+		// Number of uniforms set by the batch
+		int uniformSets = 0;
+
+		// Number of shapes and sprites submitted for rendering
+		int shapesSubmitted = 0;
+		int spritesSubmitted = 0;
+		// Number of submitted shapes and sprites that were culled, because they were outside of camera's view
+		int shapesCulled = 0;
+		int spritesCulled = 0;
+
+		// Number of full-screen passes rendered by the PostProcessor
+		int postProcessPasses = 0;
+
+		// Overdraw measured a few frames earlier, see Renderer2DSystem::getOverdraw(),
+		// or a negative value if overdraw measuring is not enabled
+		float overdraw = -1.0f;
+	};
+
+} // namespace Renderer2D
+} // namespace Pekan
\ No newline at end of file
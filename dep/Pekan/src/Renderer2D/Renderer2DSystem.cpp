@@ -3,7 +3,12 @@
 #include "PekanLogger.h"
 #include "SubsystemManager.h"
 #include "GraphicsSystem.h"
+#include "PostProcessor.h"
 #include "ShaderPreprocessor.h"
+#include "PekanEngine.h"
+#include "Utils/FileUtils.h"
+
+#include <cmath>
 
 using namespace Pekan::Graphics;
 
@@ -13,16 +18,55 @@ namespace Renderer2D
 {
 
 	// A list of .pkshad files that need to be preprocessed when Renderer2D is initialized
-	static const size_t PKSHAD_FILES_COUNT = 2;
+	static const size_t PKSHAD_FILES_COUNT = 4;
 	static const char* PKSHAD_FILES[PKSHAD_FILES_COUNT] =
 	{
 		PEKAN_RENDERER2D_ROOT_DIR "/Shaders/2D_Batch_1DTexture_FragmentShader.pkshad",
-		PEKAN_RENDERER2D_ROOT_DIR "/Shaders/2D_Batch_FragmentShader.pkshad"
+		PEKAN_RENDERER2D_ROOT_DIR "/Shaders/2D_Batch_FragmentShader.pkshad",
+		PEKAN_RENDERER2D_ROOT_DIR "/Shaders/2D_Batch_1DTexture_VertexShader.pkshad",
+		PEKAN_RENDERER2D_ROOT_DIR "/Shaders/2D_Batch_VertexShader.pkshad"
+	};
+
+	// Number of layers in each direction from layer 0, used for mapping layers to depth
+	static constexpr float LAYERS_RANGE = 32768.0f;
+
+	// Default maximum distance, in pixels, between a curved shape and its approximation with straight segments
+	static constexpr float DEFAULT_LEVEL_OF_DETAIL_TOLERANCE = 0.5f;
+
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+	#define DEBUG_OVERDRAW_VERTEX_SHADER_FILEPATH PEKAN_RENDERER2D_ROOT_DIR "/Shaders/2D_DebugOverdraw_VertexShader.glsl"
+	#define DEBUG_OVERDRAW_FRAGMENT_SHADER_FILEPATH PEKAN_RENDERER2D_ROOT_DIR "/Shaders/2D_DebugOverdraw_FragmentShader.glsl"
+
+	// Vertices of a rectangle covering the whole viewport, used for drawing the overdraw heatmap
+	static constexpr float VIEWPORT_RECTANGLE_VERTICES[] =
+	{
+		// position     // texture coordinate
+		-1.0f, -1.0f,    0.0f, 0.0f,
+		1.0f, -1.0f,     1.0f, 0.0f,
+		1.0f, 1.0f,      1.0f, 1.0f,
+		-1.0f, 1.0f,     0.0f, 1.0f
 	};
+	// Indices of a rectangle covering the whole viewport
+	static constexpr unsigned VIEWPORT_RECTANGLE_INDICES[] = { 0, 1, 2, 0, 2, 3 };
+
+	// Returns a color for the batch rendered a given number of times before in current frame,
+	// so that consecutive batches have very different colors
+	static glm::vec3 getBatchIdColor(int batchIndex);
+#endif
 
 	// Preprocesses all .pkshad files needed by Renderer2D
 	static void preprocessPkshadFiles();
 
+	// Returns the number of pixels that a unit of world space covers on screen, with a given camera
+	static float getPixelsPerWorldUnit(const Camera2D_ConstPtr& camera);
+
+	// Returns the bounds, in world space, of what a given camera sees
+	static void getVisibleBounds(const Camera2D_ConstPtr& camera, glm::vec2& boundsMin, glm::vec2& boundsMax);
+
+	// Returns the depth, in normalized device coordinates, at which primitives of a given layer are drawn.
+	// Higher layers are closer to the camera.
+	static float getLayerDepth(int layer);
+
 	static Renderer2DSystem g_renderer2DSystem;
 	
 	void Renderer2DSystem::registerSubsystem()
@@ -32,16 +76,101 @@ namespace Renderer2D
 
 	Camera2D_ConstWeakPtr Renderer2DSystem::s_camera;
 	RenderBatch2D Renderer2DSystem::s_batch;
+	RenderQueue2D Renderer2DSystem::s_queue;
+	bool Renderer2DSystem::s_isSortingEnabled = false;
+	bool Renderer2DSystem::s_isOpaqueDepthPassEnabled = false;
+	SamplesCounter Renderer2DSystem::s_samplesCounter;
+	bool Renderer2DSystem::s_isOverdrawMeasuringEnabled = false;
+	bool Renderer2DSystem::s_isSamplesCounterCounting = false;
+	RenderStats2D Renderer2DSystem::s_stats;
+	RenderStats2D Renderer2DSystem::s_lastFrameStats;
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+	DebugVisualizationMode2D Renderer2DSystem::s_debugVisualizationMode = DebugVisualizationMode2D::None;
+	bool Renderer2DSystem::s_isFlushReasonsLoggingEnabled = false;
+	int Renderer2DSystem::s_debugBatchesCount = 0;
+	FrameBuffer Renderer2DSystem::s_overdrawFrameBuffer;
+	RenderObject Renderer2DSystem::s_overdrawRenderObject;
+	bool Renderer2DSystem::s_isOverdrawFrameBufferBound = false;
+	unsigned Renderer2DSystem::s_previousFrameBufferId = 0;
+	glm::ivec4 Renderer2DSystem::s_previousViewport = { 0, 0, 0, 0 };
+	bool Renderer2DSystem::s_previousIsEnabledBlending = false;
+	BlendFactor Renderer2DSystem::s_previousBlendSourceFactor = BlendFactor::One;
+	BlendFactor Renderer2DSystem::s_previousBlendDestinationFactor = BlendFactor::Zero;
+#endif
+	float Renderer2DSystem::s_levelOfDetailTolerance = DEFAULT_LEVEL_OF_DETAIL_TOLERANCE;
+	float Renderer2DSystem::s_pixelsPerWorldUnit = 1.0f;
 
 	void Renderer2DSystem::beginFrame()
 	{
+		// PostProcessor's passes of the last frame are rendered after its 2D rendering, so they are only known now
+		s_stats.postProcessPasses = PostProcessor::getLastFramePassesCount();
+		s_stats.overdraw = s_isOverdrawMeasuringEnabled ? getOverdraw() : -1.0f;
+		s_lastFrameStats = s_stats;
+		s_stats = RenderStats2D();
+
 		s_batch.clear();
+		s_queue.clear();
+
+		Camera2D_ConstPtr camera = s_camera.lock();
+		s_pixelsPerWorldUnit = getPixelsPerWorldUnit(camera);
+		glm::vec2 visibleBoundsMin;
+		glm::vec2 visibleBoundsMax;
+		getVisibleBounds(camera, visibleBoundsMin, visibleBoundsMax);
+		s_batch.setCullingBounds(visibleBoundsMin, visibleBoundsMax);
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+		s_debugBatchesCount = 0;
+#endif
+
+		if (s_isOverdrawMeasuringEnabled)
+		{
+			// Count samples relative to the target being drawn to, which can have a scaled resolution and multiple samples per pixel
+			const glm::ivec4 viewport = RenderState::getViewport();
+			const int samplesPerPixel = RenderState::getBoundFrameBufferSamplesPerPixel();
+			s_samplesCounter.begin((long long)(viewport.z) * (long long)(viewport.w) * (long long)(samplesPerPixel));
+			s_isSamplesCounterCounting = true;
+		}
 	}
 
 	void Renderer2DSystem::endFrame()
 	{
-		Camera2D_ConstPtr camera = s_camera.lock();
-		s_batch.render(camera);
+		if (!s_queue.isEmpty())
+		{
+			s_queue.sort();
+			if (s_isOpaqueDepthPassEnabled)
+			{
+				renderQueueWithOpaqueDepthPass();
+			}
+			else
+			{
+				renderQueue();
+			}
+			s_queue.clear();
+		}
+
+		flushBatch(FlushCause::EndOfFrame);
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+		if (s_isOverdrawFrameBufferBound)
+		{
+			endOverdrawVisualization();
+		}
+#endif
+
+		if (s_isSamplesCounterCounting)
+		{
+			s_samplesCounter.end();
+			s_isSamplesCounterCounting = false;
+		}
+	}
+
+	float Renderer2DSystem::getOverdraw()
+	{
+		const long long samplesCount = s_samplesCounter.getSamplesCount();
+		const long long targetSamplesCount = s_samplesCounter.getTargetSamplesCount();
+		if (samplesCount < 0 || targetSamplesCount <= 0)
+		{
+			return -1.0f;
+		}
+		return float(double(samplesCount) / double(targetSamplesCount));
 	}
 
 	glm::vec2 Renderer2DSystem::getMousePosition()
@@ -61,16 +190,45 @@ namespace Renderer2D
 		return mousePosWorld;
 	}
 
+	void Renderer2DSystem::setLevelOfDetailTolerance(float tolerance)
+	{
+		PK_ASSERT(tolerance > 0.0f, "Level of detail tolerance must be greater than 0.", "Pekan");
+		s_levelOfDetailTolerance = tolerance;
+	}
+
 	bool Renderer2DSystem::init()
 	{
 		preprocessPkshadFiles();
 		s_batch.create();
+		s_batch.setStats(&s_stats);
+		s_samplesCounter.create();
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+		s_overdrawRenderObject.create
+		(
+			VIEWPORT_RECTANGLE_VERTICES, sizeof(VIEWPORT_RECTANGLE_VERTICES),
+			{ { ShaderDataType::Float2, "position" }, { ShaderDataType::Float2, "textureCoordinates"} },
+			BufferDataUsage::StaticDraw,
+			FileUtils::readTextFileToString(DEBUG_OVERDRAW_VERTEX_SHADER_FILEPATH).c_str(),
+			FileUtils::readTextFileToString(DEBUG_OVERDRAW_FRAGMENT_SHADER_FILEPATH).c_str()
+		);
+		s_overdrawRenderObject.setIndexData(VIEWPORT_RECTANGLE_INDICES, sizeof(VIEWPORT_RECTANGLE_INDICES));
+		// Overdraw target's texture is always bound to slot 0
+		s_overdrawRenderObject.getShader().setUniform1i("uOverdrawTexture", 0);
+#endif
 
 		return true;
 	}
 
 	void Renderer2DSystem::exit()
 	{
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+		s_overdrawRenderObject.destroy();
+		if (s_overdrawFrameBuffer.isValid())
+		{
+			s_overdrawFrameBuffer.destroy();
+		}
+#endif
+		s_samplesCounter.destroy();
 		s_batch.destroy();
 	}
 
@@ -80,15 +238,45 @@ namespace Renderer2D
 	}
 
 	void Renderer2DSystem::submitForRendering(const Shape& shape)
+	{
+		// Let shape pick how detailed it needs to be at its current size on screen
+		shape.selectLevelOfDetail(s_pixelsPerWorldUnit, s_levelOfDetailTolerance);
+		s_stats.shapesSubmitted++;
+
+		if (s_isSortingEnabled || s_isOpaqueDepthPassEnabled)
+		{
+			s_queue.addShape(shape);
+		}
+		else
+		{
+			addShapeToBatch(shape);
+		}
+	}
+
+	void Renderer2DSystem::submitForRendering(const Sprite& sprite)
+	{
+		s_stats.spritesSubmitted++;
+		if (s_isSortingEnabled || s_isOpaqueDepthPassEnabled)
+		{
+			s_queue.addSprite(sprite);
+		}
+		else
+		{
+			addSpriteToBatch(sprite);
+		}
+	}
+
+	void Renderer2DSystem::addShapeToBatch(const Shape& shape)
 	{
 		// Add shape to batch.
 		// If it couldn't be added, this means that the batch is full,
 		if (!s_batch.addShape(shape))
 		{
-			Camera2D_ConstPtr camera = s_camera.lock();
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+			logFlushReason();
+#endif
 			// so we can render the batch and clear it, effectively starting a new one.
-			s_batch.render(camera);
-			s_batch.clear();
+			flushBatch(FlushCause::OutOfCapacity);
 			// Finally we need to add the shape to the new batch.
 			// If it couldn't be added again, to a fresh new batch, something is definitely wrong.
 			if (!s_batch.addShape(shape))
@@ -98,16 +286,17 @@ namespace Renderer2D
 		}
 	}
 
-	void Renderer2DSystem::submitForRendering(const Sprite& sprite)
+	void Renderer2DSystem::addSpriteToBatch(const Sprite& sprite)
 	{
 		// Add sprite to batch.
 		// If it couldn't be added, this means that the batch is full,
 		if (!s_batch.addSprite(sprite))
 		{
-			Camera2D_ConstPtr camera = s_camera.lock();
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+			logFlushReason();
+#endif
 			// so we can render the batch and clear it, effectively starting a new one.
-			s_batch.render(camera);
-			s_batch.clear();
+			flushBatch(FlushCause::OutOfCapacity);
 			// Finally we need to add the sprite to the new batch.
 			// If it couldn't be added again, to a fresh new batch, something is definitely wrong.
 			if (!s_batch.addSprite(sprite))
@@ -117,19 +306,332 @@ namespace Renderer2D
 		}
 	}
 
+	void Renderer2DSystem::renderQueue()
+	{
+		for (const RenderQueue2D::Item& item : s_queue.getItems())
+		{
+			addItemToBatch(item);
+		}
+	}
+
+	void Renderer2DSystem::renderQueueWithOpaqueDepthPass()
+	{
+		const std::vector<RenderQueue2D::Item>& items = s_queue.getItems();
+
+		// Render what's already in the batch, at the default depth, before changing render state
+		flushBatch(FlushCause::StateChange);
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+		// Depth buffer is about to be cleared, so overdraw target needs to be bound before that
+		beginOverdrawVisualization();
+#endif
+
+		// Remember render state, so that it can be restored after the depth pass
+		const bool wasEnabledDepthTest = RenderState::isEnabledDepthTest();
+		const bool wasEnabledBlending = RenderState::isEnabledBlending();
+
+		RenderCommands::clear(false, true);
+		RenderState::enableDepthTest();
+		RenderState::setDepthFunction(DepthFunction::LessOrEqual);
+
+		// Opaque pass: draw opaque primitives layer by layer, from the highest layer to the lowest,
+		// so that closer primitives write depth first, rejecting fragments of farther ones behind them.
+		// Inside of a layer primitives are drawn in sorted order, because they all have the same depth.
+		RenderState::enableDepthWriting();
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+		// When visualizing overdraw, blending is needed for counting fragments
+		if (!s_isOverdrawFrameBufferBound)
+		{
+			RenderState::disableBlending();
+		}
+#else
+		RenderState::disableBlending();
+#endif
+		size_t layerEnd = items.size();
+		while (layerEnd > 0)
+		{
+			const int layer = items[layerEnd - 1].getLayer();
+			size_t layerBegin = layerEnd - 1;
+			while (layerBegin > 0 && items[layerBegin - 1].getLayer() == layer)
+			{
+				layerBegin--;
+			}
+
+			flushBatchAtLayer(layer);
+			for (size_t i = layerBegin; i < layerEnd; i++)
+			{
+				if (!items[i].isTranslucent())
+				{
+					addItemToBatch(items[i]);
+				}
+			}
+			layerEnd = layerBegin;
+		}
+
+		// Translucent pass: draw translucent primitives back-to-front, in sorted order,
+		// testing them against depth of opaque primitives, but not writing depth, so that they blend with each other.
+		flushBatchAtLayer(items.front().getLayer());
+		RenderState::disableDepthWriting();
+		if (wasEnabledBlending)
+		{
+			RenderState::enableBlending();
+		}
+		int currentLayer = items.front().getLayer();
+		for (const RenderQueue2D::Item& item : items)
+		{
+			if (!item.isTranslucent())
+			{
+				continue;
+			}
+			if (item.getLayer() != currentLayer)
+			{
+				currentLayer = item.getLayer();
+				flushBatchAtLayer(currentLayer);
+			}
+			addItemToBatch(item);
+		}
+		flushBatch(FlushCause::StateChange);
+
+		// Restore render state
+		s_batch.setDepth(0.0f);
+		RenderState::enableDepthWriting();
+		RenderState::setDepthFunction(DepthFunction::Less);
+		if (!wasEnabledDepthTest)
+		{
+			RenderState::disableDepthTest();
+		}
+	}
+
+	void Renderer2DSystem::addItemToBatch(const RenderQueue2D::Item& item)
+	{
+		if (item.shape != nullptr)
+		{
+			addShapeToBatch(*item.shape);
+		}
+		else
+		{
+			addSpriteToBatch(*item.sprite);
+		}
+	}
+
+	void Renderer2DSystem::flushBatch(FlushCause cause)
+	{
+		if (s_batch.isEmpty())
+		{
+			return;
+		}
+
+		switch (cause)
+		{
+			case FlushCause::OutOfCapacity:
+				switch (s_batch.getLastOverflowReason())
+				{
+					case BatchOverflowReason2D::Vertices:       s_stats.flushesOutOfVertices++; break;
+					case BatchOverflowReason2D::Indices:        s_stats.flushesOutOfIndices++; break;
+					case BatchOverflowReason2D::Colors:         s_stats.flushesOutOfColors++; break;
+					case BatchOverflowReason2D::TextureSlots:   s_stats.flushesOutOfTextureSlots++; break;
+					default: break;
+				}
+				break;
+			case FlushCause::StateChange:   s_stats.flushesForStateChanges++; break;
+			case FlushCause::EndOfFrame:    s_stats.flushesAtEndOfFrame++; break;
+		}
+
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+		beginOverdrawVisualization();
+		s_batch.setDebugTint(getBatchIdColor(s_debugBatchesCount++));
+#endif
+
+		Camera2D_ConstPtr camera = s_camera.lock();
+		s_batch.render(camera);
+		s_batch.clear();
+	}
+
+	void Renderer2DSystem::flushBatchAtLayer(int layer)
+	{
+		flushBatch(FlushCause::StateChange);
+		s_batch.setDepth(getLayerDepth(layer));
+	}
+
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+	void Renderer2DSystem::setDebugVisualizationMode(DebugVisualizationMode2D mode)
+	{
+		s_debugVisualizationMode = mode;
+		s_batch.setDebugVisualizationMode(mode);
+	}
+
+	void Renderer2DSystem::logFlushReason()
+	{
+		if (s_isFlushReasonsLoggingEnabled)
+		{
+			PK_LOG_INFO("Rendering 2D batch early because it's out of " << getBatchOverflowReasonName(s_batch.getLastOverflowReason()) << ".", "Pekan");
+		}
+	}
+
+	void Renderer2DSystem::beginOverdrawVisualization()
+	{
+		if (s_debugVisualizationMode != DebugVisualizationMode2D::Overdraw || s_isOverdrawFrameBufferBound)
+		{
+			return;
+		}
+
+		// Remember what was bound before, so that heatmap can be drawn there at the end of the frame
+		s_previousFrameBufferId = RenderState::getBoundFrameBufferId();
+		s_previousViewport = RenderState::getViewport();
+
+		// (Re)create overdraw target if it doesn't match the viewport's size
+		const int width = s_previousViewport.z;
+		const int height = s_previousViewport.w;
+		if (!s_overdrawFrameBuffer.isValid() || s_overdrawFrameBuffer.getWidth() != width || s_overdrawFrameBuffer.getHeight() != height)
+		{
+			if (s_overdrawFrameBuffer.isValid())
+			{
+				s_overdrawFrameBuffer.destroy();
+			}
+			// Overdraw target is floating-point, so that counts can go above 1
+			s_overdrawFrameBuffer.create(width, height, 1, true);
+		}
+		s_overdrawFrameBuffer.bind();
+		RenderState::setViewport(0, 0, width, height);
+
+		// Clear overdraw target to 0, no matter the background color
+		const glm::vec4 backgroundColor = RenderState::getBackgroundColor();
+		RenderState::setBackgroundColor(0.0f, 0.0f, 0.0f, 0.0f);
+		RenderCommands::clear(true, true);
+		RenderState::setBackgroundColor(backgroundColor.r, backgroundColor.g, backgroundColor.b, backgroundColor.a);
+
+		// Add fragments together
+		s_previousIsEnabledBlending = RenderState::isEnabledBlending();
+		s_previousBlendSourceFactor = RenderState::getBlendSourceFactor();
+		s_previousBlendDestinationFactor = RenderState::getBlendDestinationFactor();
+		RenderState::enableBlending();
+		RenderState::setBlendFunction(BlendFactor::One, BlendFactor::One);
+
+		s_isOverdrawFrameBufferBound = true;
+	}
+
+	void Renderer2DSystem::endOverdrawVisualization()
+	{
+		PK_ASSERT_QUICK(s_isOverdrawFrameBufferBound);
+
+		RenderState::bindFrameBuffer(s_previousFrameBufferId);
+		RenderState::setViewport(s_previousViewport.x, s_previousViewport.y, s_previousViewport.z, s_previousViewport.w);
+
+		// Draw heatmap over the whole viewport, replacing whatever is there
+		const bool wasEnabledDepthTest = RenderState::isEnabledDepthTest();
+		if (wasEnabledDepthTest)
+		{
+			RenderState::disableDepthTest();
+		}
+		RenderState::disableBlending();
+		s_overdrawFrameBuffer.bindTexture(0);
+		s_overdrawRenderObject.render();
+
+		// Restore render state
+		RenderState::setBlendFunction(s_previousBlendSourceFactor, s_previousBlendDestinationFactor);
+		if (s_previousIsEnabledBlending)
+		{
+			RenderState::enableBlending();
+		}
+		if (wasEnabledDepthTest)
+		{
+			RenderState::enableDepthTest();
+		}
+
+		s_isOverdrawFrameBufferBound = false;
+	}
+
+	static glm::vec3 getBatchIdColor(int batchIndex)
+	{
+		// Step hue by the golden ratio, so that hues of consecutive batches are far apart
+		const float hue = std::fmod(float(batchIndex) * 0.618034f, 1.0f) * 6.0f;
+		const float x = 1.0f - std::fabs(std::fmod(hue, 2.0f) - 1.0f);
+		switch (int(hue))
+		{
+			case 0:     return { 1.0f, x, 0.0f };
+			case 1:     return { x, 1.0f, 0.0f };
+			case 2:     return { 0.0f, 1.0f, x };
+			case 3:     return { 0.0f, x, 1.0f };
+			case 4:     return { x, 0.0f, 1.0f };
+			default:    return { 1.0f, 0.0f, x };
+		}
+	}
+#endif
+
+	static float getLayerDepth(int layer)
+	{
+		return -float(layer) / LAYERS_RANGE;
+	}
+
+	static float getPixelsPerWorldUnit(const Camera2D_ConstPtr& camera)
+	{
+		if (camera != nullptr)
+		{
+			return camera->worldToWindowSize({ 1.0f, 1.0f }).x;
+		}
+		// Without a camera, primitives are rendered in NDC space, where the window is 2 units wide
+		return float(PekanEngine::getWindow().getSize().x) / 2.0f;
+	}
+
+	static void getVisibleBounds(const Camera2D_ConstPtr& camera, glm::vec2& boundsMin, glm::vec2& boundsMax)
+	{
+		if (camera == nullptr)
+		{
+			// Without a camera, primitives are rendered in NDC space
+			boundsMin = { -1.0f, -1.0f };
+			boundsMax = { 1.0f, 1.0f };
+			return;
+		}
+
+		// Take all corners, in case camera is rotated
+		const glm::vec2 corners[4] =
+		{
+			camera->ndcToWorldPosition({ -1.0f, -1.0f }),
+			camera->ndcToWorldPosition({ 1.0f, -1.0f }),
+			camera->ndcToWorldPosition({ 1.0f, 1.0f }),
+			camera->ndcToWorldPosition({ -1.0f, 1.0f })
+		};
+		boundsMin = corners[0];
+		boundsMax = corners[0];
+		for (int i = 1; i < 4; i++)
+		{
+			boundsMin = glm::min(boundsMin, corners[i]);
+			boundsMax = glm::max(boundsMax, corners[i]);
+		}
+	}
+
 	static void preprocessPkshadFiles()
 	{
 		const int maxTextureSlots = RenderState::getMaxTextureSlots();
 		const std::string maxTextureSlotsString = std::to_string(maxTextureSlots);
+		const std::string analyticEdgeAntiAliasingString = std::to_string(PEKAN_ENABLE_2D_ANALYTIC_EDGE_ANTI_ALIASING);
+		const std::string sdfShapesString = std::to_string(PEKAN_ENABLE_2D_SDF_SHAPES);
+		const std::string packedVerticesString = std::to_string(PEKAN_USE_PACKED_2D_VERTICES);
+		const std::string debugVisualizationString = std::to_string(PEKAN_ENABLE_2D_DEBUG_VISUALIZATION);
 
 		// A list of substitution lists, one for each .pkshad file
 		const std::unordered_map<std::string, std::string> PKSHAD_FILES_SUBSTITUTIONS[PKSHAD_FILES_COUNT] =
 		{
 			{
-				{ "MAX_TEXTURE_SLOTS", maxTextureSlotsString }
+				{ "MAX_TEXTURE_SLOTS", maxTextureSlotsString },
+				{ "ANALYTIC_EDGE_ANTI_ALIASING", analyticEdgeAntiAliasingString },
+				{ "SDF_SHAPES", sdfShapesString },
+				{ "DEBUG_VISUALIZATION", debugVisualizationString }
+			},
+			{
+				{ "MAX_TEXTURE_SLOTS", maxTextureSlotsString },
+				{ "ANALYTIC_EDGE_ANTI_ALIASING", analyticEdgeAntiAliasingString },
+				{ "SDF_SHAPES", sdfShapesString },
+				{ "DEBUG_VISUALIZATION", debugVisualizationString }
+			},
+			{
+				{ "ANALYTIC_EDGE_ANTI_ALIASING", analyticEdgeAntiAliasingString },
+				{ "SDF_SHAPES", sdfShapesString },
+				{ "PACKED_VERTICES", packedVerticesString }
 			},
 			{
-				{ "MAX_TEXTURE_SLOTS", maxTextureSlotsString }
+				{ "ANALYTIC_EDGE_ANTI_ALIASING", analyticEdgeAntiAliasingString },
+				{ "SDF_SHAPES", sdfShapesString },
+				{ "PACKED_VERTICES", packedVerticesString }
 			}
 		};
 
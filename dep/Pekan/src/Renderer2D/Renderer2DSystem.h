@@ -2,6 +2,12 @@
 
 #include "ISubsystem.h"
 #include "RenderBatch2D.h"
+#include "RenderQueue2D.h"
+#include "SamplesCounter.h"
+
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+#include "FrameBuffer.h"
+#endif
 
 namespace Pekan
 {
@@ -28,8 +34,62 @@ namespace Renderer2D
         // To be called at the beginning of every 2D scene's render() function.
         static void beginFrame();
         // To be called at the end of every 2D scene's render() function.
+        // If sorting is enabled, this is where all primitives submitted during the frame are sorted and rendered.
         static void endFrame();
 
+        // Enables or disables sorting of primitives.
+        //
+        // If sorting is disabled (the default), primitives are rendered in the order they are submitted.
+        // If sorting is enabled, primitives are queued until endFrame() and are then sorted by layer,
+        // so that ones in higher layers are drawn over ones in lower layers,
+        // while opaque primitives in the same layer are grouped by texture, so that they need fewer draw calls.
+        // Translucent primitives in the same layer are still drawn in the order they are submitted.
+        //
+        // NOTE: When sorting is enabled, submitted primitives must not be changed or destroyed until endFrame().
+        static void setSortingEnabled(bool isSortingEnabled) { s_isSortingEnabled = isSortingEnabled; }
+        static bool isSortingEnabled() { return s_isSortingEnabled; }
+
+        // Enables or disables an opaque depth pass.
+        //
+        // If enabled, primitives are queued and sorted like when sorting is enabled, and then each layer is drawn at its own depth.
+        // Opaque primitives are drawn first, from the highest layer to the lowest, with depth testing and depth writing,
+        // so that fragments hidden behind opaque primitives in higher layers are rejected before their fragment shader is run.
+        // Translucent primitives are drawn after that, from the lowest layer to the highest, without depth writing.
+        // This cuts overdraw in scenes where large opaque primitives, like walls and floors, cover each other.
+        //
+        // NOTE: Only primitives that are opaque, see Shape::isOpaque() and Sprite::isOpaque(), are drawn in the opaque pass.
+        // NOTE: Depth buffer is cleared in endFrame(), so depth pass cannot be mixed with other rendering that relies on depth.
+        static void setOpaqueDepthPassEnabled(bool isOpaqueDepthPassEnabled) { s_isOpaqueDepthPassEnabled = isOpaqueDepthPassEnabled; }
+        static bool isOpaqueDepthPassEnabled() { return s_isOpaqueDepthPassEnabled; }
+
+        // Enables or disables measuring of overdraw, using a GPU query counting the samples drawn between beginFrame() and endFrame()
+        static void setOverdrawMeasuringEnabled(bool isOverdrawMeasuringEnabled) { s_isOverdrawMeasuringEnabled = isOverdrawMeasuringEnabled; }
+        static bool isOverdrawMeasuringEnabled() { return s_isOverdrawMeasuringEnabled; }
+        // Returns the latest measured overdraw, which is the average number of times each sample of the target that Renderer2D draws to,
+        // for example PostProcessor's frame buffer with its scaled resolution and its MSAA samples, is drawn in a frame,
+        // or a negative value if overdraw is not measured yet.
+        // Measurements are available a few frames after they are made, and are also part of getStats().
+        static float getOverdraw();
+
+        // Returns the stats of the last completed frame, counting the work done between its beginFrame() and endFrame(),
+        // and the full-screen passes rendered by the PostProcessor in that frame.
+        static const RenderStats2D& getStats() { return s_lastFrameStats; }
+
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+        // Sets the debug visualization mode that primitives are rendered with.
+        //
+        // In Overdraw mode, primitives are rendered to a separate target, where each fragment adds 1 to its pixel,
+        // and at endFrame() the result is drawn over the whole viewport as a heatmap, replacing primitives.
+        // In BatchIds mode, primitives are tinted with a different color for each draw call of the batch.
+        static void setDebugVisualizationMode(DebugVisualizationMode2D mode);
+        static DebugVisualizationMode2D getDebugVisualizationMode() { return s_debugVisualizationMode; }
+
+        // Enables or disables logging of the reason every time the batch has to be rendered early,
+        // because it ran out of vertices, indices, colors or texture slots.
+        static void setFlushReasonsLoggingEnabled(bool isFlushReasonsLoggingEnabled) { s_isFlushReasonsLoggingEnabled = isFlushReasonsLoggingEnabled; }
+        static bool isFlushReasonsLoggingEnabled() { return s_isFlushReasonsLoggingEnabled; }
+#endif
+
         // Returns (a const pointer to) the camera currently used for rendering
         static Camera2D_ConstPtr getCamera() { return s_camera.lock(); }
         // Sets a camera to be used for rendering
@@ -38,8 +98,26 @@ namespace Renderer2D
         // Returns current mouse position in world space, using current camera
         static glm::vec2 getMousePosition();
 
+        // Sets the maximum distance, in pixels, between a curved shape and its approximation with straight segments.
+        // Shapes that support level of detail, like CircleShape, use as few segments as possible
+        // to stay within this tolerance at their current size on screen.
+        static void setLevelOfDetailTolerance(float tolerance);
+        // Returns the maximum distance, in pixels, between a curved shape and its approximation with straight segments
+        static float getLevelOfDetailTolerance() { return s_levelOfDetailTolerance; }
+
     private: /* functions */
 
+        // Enum for different causes of rendering the batch
+        enum class FlushCause
+        {
+            // Batch couldn't fit another primitive
+            OutOfCapacity = 0,
+            // Render state needs to change, for example the depth that batch is drawn at
+            StateChange = 1,
+            // Frame is ending
+            EndOfFrame = 2
+        };
+
         bool init() override;
         void exit() override;
 
@@ -52,15 +130,87 @@ namespace Renderer2D
         // Actual rendering will happen later.
         static void submitForRendering(const Sprite& sprite);
 
+        // Adds a shape to the batch, rendering and clearing the batch first if it's full
+        static void addShapeToBatch(const Shape& shape);
+        // Adds a sprite to the batch, rendering and clearing the batch first if it's full
+        static void addSpriteToBatch(const Sprite& sprite);
+
+        // Renders and clears the batch, if it's not empty, recording the cause in current frame's stats
+        static void flushBatch(FlushCause cause);
+
+        // Adds all queued primitives to the batch in sorted order, rendering the batch whenever it's full
+        static void renderQueue();
+        // Renders all queued primitives in an opaque depth pass and a translucent pass, see setOpaqueDepthPassEnabled()
+        static void renderQueueWithOpaqueDepthPass();
+        // Adds a queued item to the batch, rendering the batch first if it's full
+        static void addItemToBatch(const RenderQueue2D::Item& item);
+        // Renders and clears the batch, and sets the depth of the next batch to the depth of a given layer
+        static void flushBatchAtLayer(int layer);
+
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+        // Logs why the batch has to be rendered early, if logging of flush reasons is enabled
+        static void logFlushReason();
+
+        // Binds the overdraw target and sets up additive blending, if overdraw is visualized and the target is not yet bound in current frame
+        static void beginOverdrawVisualization();
+        // Binds back the frame buffer that was bound before the overdraw target, and draws the overdraw heatmap to it
+        static void endOverdrawVisualization();
+#endif
+
     private:
 
         // A batch of 2D primitives that have been submitted for rendering, and not yet rendered.
         static RenderBatch2D s_batch;
 
+        // A queue of 2D primitives that have been submitted for rendering during current frame,
+        // used only if sorting is enabled.
+        static RenderQueue2D s_queue;
+        // Flag indicating if primitives are sorted before being rendered
+        static bool s_isSortingEnabled;
+        // Flag indicating if opaque primitives are drawn front-to-back in a depth pass, before translucent ones
+        static bool s_isOpaqueDepthPassEnabled;
+
+        // A counter of samples drawn each frame, used only if overdraw measuring is enabled
+        static Graphics::SamplesCounter s_samplesCounter;
+        // Flag indicating if overdraw is measured
+        static bool s_isOverdrawMeasuringEnabled;
+        // Flag indicating if samples counter has begun counting in current frame
+        static bool s_isSamplesCounterCounting;
+
+        // Stats of current frame, and of the last completed frame
+        static RenderStats2D s_stats;
+        static RenderStats2D s_lastFrameStats;
+
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+        static DebugVisualizationMode2D s_debugVisualizationMode;
+        static bool s_isFlushReasonsLoggingEnabled;
+        // Number of times the batch has been rendered in current frame, used for picking its tint when visualizing batch IDs
+        static int s_debugBatchesCount;
+
+        // Target that overdraw is counted in, with the size of the viewport
+        static Graphics::FrameBuffer s_overdrawFrameBuffer;
+        // Render object drawing the overdraw heatmap over the whole viewport
+        static Graphics::RenderObject s_overdrawRenderObject;
+        // Flag indicating if overdraw target is bound in current frame
+        static bool s_isOverdrawFrameBufferBound;
+        // Frame buffer, viewport and blending state from before the overdraw target was bound, restored after visualizing overdraw
+        static unsigned s_previousFrameBufferId;
+        static glm::ivec4 s_previousViewport;
+        static bool s_previousIsEnabledBlending;
+        static Graphics::BlendFactor s_previousBlendSourceFactor;
+        static Graphics::BlendFactor s_previousBlendDestinationFactor;
+#endif
+
         // A pointer to the camera used for rendering.
         // NOTE: It's a weak pointer so the camera is NOT owned by Renderer2D.
         //       If the camera is destroyed at some point, Renderer2D will safely stop using it.
         static Camera2D_ConstWeakPtr s_camera;
+
+        // Maximum distance, in pixels, between a curved shape and its approximation with straight segments
+        static float s_levelOfDetailTolerance;
+        // Number of pixels that a unit of world space covers on screen, with current camera.
+        // Updated at the beginning of each frame.
+        static float s_pixelsPerWorldUnit;
     };
 
 } // namespace Renderer2D
@@ -1,13 +1,52 @@
 #version 330 core
+#define ANALYTIC_EDGE_ANTI_ALIASING 0
+#define SDF_SHAPES 1
+#define DEBUG_VISUALIZATION 0
 
 in vec2 vTexCoord;
 in float vTexIndex;
 in float vShapeIndex;
+#if ANALYTIC_EDGE_ANTI_ALIASING
+in vec2 vEdgeCoordinates;
+#endif
+#if SDF_SHAPES
+in vec4 vSdfParameters;
+#endif
 out vec4 FragColor;
 
 uniform sampler1D uColorsTexture;
 uniform int uColorsCount;
 uniform sampler2D uTextures[32 - 1];
+#if DEBUG_VISUALIZATION
+// Debug visualization mode - 0 for none, 1 for overdraw, 2 for batch IDs
+uniform int uDebugVisualizationMode;
+// Color tinting all primitives of the batch when visualizing batch IDs
+uniform vec3 uDebugTint;
+#endif
+
+#if SDF_SHAPES
+// Returns how much of the pixel at a given point, in shape's local space, is covered by an SDF shape with given parameters.
+// Shape is a rounded box, hollowed out into a ring if ring thickness is positive,
+// so circles, rings, rounded rectangles and capsules are all different parameters of it.
+float getSdfCoverage(vec2 point, vec4 parameters)
+{
+    vec2 halfSize = parameters.xy;
+    float cornerRadius = parameters.z;
+    float ringThickness = parameters.w;
+
+    // Signed distance to the rounded box, negative inside of it
+    vec2 q = abs(point) - halfSize + cornerRadius;
+    float boxDistance = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - cornerRadius;
+    // Signed distance to a ring following the box's edge on the inside
+    float ringDistance = abs(boxDistance + ringThickness * 0.5) - ringThickness * 0.5;
+    float shapeDistance = mix(boxDistance, ringDistance, float(ringThickness > 0.0));
+
+    // Size of a pixel in shape's local space, so that edges are anti-aliased over exactly one pixel
+    // no matter how the shape is scaled by its transform and the camera
+    float pixelSize = max(0.5 * (length(dFdx(point)) + length(dFdy(point))), 1e-6);
+    return clamp(0.5 - shapeDistance / pixelSize, 0.0, 1.0);
+}
+#endif
 
 void main()
 {
@@ -23,4 +62,31 @@ void main()
     // Output either shape's color or sprite's color
     // depending on whether we are rendering a shape or a sprite
     FragColor = mix(shapeColor, spriteColor, isSprite);
+
+#if ANALYTIC_EDGE_ANTI_ALIASING
+    // Fade out fragments that are closer than a pixel to an edge of their quad.
+    // Edge coordinates go from 0 to 1 across the quad, so dividing the distance to the nearest edge
+    // by how much edge coordinates change per pixel gives the distance in pixels.
+    vec2 edgeDistance = min(vEdgeCoordinates, 1.0 - vEdgeCoordinates) / max(fwidth(vEdgeCoordinates), vec2(1e-6));
+    FragColor.a *= clamp(min(edgeDistance.x, edgeDistance.y) + 0.5, 0.0, 1.0);
+#endif
+
+#if SDF_SHAPES
+    // If fragment belongs to an SDF shape, fade it out depending on how much of its pixel is covered by the shape.
+    // Coverage is calculated for all fragments, because derivatives are not defined inside of non-uniform branches.
+    float sdfCoverage = getSdfCoverage(vTexCoord, vSdfParameters);
+    FragColor.a *= mix(1.0, sdfCoverage, float(vSdfParameters.x >= 0.0));
+#endif
+
+#if DEBUG_VISUALIZATION
+    if (uDebugVisualizationMode == 1)
+    {
+        // Each fragment adds 1 to the overdraw target, no matter its color
+        FragColor = vec4(1.0, 1.0, 1.0, 1.0);
+    }
+    else if (uDebugVisualizationMode == 2)
+    {
+        FragColor.rgb = mix(FragColor.rgb, uDebugTint, 0.75);
+    }
+#endif
 }
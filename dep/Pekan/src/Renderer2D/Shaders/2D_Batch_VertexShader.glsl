@@ -1,19 +1,63 @@
 #version 330 core
+#define ANALYTIC_EDGE_ANTI_ALIASING 0
+#define SDF_SHAPES 1
+#define PACKED_VERTICES 0
 layout(location = 0) in vec2 aPosition;
 layout(location = 1) in vec2 aTexCoord;
+#if PACKED_VERTICES
+// Texture index, exponent of texture coordinates' scale, and a flag indicating if texture coordinates are signed
+layout(location = 2) in vec4 aTextureInfo;
+#else
 layout(location = 2) in float aTexIndex;
+#endif
 layout(location = 3) in vec4 aColor;
+#if ANALYTIC_EDGE_ANTI_ALIASING
+layout(location = 4) in vec2 aEdgeCoordinates;
+#endif
+#if SDF_SHAPES && ANALYTIC_EDGE_ANTI_ALIASING
+layout(location = 5) in vec4 aSdfParameters;
+#elif SDF_SHAPES
+layout(location = 4) in vec4 aSdfParameters;
+#endif
 
 out vec2 vTexCoord;
 out float vTexIndex;
 out vec4 vColor;
+#if ANALYTIC_EDGE_ANTI_ALIASING
+out vec2 vEdgeCoordinates;
+#endif
+#if SDF_SHAPES
+out vec4 vSdfParameters;
+#endif
 
 uniform mat4 uViewProjectionMatrix;
+// Depth of all primitives in the batch, in normalized device coordinates
+uniform float uDepth;
 
 void main()
 {
     gl_Position = uViewProjectionMatrix * vec4(aPosition, 0.0, 1.0);
+    gl_Position.z = uDepth * gl_Position.w;
+#if PACKED_VERTICES
+    // Texture index 255 means that vertex has no texture
+    vTexIndex = mix(aTextureInfo.x, -1.0, float(aTextureInfo.x > 254.5));
+    // Texture coordinates are packed into [0, 1], after being scaled down by a power of 2,
+    // and mapped from [-1, 1] if they are signed
+    vec2 texCoord = mix(aTexCoord, aTexCoord * 2.0 - 1.0, aTextureInfo.z) * exp2(aTextureInfo.y);
+#if SDF_SHAPES
+    // Box coordinates of SDF shapes are packed relative to box's half size, so scale them back
+    texCoord *= mix(vec2(1.0), aSdfParameters.xy, float(aSdfParameters.x >= 0.0));
+#endif
+    vTexCoord = texCoord;
+#else
     vTexCoord = aTexCoord;
     vTexIndex = aTexIndex;
+#endif
     vColor = aColor;
+#if ANALYTIC_EDGE_ANTI_ALIASING
+    vEdgeCoordinates = aEdgeCoordinates;
+#endif
+#if SDF_SHAPES
+    vSdfParameters = aSdfParameters;
+#endif
 }
@@ -0,0 +1,31 @@
+#version 330 core
+
+in vec2 vTexCoord;
+out vec4 FragColor;
+
+// Overdraw target, holding in its red channel how many fragments were drawn in each pixel
+uniform sampler2D uOverdrawTexture;
+
+// Colors of pixels drawn 0, 1, 2, 3, 4 and 5 or more times
+const vec3 HEATMAP_COLORS[6] = vec3[6]
+(
+    vec3(0.0, 0.0, 0.0),
+    vec3(0.0, 0.2, 0.8),
+    vec3(0.0, 0.8, 0.2),
+    vec3(0.9, 0.9, 0.0),
+    vec3(1.0, 0.4, 0.0),
+    vec3(1.0, 0.0, 0.0)
+);
+
+void main()
+{
+    float overdraw = texture(uOverdrawTexture, vTexCoord).r;
+    // Interpolate between colors of neighbouring counts,
+    // and fade from red to white after 5, reaching white at 10.
+    float index = clamp(overdraw, 0.0, 5.0);
+    int lower = int(floor(index));
+    int upper = min(lower + 1, 5);
+    vec3 color = mix(HEATMAP_COLORS[lower], HEATMAP_COLORS[upper], index - float(lower));
+    color = mix(color, vec3(1.0, 1.0, 1.0), clamp((overdraw - 5.0) / 5.0, 0.0, 1.0));
+    FragColor = vec4(color, 1.0);
+}
@@ -5,14 +5,65 @@
 #include "Utils/MathUtils.h"
 #include <glm/gtc/constants.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
 static const int DEFAULT_SEGMENTS_COUNT = 42;
 static const float PI = glm::pi<float>();
 
+// Numbers of segments of circle's levels of detail, from least to most detailed.
+// Keeping them to a few fixed levels lets all circles share their vertices,
+// and keeps a circle from changing its number of segments on every small change of zoom.
+static const int LOD_SEGMENTS_COUNTS[] = { 8, 12, 16, 24, 32, 48, 64, 96, 128, 192, 256 };
+static const int LOD_LEVELS_COUNT = int(sizeof(LOD_SEGMENTS_COUNTS) / sizeof(LOD_SEGMENTS_COUNTS[0]));
+
 namespace Pekan
 {
 namespace Renderer2D
 {
 
+    // Vertices of a unit circle for each level of detail used so far, by number of segments.
+    // Shared between all circles, so that changing level of detail only scales cached vertices by circle's radius.
+    static std::unordered_map<int, std::vector<glm::vec2>> g_unitCircles;
+
+    // Returns vertices of a unit circle with a given number of segments, generating them if not cached yet
+    static const std::vector<glm::vec2>& getUnitCircle(int segmentsCount)
+    {
+        std::vector<glm::vec2>& vertices = g_unitCircles[segmentsCount];
+        if (vertices.empty())
+        {
+            vertices.resize(segmentsCount);
+            for (int i = 0; i < segmentsCount; i++)
+            {
+                const float angle = float(i) * 2.0f * PI / segmentsCount;
+                vertices[i] = { cos(angle), sin(angle) };
+            }
+        }
+        return vertices;
+    }
+
+    // Returns the smallest level of detail's number of segments with which a circle of a given radius in pixels
+    // stays within a given tolerance in pixels.
+    // A segment's furthest distance from the circle is radius * (1 - cos(PI / segmentsCount)),
+    // so the number of segments needed is PI / acos(1 - tolerance / radius).
+    static int getLevelOfDetailSegmentsCount(float radius, float tolerance)
+    {
+        if (radius <= tolerance)
+        {
+            return LOD_SEGMENTS_COUNTS[0];
+        }
+        const float neededSegmentsCount = PI / std::acos(1.0f - tolerance / radius);
+        for (int i = 0; i < LOD_LEVELS_COUNT; i++)
+        {
+            if (float(LOD_SEGMENTS_COUNTS[i]) >= neededSegmentsCount)
+            {
+                return LOD_SEGMENTS_COUNTS[i];
+            }
+        }
+        return LOD_SEGMENTS_COUNTS[LOD_LEVELS_COUNT - 1];
+    }
+
     void CircleShape::create(float radius)
     {
         PK_ASSERT(radius > 0.0f, "CircleShape's radius must be greater than 0.", "Pekan");
@@ -40,26 +91,35 @@ namespace Renderer2D
         PK_ASSERT(segmentsCount > 2, "CircleShape's segments must be at least 3.", "Pekan");
 
         m_segmentsCount = segmentsCount;
+        m_isAutomaticLevelOfDetail = false;
         m_needUpdateVerticesLocal = true;
         m_needUpdateIndices = true;
     }
 
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-    const Vertex2D* CircleShape::getVertices(float shapeIndex) const
-#else
-    const Vertex2D* CircleShape::getVertices() const
-#endif
+    void CircleShape::selectLevelOfDetail(float pixelsPerWorldUnit, float tolerance) const
     {
-        PK_ASSERT(isValid(), "Trying to get vertices of a CircleShape that is not yet created.", "Pekan");
+        if (!m_isAutomaticLevelOfDetail)
+        {
+            return;
+        }
 
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-        PK_ASSERT(shapeIndex >= 0.0f, "Trying to get vertices of a Shape but giving it a negative shape index.", "Pekan");
-        if (m_shapeIndex != shapeIndex)
+        // Get circle's radius in pixels, scaling it by the larger scale of circle's transform
+        const glm::mat3& worldMatrix = getWorldMatrix();
+        const float scale = std::max(glm::length(glm::vec2(worldMatrix[0])), glm::length(glm::vec2(worldMatrix[1])));
+        const float radiusInPixels = m_radius * scale * pixelsPerWorldUnit;
+
+        const int segmentsCount = getLevelOfDetailSegmentsCount(radiusInPixels, tolerance);
+        if (segmentsCount != m_segmentsCount)
         {
-            m_shapeIndex = shapeIndex;
-            m_needUpdateVerticesWorld = true;
+            m_segmentsCount = segmentsCount;
+            m_needUpdateVerticesLocal = true;
+            m_needUpdateIndices = true;
         }
-#endif
+    }
+
+    const Vertex2D* CircleShape::getVertices() const
+    {
+        PK_ASSERT(isValid(), "Trying to get vertices of a CircleShape that is not yet created.", "Pekan");
 
         if (m_transformChangeIdUsedInVerticesWorld < Transformable2D::getChangeId())
         {
@@ -93,13 +153,26 @@ namespace Renderer2D
         PK_ASSERT(isValid(), "Trying to update local vertices of a CircleShape that is not yet created.", "Pekan");
 
         m_verticesLocal.resize(m_segmentsCount);
-        // Use radius and segments count to compute the local vertex positions
-        for (int i = 0; i < m_segmentsCount; i++)
+        // If number of segments is picked automatically, it's one of the levels of detail,
+        // so local vertex positions can be computed by scaling the cached unit circle by the radius
+        if (m_isAutomaticLevelOfDetail)
+        {
+            const std::vector<glm::vec2>& unitCircle = getUnitCircle(m_segmentsCount);
+            for (int i = 0; i < m_segmentsCount; i++)
+            {
+                m_verticesLocal[i] = m_radius * unitCircle[i];
+            }
+        }
+        // Otherwise use radius and segments count to compute the local vertex positions
+        else
         {
-            const float angle = float(i) * 2.0f * PI / m_segmentsCount;
-            const float x = m_radius * cos(angle);
-            const float y = m_radius * sin(angle);
-            m_verticesLocal[i] = { x, y };
+            for (int i = 0; i < m_segmentsCount; i++)
+            {
+                const float angle = float(i) * 2.0f * PI / m_segmentsCount;
+                const float x = m_radius * cos(angle);
+                const float y = m_radius * sin(angle);
+                m_verticesLocal[i] = { x, y };
+            }
         }
 
         m_needUpdateVerticesLocal = false;
@@ -116,10 +189,7 @@ namespace Renderer2D
         {
             // Calculate world vertex positions by applying the transform matrix to the local vertex positions
             m_verticesWorld[i].position = glm::vec2(worldMatrix * glm::vec3(m_verticesLocal[i], 1.0f));
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-            // Set "shapeIndex" attribute to be shape's index
-            m_verticesWorld[i].shapeIndex = m_shapeIndex;
-#else
+#if !PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
             // Set "color" attribute to be shape's color
             m_verticesWorld[i].color = m_color;
 #endif
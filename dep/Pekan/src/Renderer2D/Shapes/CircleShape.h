@@ -11,6 +11,10 @@ namespace Renderer2D
 
 	// A class representing a 2D circle shape with a solid color.
 	//
+	// By default, number of segments is picked automatically each time the circle is rendered,
+	// as the smallest number of segments keeping the circle within Renderer2DSystem's level of detail tolerance
+	// at circle's current size on screen. So a circle covering a few pixels has only a few triangles.
+	//
 	// NOTE: This class supports dynamically changing the number of segments of a circle,
 	//       meaning that you can change the number of segments during the lifetime of a circle object.
 	//       If you don't plan on dynamically changing the number of segments it'd be better to instead use
@@ -25,21 +29,25 @@ namespace Renderer2D
 		void destroy() { Shape::_destroy(); }
 
 		void setRadius(float radius);
+		// Sets a fixed number of segments, disabling automatic level of detail
 		void setSegmentsCount(int segmentsCount);
+		// Enables/disables automatic level of detail, picking number of segments from circle's size on screen
+		void setAutomaticLevelOfDetail(bool enabled) { m_isAutomaticLevelOfDetail = enabled; }
 
 		inline float getRadius() const { return m_radius; }
 		inline int getSegmentsCount() const { return m_segmentsCount; }
+		inline bool isAutomaticLevelOfDetail() const { return m_isAutomaticLevelOfDetail; }
 
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-		const Vertex2D* getVertices(float shapeIndex) const override;
-#else
 		const Vertex2D* getVertices() const override;
-#endif
 		int getVerticesCount() const override { return m_verticesLocal.size(); };
 
 		const unsigned* getIndices() const override;
 		int getIndicesCount() const override { return m_indices.size(); };
 
+	protected: /* functions */
+
+		void selectLevelOfDetail(float pixelsPerWorldUnit, float tolerance) const override;
+
 	private: /* functions */
 
 		// Updates local vertices from current radius and segments count
@@ -67,8 +75,12 @@ namespace Renderer2D
 		// Radius of circle, in local space
 		float m_radius = -1.0f;
 
-		// Number of segments used to approximate the circle
-		int m_segmentsCount = 0;
+		// Number of segments used to approximate the circle.
+		// Mutable because it's picked automatically, when level of detail is selected.
+		mutable int m_segmentsCount = 0;
+
+		// Flag indicating if number of segments is picked automatically from circle's size on screen
+		bool m_isAutomaticLevelOfDetail = true;
 	};
 
 } // namespace Renderer2D
@@ -45,23 +45,10 @@ namespace Renderer2D
         m_needUpdateVerticesLocal = true;
     }
 
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-    const Vertex2D* LineShape::getVertices(float shapeIndex) const
-#else
     const Vertex2D* LineShape::getVertices() const
-#endif
     {
         PK_ASSERT(isValid(), "Trying to get vertices of a LineShape that is not yet created.", "Pekan");
 
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-        PK_ASSERT(shapeIndex >= 0.0f, "Trying to get vertices of a Shape but giving it a negative shape index.", "Pekan");
-        if (m_shapeIndex != shapeIndex)
-        {
-            m_shapeIndex = shapeIndex;
-            m_needUpdateVerticesWorld = true;
-        }
-#endif
-
         if (m_transformChangeIdUsedInVerticesWorld < Transformable2D::getChangeId())
         {
             m_needUpdateVerticesWorld = true;
@@ -118,13 +105,7 @@ namespace Renderer2D
         m_verticesWorld[2].position = glm::vec2(worldMatrix * glm::vec3(m_verticesLocal[2], 1.0f));
         m_verticesWorld[3].position = glm::vec2(worldMatrix * glm::vec3(m_verticesLocal[3], 1.0f));
 
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-        // Set "shapeIndex" attribute of each vertex to be shape's index
-        m_verticesWorld[0].shapeIndex = m_shapeIndex;
-        m_verticesWorld[1].shapeIndex = m_shapeIndex;
-        m_verticesWorld[2].shapeIndex = m_shapeIndex;
-        m_verticesWorld[3].shapeIndex = m_shapeIndex;
-#else
+#if !PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
         // Set "color" attribute of each vertex to be shape's color
         m_verticesWorld[0].color = m_color;
         m_verticesWorld[1].color = m_color;
@@ -132,6 +113,14 @@ namespace Renderer2D
         m_verticesWorld[3].color = m_color;
 #endif
 
+#if PEKAN_ENABLE_2D_ANALYTIC_EDGE_ANTI_ALIASING
+        // Set "edgeCoordinates" attribute of each vertex to be its corner of the quad
+        m_verticesWorld[0].edgeCoordinates = { 0.0f, 1.0f };
+        m_verticesWorld[1].edgeCoordinates = { 0.0f, 0.0f };
+        m_verticesWorld[2].edgeCoordinates = { 1.0f, 0.0f };
+        m_verticesWorld[3].edgeCoordinates = { 1.0f, 1.0f };
+#endif
+
         // Cache change ID of the transform that we just used to update world vertices
         m_transformChangeIdUsedInVerticesWorld = Transformable2D::getChangeId();
 
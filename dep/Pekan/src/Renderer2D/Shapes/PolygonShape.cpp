@@ -6,6 +6,8 @@
 #include "RenderState.h"
 
 #include <algorithm>
+#include <unordered_map>
+#include <functional>
 
 using namespace Pekan::Graphics;
 
@@ -14,11 +16,98 @@ namespace Pekan
 namespace Renderer2D
 {
 
+    // A triangulation of a concave polygon, cached by the polygon's vertices
+    struct CachedTriangulation
+    {
+        std::vector<glm::vec2> vertices;
+        std::weak_ptr<const std::vector<unsigned>> indices;
+    };
+
+    // Cache of triangulations of concave polygons, by a hash of their vertices,
+    // so that polygons with the same outline share a single list of indices and are triangulated only once.
+    // Holds weak pointers, so a triangulation is freed as soon as no polygon uses it anymore.
+    static std::unordered_map<size_t, std::vector<CachedTriangulation>> g_triangulationCache;
+    // Number of entries in the cache right after expired ones were last removed
+    static size_t g_triangulationCacheSizeAfterCleanup = 0;
+
+    // Returns a hash of given vertices
+    static size_t hashVertices(const std::vector<glm::vec2>& vertices)
+    {
+        size_t hash = vertices.size();
+        const std::hash<float> hashFloat;
+        for (const glm::vec2& vertex : vertices)
+        {
+            hash ^= hashFloat(vertex.x) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= hashFloat(vertex.y) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+        return hash;
+    }
+
+    // Removes entries of triangulations that are no longer used by any polygon
+    static void removeExpiredTriangulations()
+    {
+        for (auto it = g_triangulationCache.begin(); it != g_triangulationCache.end();)
+        {
+            std::vector<CachedTriangulation>& entries = it->second;
+            entries.erase
+            (
+                std::remove_if(entries.begin(), entries.end(), [](const CachedTriangulation& entry) { return entry.indices.expired(); }),
+                entries.end()
+            );
+            it = entries.empty() ? g_triangulationCache.erase(it) : std::next(it);
+        }
+        g_triangulationCacheSizeAfterCleanup = g_triangulationCache.size();
+    }
+
+    // Returns triangulation of a concave polygon with given vertices, in CCW order,
+    // reusing a cached one if a polygon with the same vertices was already triangulated.
+    static std::shared_ptr<const std::vector<unsigned>> getTriangulation(const std::vector<glm::vec2>& vertices)
+    {
+        const size_t hash = hashVertices(vertices);
+        std::vector<CachedTriangulation>& entries = g_triangulationCache[hash];
+        for (const CachedTriangulation& entry : entries)
+        {
+            if (entry.vertices == vertices)
+            {
+                if (std::shared_ptr<const std::vector<unsigned>> indices = entry.indices.lock())
+                {
+                    return indices;
+                }
+            }
+        }
+
+        std::shared_ptr<std::vector<unsigned>> indices = std::make_shared<std::vector<unsigned>>();
+        if (!MathUtils::triangulatePolygon(vertices, *indices))
+        {
+            PK_LOG_ERROR("Failed to triangulate a polygon. It's probably a badly defined polygon, possibly self-intersecting.", "Pekan");
+            // Don't cache a failed triangulation
+            return indices;
+        }
+
+        // Reuse an expired entry with the same hash, if there is one, otherwise add a new entry
+        const auto expiredEntry = std::find_if(entries.begin(), entries.end(), [](const CachedTriangulation& entry) { return entry.indices.expired(); });
+        if (expiredEntry != entries.end())
+        {
+            *expiredEntry = { vertices, indices };
+        }
+        else
+        {
+            entries.push_back({ vertices, indices });
+        }
+        // Remove expired entries whenever cache grows twice as big as it was after the last cleanup
+        if (g_triangulationCache.size() > 2 * g_triangulationCacheSizeAfterCleanup + 16)
+        {
+            removeExpiredTriangulations();
+        }
+        return indices;
+    }
+
     void PolygonShape::create(const std::vector<glm::vec2>& vertices)
     {
         Shape::_create();
 
         m_verticesLocal = vertices;
+        m_sharedIndices.reset();
         m_isReversedVerticesLocal = false;
         m_isIndicesTriangleFan = false;
         m_isReversedIndices = false;
@@ -45,35 +134,25 @@ namespace Renderer2D
             return;
         }
 
-        if (m_isReversedVerticesLocal)
-        {
-            m_verticesLocal[m_verticesLocal.size() - 1 - index] = vertex;
-        }
-        else
+        const int localIndex = m_isReversedVerticesLocal ? int(m_verticesLocal.size()) - 1 - index : index;
+
+        // If current triangulation is up to date and stays valid with the vertex moved,
+        // then only world vertices need to be updated, without triangulating the polygon again.
+        if (!m_needUpdateVerticesLocal && isTriangulationValidAfterMove(localIndex, vertex))
         {
-            m_verticesLocal[index] = vertex;
+            m_verticesLocal[localIndex] = vertex;
+            m_needUpdateVerticesWorld = true;
+            return;
         }
 
+        m_verticesLocal[localIndex] = vertex;
         m_needUpdateVerticesLocal = true;
     }
 
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-    const Vertex2D* PolygonShape::getVertices(float shapeIndex) const
-#else
     const Vertex2D* PolygonShape::getVertices() const
-#endif
     {
         PK_ASSERT(isValid(), "Trying to get vertices of a PolygonShape that is not yet created.", "Pekan");
 
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-        PK_ASSERT(shapeIndex >= 0.0f, "Trying to get vertices of a Shape but giving it a negative shape index.", "Pekan");
-        if (m_shapeIndex != shapeIndex)
-        {
-            m_shapeIndex = shapeIndex;
-            m_needUpdateVerticesWorld = true;
-        }
-#endif
-
         if (m_transformChangeIdUsedInVerticesWorld < Transformable2D::getChangeId())
         {
             m_needUpdateVerticesWorld = true;
@@ -108,8 +187,9 @@ namespace Renderer2D
             updateVerticesWorld();
         }
 
-        PK_ASSERT_QUICK(m_indices.size() % 3 == 0);
-        return m_indices.data();
+        const std::vector<unsigned>& indices = getIndicesList();
+        PK_ASSERT_QUICK(indices.size() % 3 == 0);
+        return indices.data();
     }
 
     void PolygonShape::updateVerticesLocal() const
@@ -126,13 +206,10 @@ namespace Renderer2D
                 std::reverse(m_verticesLocal.begin(), m_verticesLocal.end());
                 m_isReversedVerticesLocal = !m_isReversedVerticesLocal;
             }
-            // Triangulate polygon,
-            // filling the indices list with indices of triangles ready to be rendered.
+            // Triangulate polygon, or get a cached triangulation of a polygon with the same vertices,
+            // to be used as indices of triangles ready to be rendered.
+            m_sharedIndices = getTriangulation(m_verticesLocal);
             m_indices.clear();
-            if (!MathUtils::triangulatePolygon(m_verticesLocal, m_indices))
-            {
-                PK_LOG_ERROR("Failed to triangulate a polygon. It's probably a badly defined polygon, possibly self-intersecting.", "Pekan");
-            }
             m_isIndicesTriangleFan = false;
         }
         // Otherwise we can generate triangle fan indices.
@@ -158,6 +235,7 @@ namespace Renderer2D
 #endif
 
             const size_t nVerts = m_verticesLocal.size();
+            m_sharedIndices.reset();
 
             // If we already have some triangle fan indices and they are NOT reversed,
             // we just need to update them with the new number of vertices, extending/shortening the list as needed.
@@ -192,10 +270,7 @@ namespace Renderer2D
             // Calculate world vertex positions by applying the transform matrix to the local vertex positions
             m_verticesWorld[i].position = glm::vec2(worldMatrix * glm::vec3(m_verticesLocal[i], 1.0f));
 
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-            // Set "shapeIndex" attribute to be shape's index
-            m_verticesWorld[i].shapeIndex = m_shapeIndex;
-#else
+#if !PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
             // Set "color" attribute to be shape's color
             m_verticesWorld[i].color = m_color;
 #endif
@@ -207,6 +282,12 @@ namespace Renderer2D
             // If transform's orientation and indices orientation don't match
             if (MathUtils::isOrientationReversedByTransform(transformMatrix) != m_isReversedIndices)
             {
+                // Shared indices are used by other polygons too, so take a copy of them before modifying them
+                if (m_sharedIndices != nullptr)
+                {
+                    m_indices = *m_sharedIndices;
+                    m_sharedIndices.reset();
+                }
                 // "Reverse" indices, flip every triangle
                 for (size_t i = 0; i + 2 < m_indices.size(); i += 3)
                 {
@@ -223,5 +304,43 @@ namespace Renderer2D
         m_needUpdateVerticesWorld = false;
     }
 
+    bool PolygonShape::isTriangulationValidAfterMove(int index, glm::vec2 position) const
+    {
+        const std::vector<unsigned>& indices = getIndicesList();
+        for (size_t i = 0; i + 2 < indices.size(); i += 3)
+        {
+            glm::vec2 a = m_verticesLocal[indices[i]];
+            glm::vec2 b = m_verticesLocal[indices[i + 1]];
+            glm::vec2 c = m_verticesLocal[indices[i + 2]];
+            const float detBefore = MathUtils::getDeterminant(a, b, c);
+
+            // Move the vertex, if it's one of triangle's vertices
+            if (indices[i] == unsigned(index))
+            {
+                a = position;
+            }
+            else if (indices[i + 1] == unsigned(index))
+            {
+                b = position;
+            }
+            else if (indices[i + 2] == unsigned(index))
+            {
+                c = position;
+            }
+            else
+            {
+                continue;
+            }
+            const float detAfter = MathUtils::getDeterminant(a, b, c);
+
+            // If triangle becomes degenerate or flips its orientation, triangulation is no longer valid
+            if (detAfter == 0.0f || (detBefore > 0.0f) != (detAfter > 0.0f))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
 } // namespace Renderer2D
 } // namespace Renderer2D
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include <glm/glm.hpp>
 #include <vector>
+#include <memory>
 
 namespace Pekan
 {
@@ -21,18 +22,15 @@ namespace Renderer2D
 
 		// Sets vertices of polygon, in local space
 		void setVertices(const std::vector<glm::vec2>& vertices);
-		// Sets a specific vertex of polygon, in local space
+		// Sets a specific vertex of polygon, in local space.
+		// If polygon's current triangulation stays valid with the vertex moved, it's reused instead of triangulating again.
 		void setVertex(int index, glm::vec2 vertex);
 
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-		const Vertex2D* getVertices(float shapeIndex) const override;
-#else
 		const Vertex2D* getVertices() const override;
-#endif
 		int getVerticesCount() const override { return m_verticesLocal.size(); };
 
 		const unsigned* getIndices() const override;
-		int getIndicesCount() const override { return m_indices.size(); };
+		int getIndicesCount() const override { return getIndicesList().size(); };
 
 	private: /* functions */
 
@@ -41,6 +39,13 @@ namespace Renderer2D
 		// Updates world vertices from current local vertices and current transform matrix
 		void updateVerticesWorld() const;
 
+		// Checks if current triangulation stays valid if a given local vertex is moved to a given position,
+		// which is the case if none of the triangles around the vertex flips its orientation.
+		bool isTriangulationValidAfterMove(int index, glm::vec2 position) const;
+
+		// Returns list of indices currently in use, either shared or owned by the polygon
+		const std::vector<unsigned>& getIndicesList() const { return (m_sharedIndices != nullptr) ? *m_sharedIndices : m_indices; }
+
 	private: /* variables */
 
 		// The vertices (vertex positions) of the polygon, in local space
@@ -50,6 +55,9 @@ namespace Renderer2D
 
 		// Indices into the vertices list, making up the triangles of the triangulated polygon.
 		mutable std::vector<unsigned> m_indices;
+		// Indices of a concave polygon's triangulation, shared between all polygons with exactly the same local vertices.
+		// If set, they are used instead of m_indices.
+		mutable std::shared_ptr<const std::vector<unsigned>> m_sharedIndices;
 
 		// Flag indicating if local vertices need to be updated before use
 		mutable bool m_needUpdateVerticesLocal = true;
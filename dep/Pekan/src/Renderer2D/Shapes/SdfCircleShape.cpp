@@ -0,0 +1,52 @@
+#include "SdfCircleShape.h"
+
+#if PEKAN_ENABLE_2D_SDF_SHAPES
+
+#include "PekanLogger.h"
+#include "Utils/PekanUtils.h"
+
+namespace Pekan
+{
+namespace Renderer2D
+{
+
+    void SdfCircleShape::create(float radius, float ringThickness)
+    {
+        PK_ASSERT(radius > 0.0f, "SdfCircleShape's radius must be greater than 0.", "Pekan");
+        PK_ASSERT(ringThickness >= 0.0f, "SdfCircleShape's ring thickness must be greater than or equal to 0.", "Pekan");
+
+        Shape::_create();
+
+        m_radius = radius;
+        m_ringThickness = ringThickness;
+        updateBox();
+    }
+
+    void SdfCircleShape::setRadius(float radius)
+    {
+        PK_ASSERT(isValid(), "Trying to set radius of an SdfCircleShape that is not yet created.", "Pekan");
+        PK_ASSERT(radius > 0.0f, "SdfCircleShape's radius must be greater than 0.", "Pekan");
+
+        m_radius = radius;
+        updateBox();
+    }
+
+    void SdfCircleShape::setRingThickness(float ringThickness)
+    {
+        PK_ASSERT(isValid(), "Trying to set ring thickness of an SdfCircleShape that is not yet created.", "Pekan");
+        PK_ASSERT(ringThickness >= 0.0f, "SdfCircleShape's ring thickness must be greater than or equal to 0.", "Pekan");
+
+        m_ringThickness = ringThickness;
+        updateBox();
+    }
+
+    void SdfCircleShape::updateBox()
+    {
+        // A circle is a square box with corner radius equal to half of its side
+        SdfShape::_setBox({ 0.0f, 0.0f }, { 1.0f, 0.0f }, { m_radius, m_radius }, m_radius, m_ringThickness);
+    }
+
+} // namespace Renderer2D
+} // namespace Pekan
+
+#endif
\ No newline at end of file
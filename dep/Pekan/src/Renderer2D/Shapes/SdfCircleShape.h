@@ -0,0 +1,47 @@
+#pragma once
+
+#include "SdfShape.h"
+
+#if PEKAN_ENABLE_2D_SDF_SHAPES
+
+namespace Pekan
+{
+namespace Renderer2D
+{
+
+	// A class representing a 2D circle, or a ring, with a solid color,
+	// rendered as a single quad with a signed distance field.
+	//
+	// NOTE: Unlike CircleShape, it has no segments, so it's perfectly round at any size, with only 4 vertices.
+	class SdfCircleShape : public SdfShape
+	{
+	public:
+
+		// Creates a circle shape with given radius.
+		// If ring thickness is greater than 0, the circle is hollowed out into a ring of that thickness.
+		void create(float radius, float ringThickness = 0.0f);
+		void destroy() { Shape::_destroy(); }
+
+		void setRadius(float radius);
+		void setRingThickness(float ringThickness);
+
+		inline float getRadius() const { return m_radius; }
+		inline float getRingThickness() const { return m_ringThickness; }
+
+	private: /* functions */
+
+		// Updates the box making up the shape from current radius and ring thickness
+		void updateBox();
+
+	private: /* variables */
+
+		// Radius of circle, in local space
+		float m_radius = -1.0f;
+		// Thickness of the ring, in local space, or 0 for a solid circle
+		float m_ringThickness = 0.0f;
+	};
+
+} // namespace Renderer2D
+} // namespace Pekan
+
+#endif
\ No newline at end of file
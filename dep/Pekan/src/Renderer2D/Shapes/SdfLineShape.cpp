@@ -0,0 +1,62 @@
+#include "SdfLineShape.h"
+
+#if PEKAN_ENABLE_2D_SDF_SHAPES
+
+#include "PekanLogger.h"
+#include "Utils/PekanUtils.h"
+
+namespace Pekan
+{
+namespace Renderer2D
+{
+
+    void SdfLineShape::create(glm::vec2 pointA, glm::vec2 pointB, float thickness)
+    {
+        PK_ASSERT(thickness > 0.0f, "SdfLineShape's thickness must be greater than 0.", "Pekan");
+
+        Shape::_create();
+
+        m_pointA = pointA;
+        m_pointB = pointB;
+        m_thickness = thickness;
+        updateBox();
+    }
+
+    void SdfLineShape::setPointA(glm::vec2 pointA)
+    {
+        PK_ASSERT(isValid(), "Trying to set point A of an SdfLineShape that is not yet created.", "Pekan");
+        m_pointA = pointA;
+        updateBox();
+    }
+
+    void SdfLineShape::setPointB(glm::vec2 pointB)
+    {
+        PK_ASSERT(isValid(), "Trying to set point B of an SdfLineShape that is not yet created.", "Pekan");
+        m_pointB = pointB;
+        updateBox();
+    }
+
+    void SdfLineShape::setThickness(float thickness)
+    {
+        PK_ASSERT(isValid(), "Trying to set thickness of an SdfLineShape that is not yet created.", "Pekan");
+        PK_ASSERT(thickness >= 0.0f, "SdfLineShape's thickness must be greater than or equal to 0.", "Pekan");
+
+        m_thickness = thickness;
+        updateBox();
+    }
+
+    void SdfLineShape::updateBox()
+    {
+        // A line with round caps is a capsule - a box going from A to B, extended by half of line's thickness on each side,
+        // with corner radius equal to half of line's thickness.
+        const glm::vec2 ab = m_pointB - m_pointA;
+        const float length = glm::length(ab);
+        const glm::vec2 axisX = (length > 0.0f) ? ab / length : glm::vec2(1.0f, 0.0f);
+        const float radius = m_thickness / 2.0f;
+        SdfShape::_setBox((m_pointA + m_pointB) / 2.0f, axisX, { length / 2.0f + radius, radius }, radius, 0.0f);
+    }
+
+} // namespace Renderer2D
+} // namespace Pekan
+
+#endif
\ No newline at end of file
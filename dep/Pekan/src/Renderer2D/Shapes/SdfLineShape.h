@@ -0,0 +1,51 @@
+#pragma once
+
+#include "SdfShape.h"
+
+#if PEKAN_ENABLE_2D_SDF_SHAPES
+
+namespace Pekan
+{
+namespace Renderer2D
+{
+
+	// A class representing a 2D line between two points, with round caps,
+	// rendered as a single quad with a signed distance field.
+	//
+	// NOTE: Unlike LineShape, line's ends are rounded, and its edges are smooth even without MSAA.
+	class SdfLineShape : public SdfShape
+	{
+	public:
+
+		// Creates a line between 2 points.
+		void create(glm::vec2 pointA, glm::vec2 pointB, float thickness = 0.002f);
+		void destroy() { Shape::_destroy(); }
+
+		// Sets point A/B of the line, in local space
+		void setPointA(glm::vec2 pointA);
+		void setPointB(glm::vec2 pointB);
+		// Sets line's thickness
+		void setThickness(float thickness);
+
+		// Returns point A/B of the line, in local space
+		glm::vec2 getPointA() const { return m_pointA; }
+		glm::vec2 getPointB() const { return m_pointB; }
+		// Returns line's thickness
+		float getThickness() const { return m_thickness; }
+
+	private: /* functions */
+
+		// Updates the box making up the shape from current point A, point B and thickness
+		void updateBox();
+
+	private: /* variables */
+
+		glm::vec2 m_pointA = glm::vec2(0.0f, 0.0f);
+		glm::vec2 m_pointB = glm::vec2(0.0f, 0.0f);
+		float m_thickness = -1.0f;
+	};
+
+} // namespace Renderer2D
+} // namespace Pekan
+
+#endif
\ No newline at end of file
@@ -0,0 +1,67 @@
+#include "SdfRectangleShape.h"
+
+#if PEKAN_ENABLE_2D_SDF_SHAPES
+
+#include "PekanLogger.h"
+#include "Utils/PekanUtils.h"
+
+#include <algorithm>
+
+namespace Pekan
+{
+namespace Renderer2D
+{
+
+    void SdfRectangleShape::create(float width, float height, float cornerRadius)
+    {
+        PK_ASSERT(width >= 0.0f, "SdfRectangleShape's width must be greater than or equal to 0.", "Pekan");
+        PK_ASSERT(height >= 0.0f, "SdfRectangleShape's height must be greater than or equal to 0.", "Pekan");
+        PK_ASSERT(cornerRadius >= 0.0f, "SdfRectangleShape's corner radius must be greater than or equal to 0.", "Pekan");
+
+        Shape::_create();
+
+        m_width = width;
+        m_height = height;
+        m_cornerRadius = cornerRadius;
+        updateBox();
+    }
+
+    void SdfRectangleShape::setWidth(float width)
+    {
+        PK_ASSERT(isValid(), "Trying to set width of an SdfRectangleShape that is not yet created.", "Pekan");
+        PK_ASSERT(width >= 0.0f, "SdfRectangleShape's width must be greater than or equal to 0.", "Pekan");
+
+        m_width = width;
+        updateBox();
+    }
+
+    void SdfRectangleShape::setHeight(float height)
+    {
+        PK_ASSERT(isValid(), "Trying to set height of an SdfRectangleShape that is not yet created.", "Pekan");
+        PK_ASSERT(height >= 0.0f, "SdfRectangleShape's height must be greater than or equal to 0.", "Pekan");
+
+        m_height = height;
+        updateBox();
+    }
+
+    void SdfRectangleShape::setCornerRadius(float cornerRadius)
+    {
+        PK_ASSERT(isValid(), "Trying to set corner radius of an SdfRectangleShape that is not yet created.", "Pekan");
+        PK_ASSERT(cornerRadius >= 0.0f, "SdfRectangleShape's corner radius must be greater than or equal to 0.", "Pekan");
+
+        m_cornerRadius = cornerRadius;
+        updateBox();
+    }
+
+    void SdfRectangleShape::updateBox()
+    {
+        const glm::vec2 halfSize = glm::vec2(m_width, m_height) / 2.0f;
+        // Corner radius can't be more than half of the smaller side, otherwise corners would overlap
+        const float cornerRadius = std::min(m_cornerRadius, std::min(halfSize.x, halfSize.y));
+        SdfShape::_setBox({ 0.0f, 0.0f }, { 1.0f, 0.0f }, halfSize, cornerRadius, 0.0f);
+    }
+
+} // namespace Renderer2D
+} // namespace Pekan
+
+#endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "SdfShape.h"
+
+#if PEKAN_ENABLE_2D_SDF_SHAPES
+
+namespace Pekan
+{
+namespace Renderer2D
+{
+
+	// A class representing a 2D rectangle with optionally rounded corners and a solid color,
+	// rendered as a single quad with a signed distance field.
+	class SdfRectangleShape : public SdfShape
+	{
+	public:
+
+		// Creates a rectangle shape with given width and height, and given radius of its corners.
+		void create(float width, float height, float cornerRadius = 0.0f);
+		void destroy() { Shape::_destroy(); }
+
+		void setWidth(float width);
+		void setHeight(float height);
+		// Sets radius of rectangle's corners.
+		// It's clamped to half of rectangle's smaller side.
+		void setCornerRadius(float cornerRadius);
+
+		inline float getWidth() const { return m_width; }
+		inline float getHeight() const { return m_height; }
+		inline float getCornerRadius() const { return m_cornerRadius; }
+
+	private: /* functions */
+
+		// Updates the box making up the shape from current width, height and corner radius
+		void updateBox();
+
+	private: /* variables */
+
+		// Width of rectangle, size across the X axis in local space
+		float m_width = -1.0f;
+		// Height of rectangle, size across the Y axis in local space
+		float m_height = -1.0f;
+		// Radius of rectangle's corners, in local space
+		float m_cornerRadius = 0.0f;
+	};
+
+} // namespace Renderer2D
+} // namespace Pekan
+
+#endif
\ No newline at end of file
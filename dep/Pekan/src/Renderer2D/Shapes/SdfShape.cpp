@@ -0,0 +1,112 @@
+#include "SdfShape.h"
+
+#if PEKAN_ENABLE_2D_SDF_SHAPES
+
+#include "PekanLogger.h"
+#include "Utils/PekanUtils.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Pekan
+{
+namespace Renderer2D
+{
+
+    const unsigned SdfShape::s_indices[6] = { 0, 1, 2, 0, 2, 3 };
+
+    const Vertex2D* SdfShape::getVertices() const
+    {
+        PK_ASSERT(isValid(), "Trying to get vertices of an SdfShape that is not yet created.", "Pekan");
+
+        if (m_transformChangeIdUsedInVerticesWorld < Transformable2D::getChangeId())
+        {
+            m_needUpdateVerticesWorld = true;
+        }
+
+        if (m_needUpdateVerticesWorld)
+        {
+            updateVerticesWorld();
+        }
+        return m_verticesWorld;
+    }
+
+    void SdfShape::_setBox(glm::vec2 center, glm::vec2 axisX, glm::vec2 halfSize, float cornerRadius, float ringThickness)
+    {
+        PK_ASSERT(isValid(), "Trying to set box of an SdfShape that is not yet created.", "Pekan");
+
+        m_boxCenter = center;
+        m_boxAxisX = axisX;
+        m_sdfParameters = glm::vec4(halfSize, cornerRadius, ringThickness);
+
+        updateVerticesLocal();
+    }
+
+    void SdfShape::selectLevelOfDetail(float pixelsPerWorldUnit, float tolerance) const
+    {
+        // Get the size of a pixel in local space, scaling it by the smaller scale of shape's transform,
+        // which is the direction where a pixel covers the most of local space
+        const glm::mat3& worldMatrix = getWorldMatrix();
+        const float scale = std::min(glm::length(glm::vec2(worldMatrix[0])), glm::length(glm::vec2(worldMatrix[1])));
+        if (scale <= 0.0f || pixelsPerWorldUnit <= 0.0f)
+        {
+            return;
+        }
+        const float pixelSize = 1.0f / (scale * pixelsPerWorldUnit);
+
+        // Inflate the quad by a pixel, rounded up to a power of 2 so that zooming doesn't rebuild the quad every frame
+        const float margin = std::exp2(std::ceil(std::log2(pixelSize)));
+        if (margin != m_margin)
+        {
+            m_margin = margin;
+            updateVerticesLocal();
+        }
+    }
+
+    void SdfShape::updateVerticesLocal() const
+    {
+        const glm::vec2 axisY = glm::vec2(-m_boxAxisX.y, m_boxAxisX.x);
+        const glm::vec2 halfSize = glm::vec2(m_sdfParameters.x, m_sdfParameters.y) + m_margin;
+
+        // Quad's vertices are box's corners, pushed outwards by the margin, in CCW order
+        m_boxCoordinates[0] = glm::vec2(-halfSize.x, -halfSize.y);
+        m_boxCoordinates[1] = glm::vec2(halfSize.x, -halfSize.y);
+        m_boxCoordinates[2] = glm::vec2(halfSize.x, halfSize.y);
+        m_boxCoordinates[3] = glm::vec2(-halfSize.x, halfSize.y);
+        for (int i = 0; i < 4; i++)
+        {
+            m_verticesLocal[i] = m_boxCenter + m_boxAxisX * m_boxCoordinates[i].x + axisY * m_boxCoordinates[i].y;
+        }
+
+        m_needUpdateVerticesWorld = true;
+    }
+
+    void SdfShape::updateVerticesWorld() const
+    {
+        PK_ASSERT(isValid(), "Trying to update world vertices of an SdfShape that is not yet created.", "Pekan");
+
+        const glm::mat3& worldMatrix = getWorldMatrix();
+        for (int i = 0; i < 4; i++)
+        {
+            // Calculate world vertex positions by applying the transform matrix to the local vertex positions
+            m_verticesWorld[i].position = glm::vec2(worldMatrix * glm::vec3(m_verticesLocal[i], 1.0f));
+            // Pass box coordinates and SDF parameters to the fragment shader
+            m_verticesWorld[i].textureCoordinates = m_boxCoordinates[i];
+            m_verticesWorld[i].sdfParameters = m_sdfParameters;
+
+#if !PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
+            // Set "color" attribute to be shape's color
+            m_verticesWorld[i].color = m_color;
+#endif
+        }
+
+        // Cache change ID of the transform that we just used to update world vertices
+        m_transformChangeIdUsedInVerticesWorld = Transformable2D::getChangeId();
+
+        m_needUpdateVerticesWorld = false;
+    }
+
+} // namespace Renderer2D
+} // namespace Pekan
+
+#endif
\ No newline at end of file
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Shape.h"
+
+#include <glm/glm.hpp>
+
+#if PEKAN_ENABLE_2D_SDF_SHAPES
+
+namespace Pekan
+{
+namespace Renderer2D
+{
+
+	// A base class for 2D shapes rendered as a single quad,
+	// whose fragment shader evaluates shape's signed distance field and anti-aliases its edges.
+	//
+	// Every SDF shape is a rounded box, optionally hollowed out into a ring,
+	// so circles, rings, rounded rectangles and capsule lines are all different parameters of it.
+	// No matter how round the shape is, it has only 4 vertices, and its edges are smooth even without MSAA.
+	class SdfShape : public Shape
+	{
+	public:
+
+		const Vertex2D* getVertices() const override;
+		int getVerticesCount() const override { return 4; };
+
+		const unsigned* getIndices() const override { return s_indices; }
+		int getIndicesCount() const override { return 6; };
+
+		// SDF shapes are never opaque, because their anti-aliased edges are blended with what's behind them
+		bool isOpaque() const override { return false; }
+
+	protected: /* functions */
+
+		// Sets the rounded box making up the shape, in local space.
+		//
+		// @param[in] center - Center of the box
+		// @param[in] axisX - Direction of box's X axis, must be normalized
+		// @param[in] halfSize - Half of box's size along its X axis and its Y axis
+		// @param[in] cornerRadius - Radius of box's corners, at most half of box's smaller side
+		// @param[in] ringThickness - Thickness of the ring that the box is hollowed out into, or 0 for a solid box
+		//
+		// NOTE: To be used by derived classes whenever their parameters change.
+		void _setBox(glm::vec2 center, glm::vec2 axisX, glm::vec2 halfSize, float cornerRadius, float ringThickness);
+
+		// Picks the margin that the quad is inflated by, so that it stays at least a pixel wide at shape's current size on screen
+		void selectLevelOfDetail(float pixelsPerWorldUnit, float tolerance) const override;
+
+	private: /* functions */
+
+		// Updates local vertices and box coordinates from current box and current margin
+		void updateVerticesLocal() const;
+		// Updates world vertices from current local vertices and current transform matrix
+		void updateVerticesWorld() const;
+
+	private: /* variables */
+
+		// The 4 vertices (vertex positions) of the quad, in local space
+		mutable glm::vec2 m_verticesLocal[4] = {};
+		// The 4 vertices of the quad, in world space
+		mutable Vertex2D m_verticesWorld[4];
+
+		// Coordinates of quad's vertices relative to box's center, along box's axes.
+		// Interpolated across the quad, they give the point where the signed distance is evaluated.
+		mutable glm::vec2 m_boxCoordinates[4] = {};
+
+		// Center of the box, in local space
+		glm::vec2 m_boxCenter = glm::vec2(0.0f, 0.0f);
+		// Direction of box's X axis, in local space
+		glm::vec2 m_boxAxisX = glm::vec2(1.0f, 0.0f);
+
+		// Margin that the quad extends beyond the box on each side, in local space.
+		// The outer half of the anti-aliased edge lies outside of the box, so without it that half would never be rasterized.
+		// Mutable because it's picked when level of detail is selected.
+		mutable float m_margin = 0.0f;
+		// Half width, half height, corner radius and ring thickness of the box
+		glm::vec4 m_sdfParameters = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+
+		// Indices of vertices of the 2 triangles making up the quad
+		static const unsigned s_indices[6];
+	};
+
+} // namespace Renderer2D
+} // namespace Pekan
+
+#endif
\ No newline at end of file
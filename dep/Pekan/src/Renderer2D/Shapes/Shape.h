@@ -14,6 +14,8 @@ namespace Renderer2D
 	// A base class for 2D shapes
 	class Shape : public Transformable2D
 	{
+		friend class Renderer2DSystem;
+
 	public:
 
 		void render() const;
@@ -23,14 +25,19 @@ namespace Renderer2D
 		// Sets shape's color
 		void setColor(glm::vec4 color);
 
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-		// To be implemented by derived classes to return their vertex data in world space.
-		// @param[in] shapeIndex - Shape's index inside of its batch. Determines the value of the "shapeIndex" attribute of shape's vertices
-		virtual const Vertex2D* getVertices(float shapeIndex) const = 0;
-#else
+		// Returns shape's layer
+		int getLayer() const { return m_layer; }
+		// Sets shape's layer.
+		// When Renderer2DSystem sorts primitives, ones in higher layers are drawn over ones in lower layers,
+		// and opaque primitives in the same layer can be drawn in any order.
+		// Translucent primitives in the same layer are drawn in the order they are submitted.
+		// Layer must be in the range from -32768 to 32767.
+		void setLayer(int layer) { m_layer = layer; }
+
 		// To be implemented by derived classes to return their vertex data in world space.
+		// Vertices don't depend on the batch that shape is in. When shapes are batched with a 1D texture,
+		// the batch sets the "shapeIndex" attribute on its own copy of the vertices.
 		virtual const Vertex2D* getVertices() const = 0;
-#endif
 		// To be implemented by derived classes to return the number of their vertices.
 		virtual int getVerticesCount() const = 0;
 
@@ -39,6 +46,19 @@ namespace Renderer2D
 		// Can be overriden by derived classes to return the number of their indices, if indices are used at all.
 		virtual int getIndicesCount() const { return 0; }
 
+		// Checks if shape is opaque, meaning that it completely covers everything behind it.
+		// Can be overriden by derived classes whose edges are blended with what's behind them.
+		//
+		// NOTE: With analytic edge anti-aliasing, edges of all shapes are blended, so no shape is opaque.
+		virtual bool isOpaque() const
+		{
+#if PEKAN_ENABLE_2D_ANALYTIC_EDGE_ANTI_ALIASING
+			return false;
+#else
+			return m_color.a >= 1.0f;
+#endif
+		}
+
 		// Checks if shape is valid, meaning that it has been created and not yet destroyed
 		bool isValid() const { return m_isValid; }
 
@@ -55,6 +75,13 @@ namespace Renderer2D
 		//       To be used by derived classes' create() function.
 		void _destroy();
 
+		// Can be overriden by derived classes to adapt their level of detail to their size on screen.
+		// Called by Renderer2DSystem when the shape is submitted for rendering.
+		//
+		// @param[in] pixelsPerWorldUnit - Number of pixels that a unit of world space covers on screen, with current camera
+		// @param[in] tolerance - Maximum allowed distance between the shape and its approximation, in pixels
+		virtual void selectLevelOfDetail(float pixelsPerWorldUnit, float tolerance) const {}
+
 	protected: /* variables*/
 
 		// Flag indicating if world vertices in derived class need to be updated before use
@@ -65,20 +92,8 @@ namespace Renderer2D
 
 		glm::vec4 m_color = glm::vec4(-1.0f, -1.0f, -1.0f, -1.0f);
 
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-		// Shape's index inside of its batch.
-		// To be used by derived classes to set each vertex's "shapeIndex" attribute.
-		//
-		// NOTE: Marked as "mutable" because it doesn't reflect a shape's state exactly.
-		// It reflects the state of "a shape inside a batch".
-		// We want to be able to change a shape's index in a "const" way
-		// because it doesn't change the actual shape.
-		// This can, of course, be avoided by letting a Shape be "just a shape"
-		// and return only its actual vertices without any batch-related metadata,
-		// but it would be inefficient, because then a batch will have to copy all vertices
-		// in order to add the "shapeIndex" attribute to them.
-		mutable float m_shapeIndex = -1.0f;
-#endif
+		// Layer that shape is drawn in, when Renderer2DSystem sorts primitives
+		int m_layer = 0;
 
 	private: /* variables */
 
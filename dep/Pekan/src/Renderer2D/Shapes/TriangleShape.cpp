@@ -76,23 +76,10 @@ namespace Renderer2D
 #endif
     }
 
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-    const Vertex2D* TriangleShape::getVertices(float shapeIndex) const
-#else
     const Vertex2D* TriangleShape::getVertices() const
-#endif
     {
         PK_ASSERT(isValid(), "Trying to get vertices of a TriangleShape that is not yet created.", "Pekan");
 
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-        PK_ASSERT(shapeIndex >= 0.0f, "Trying to get vertices of a Shape but giving it a negative shape index.", "Pekan");
-        if (m_shapeIndex != shapeIndex)
-        {
-            m_shapeIndex = shapeIndex;
-            m_needUpdateVerticesWorld = true;
-        }
-#endif
-
         if (m_transformChangeIdUsedInVerticesWorld < Transformable2D::getChangeId())
         {
             m_needUpdateVerticesWorld = true;
@@ -165,12 +152,7 @@ namespace Renderer2D
         m_verticesWorld[1].position = glm::vec2(worldMatrix * glm::vec3(m_verticesLocal[1], 1.0f));
         m_verticesWorld[2].position = glm::vec2(worldMatrix * glm::vec3(m_verticesLocal[2], 1.0f));
 
-#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-        // Set "shapeIndex" attribute of each vertex to be shape's index
-        m_verticesWorld[0].shapeIndex = m_shapeIndex;
-        m_verticesWorld[1].shapeIndex = m_shapeIndex;
-        m_verticesWorld[2].shapeIndex = m_shapeIndex;
-#else
+#if !PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
         // Set "color" attribute of each vertex to be shape's color
         m_verticesWorld[0].color = m_color;
         m_verticesWorld[1].color = m_color;
@@ -116,16 +116,9 @@ namespace Renderer2D
         return m_textureCoordinatesMax;
     }
 
-    const Vertex2D* Sprite::getVertices(float textureIndex) const
+    const Vertex2D* Sprite::getVertices() const
     {
         PK_ASSERT(isValid(), "Trying to get vertices of a Sprite that is not yet created.", "Pekan");
-        PK_ASSERT(textureIndex >= 0.0f, "Trying to get vertices of a Sprite but giving it a negative texture index.", "Pekan");
-
-        if (m_textureIndex != textureIndex)
-        {
-            m_textureIndex = textureIndex;
-            m_needUpdateVerticesWorld = true;
-        }
 
         if (m_transformChangeIdUsedInVerticesWorld < Transformable2D::getChangeId())
         {
@@ -180,13 +173,13 @@ namespace Renderer2D
         m_verticesWorld[2].textureCoordinates = { m_textureCoordinatesMax.x, m_textureCoordinatesMax.y };
         m_verticesWorld[3].textureCoordinates = { m_textureCoordinatesMin.x, m_textureCoordinatesMax.y };
 
-        PK_ASSERT(m_textureIndex >= 0.0f, "Trying to update world vertices of a Sprite but texture index is negative.", "Pekan");
-
-        // Set "textureIndex" attribute of each vertex
-        m_verticesWorld[0].textureIndex = float(m_textureIndex);
-        m_verticesWorld[1].textureIndex = float(m_textureIndex);
-        m_verticesWorld[2].textureIndex = float(m_textureIndex);
-        m_verticesWorld[3].textureIndex = float(m_textureIndex);
+#if PEKAN_ENABLE_2D_ANALYTIC_EDGE_ANTI_ALIASING
+        // Set "edgeCoordinates" attribute of each vertex to be its corner of the quad
+        m_verticesWorld[0].edgeCoordinates = { 0.0f, 0.0f };
+        m_verticesWorld[1].edgeCoordinates = { 1.0f, 0.0f };
+        m_verticesWorld[2].edgeCoordinates = { 1.0f, 1.0f };
+        m_verticesWorld[3].edgeCoordinates = { 0.0f, 1.0f };
+#endif
 
         // Cache change ID of the transform that we just used to update world vertices
         m_transformChangeIdUsedInVerticesWorld = Transformable2D::getChangeId();
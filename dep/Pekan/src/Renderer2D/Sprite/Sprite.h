@@ -52,9 +52,25 @@ namespace Renderer2D
 		glm::vec2 getTextureCoordinatesMin();
 		glm::vec2 getTextureCoordinatesMax();
 
-		// Returns sprite's vertex data, in world space
-		// @param[in] textureIndex - Index of sprite's texture inside of sprite's batch. Determines the value of the "textureIndex" attribute of sprite's vertices
-		const Vertex2D* getVertices(float textureIndex) const;
+		// Returns sprite's layer
+		int getLayer() const { return m_layer; }
+		// Sets sprite's layer.
+		// When Renderer2DSystem sorts primitives, ones in higher layers are drawn over ones in lower layers,
+		// and opaque primitives in the same layer can be drawn in any order.
+		// Translucent primitives in the same layer are drawn in the order they are submitted.
+		// Layer must be in the range from -32768 to 32767.
+		void setLayer(int layer) { m_layer = layer; }
+
+		// Checks if sprite is opaque, meaning that its texture has no translucent pixels
+		bool isOpaque() const { return m_isOpaque; }
+		// Marks sprite as opaque, meaning that its texture has no translucent pixels,
+		// so that Renderer2DSystem can reorder it with other opaque primitives in the same layer, to group sprites by texture.
+		// Sprites are NOT opaque by default, because textures usually have translucent pixels.
+		void setOpaque(bool isOpaque) { m_isOpaque = isOpaque; }
+
+		// Returns sprite's vertex data, in world space.
+		// Vertices don't depend on the batch that sprite is in. The batch sets the "textureIndex" attribute on its own copy of the vertices.
+		const Vertex2D* getVertices() const;
 
 		// Checks if sprite is valid, meaning that it has been created and not yet destroyed
 		bool isValid() const { return m_isValid; }
@@ -82,6 +98,11 @@ namespace Renderer2D
 		glm::vec2 m_textureCoordinatesMin = { 0.0f, 0.0f };
 		glm::vec2 m_textureCoordinatesMax = { 1.0f, 1.0f };
 
+		// Layer that sprite is drawn in, when Renderer2DSystem sorts primitives
+		int m_layer = 0;
+		// Flag indicating if sprite's texture has no translucent pixels
+		bool m_isOpaque = false;
+
 		// The 4 vertices (vertex positions) of the sprite, in local space
 		mutable glm::vec2 m_verticesLocal[4] = {};
 		// The 4 vertices of the sprite, in world space.
@@ -95,18 +116,6 @@ namespace Renderer2D
 		// Change ID of transform used in currently cached world vertices
 		mutable unsigned m_transformChangeIdUsedInVerticesWorld = 0;
 
-		// Sprite's texture's index inside of its batch.
-		//
-		// NOTE: Marked as "mutable" because it doesn't reflect a sprite's state exactly.
-		// It reflects the state of "a sprite inside a batch".
-		// We want to be able to change a sprite's index in a "const" way
-		// because it doesn't change the actual sprite.
-		// This can, of course, be avoided by letting a Sprite be "just a sprite"
-		// and return only its actual vertices without any batch-related metadata,
-		// but it would be inefficient, because then a batch will have to copy all vertices
-		// in order to add the "textureIndex" attribute to them.
-		mutable float m_textureIndex = -1.0f;
-
 		// Flag indicating if sprite is valid, meaning that it has been created and not yet destroyed
 		bool m_isValid = false;
 	};
@@ -10,18 +10,69 @@ namespace Renderer2D
 	{
 		// Position of the vertex, in world space
 		glm::vec2 position = { -1.0f, -1.0f };
-		// Coordinates in texture space that this vertex maps to, if applicable
+		// Coordinates in texture space that this vertex maps to, if applicable.
+		// For vertices of SDF shapes, these are instead coordinates in shape's local space, relative to shape's center.
 		glm::vec2 textureCoordinates = { -1.0f, -1.0f };
-		// Index of the texture to be used for this vertex, if applicable
+		// Index of the texture to be used for this vertex, if applicable.
+		// Set by the render batch that vertex is added to.
 		float textureIndex = -1.0f;
 #if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
-		// Index of the shape that this vertex belongs to, if applicable
+		// Index of the shape that this vertex belongs to, if applicable.
+		// Set by the render batch that vertex is added to.
 		float shapeIndex = -1.0f;
 #else
 		// Color of this vertex
 		glm::vec4 color = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+#endif
+#if PEKAN_ENABLE_2D_ANALYTIC_EDGE_ANTI_ALIASING
+		// Coordinates of the vertex inside of its quad, going from 0 to 1 across the quad, used to anti-alias quad's edges.
+		// Vertices that are not part of a quad keep the default value of 0.5 which disables anti-aliasing.
+		glm::vec2 edgeCoordinates = { 0.5f, 0.5f };
+#endif
+#if PEKAN_ENABLE_2D_SDF_SHAPES
+		// Parameters of the signed distance field evaluated by the fragment shader, if vertex is part of an SDF shape:
+		// half width, half height, corner radius and ring thickness of a rounded box.
+		// Vertices that are not part of an SDF shape keep the default negative value which disables SDF evaluation.
+		glm::vec4 sdfParameters = { -1.0f, -1.0f, -1.0f, -1.0f };
 #endif
 	};
 
+#if PEKAN_USE_PACKED_2D_VERTICES
+	// A vertex of a 2D primitive, packed into a compact format to be uploaded to the GPU.
+	// Primitives always give their vertices as Vertex2D, and a render batch packs them when they are added to it.
+	struct PackedVertex2D
+	{
+		// Position of the vertex, in world space
+		glm::vec2 position = { 0.0f, 0.0f };
+		// Texture coordinates as 16-bit normalized integers.
+		// Texture coordinates outside of the range from 0 to 1 are scaled down by a power of 2,
+		// and negative texture coordinates are mapped from the range from -1 to 1.
+		unsigned short textureCoordinates[2] = { 0, 0 };
+		// Index of the texture, or 255 if there is no texture
+		unsigned char textureIndex = 255;
+		// Exponent of the power of 2 that texture coordinates are scaled down by
+		unsigned char textureCoordinatesExponent = 0;
+		// 1 if texture coordinates are mapped from the range from -1 to 1, 0 if they are not
+		unsigned char isTextureCoordinatesSigned = 0;
+		unsigned char padding = 0;
+#if PEKAN_USE_1D_TEXTURE_FOR_2D_SHAPES_BATCH
+		// Index of the shape that this vertex belongs to, if applicable
+		float shapeIndex = -1.0f;
+#else
+		// Color of this vertex, as 8-bit normalized integers
+		unsigned char color[4] = { 255, 255, 255, 255 };
+#endif
+#if PEKAN_ENABLE_2D_ANALYTIC_EDGE_ANTI_ALIASING
+		// Coordinates of the vertex inside of its quad, as 16-bit normalized integers
+		unsigned short edgeCoordinates[2] = { 32768, 32768 };
+#endif
+#if PEKAN_ENABLE_2D_SDF_SHAPES
+		// Parameters of the signed distance field, as 16-bit floats because they are in local units of any magnitude.
+		// Default value is -1 in every component, which disables SDF evaluation.
+		unsigned short sdfParameters[4] = { 0xBC00, 0xBC00, 0xBC00, 0xBC00 };
+#endif
+	};
+#endif
+
 } // namespace Renderer2D
 } // namespace Pekan
\ No newline at end of file
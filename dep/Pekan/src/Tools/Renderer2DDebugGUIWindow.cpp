@@ -0,0 +1,121 @@
+#include "Renderer2DDebugGUIWindow.h"
+
+#include "Renderer2DSystem.h"
+#include "SeparatorWidget.h"
+
+using namespace Pekan::GUI;
+using namespace Pekan::Renderer2D;
+
+namespace Pekan
+{
+namespace Tools
+{
+
+    // Calls a given function with the name and value of each of given stats
+    template<typename Function>
+    static void forEachStat(const RenderStats2D& stats, Function function)
+    {
+        function("Draw calls", double(stats.drawCalls));
+        function("Flushes: out of vertices", double(stats.flushesOutOfVertices));
+        function("Flushes: out of indices", double(stats.flushesOutOfIndices));
+        function("Flushes: out of colors", double(stats.flushesOutOfColors));
+        function("Flushes: out of texture slots", double(stats.flushesOutOfTextureSlots));
+        function("Flushes: state changes", double(stats.flushesForStateChanges));
+        function("Flushes: end of frame", double(stats.flushesAtEndOfFrame));
+        function("Vertices uploaded", double(stats.verticesUploaded));
+        function("Indices uploaded", double(stats.indicesUploaded));
+        function("KB uploaded", double(stats.bytesUploaded) / 1024.0);
+        function("Texture binds", double(stats.textureBinds));
+        function("Uniform sets", double(stats.uniformSets));
+        function("Shapes submitted", double(stats.shapesSubmitted));
+        function("Shapes culled", double(stats.shapesCulled));
+        function("Sprites submitted", double(stats.spritesSubmitted));
+        function("Sprites culled", double(stats.spritesCulled));
+        function("Post-process passes", double(stats.postProcessPasses));
+        function("Overdraw", double(stats.overdraw));
+    }
+
+    bool Renderer2DDebugGUIWindow::init()
+    {
+        m_fpsWidget->create(this);
+        std::make_shared<SeparatorWidget>()->create(this);
+        m_statsWidget->create(this);
+        // Register stats once, so that adding their samples each frame is only a matter of their indices
+        m_statIndices.clear();
+        forEachStat(RenderStats2D(), [this](const char* name, double)
+        {
+            m_statIndices.push_back(m_statsWidget->addStat(name));
+        });
+        applyBudgets();
+        std::make_shared<SeparatorWidget>()->create(this);
+        m_measureOverdrawWidget->create(this, "Measure overdraw", Renderer2DSystem::isOverdrawMeasuringEnabled());
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+        // Items must be in the same order as values of DebugVisualizationMode2D
+        m_visualizationModeWidget->create(this, "Visualization", int(Renderer2DSystem::getDebugVisualizationMode()), { "None", "Overdraw", "Batch IDs" });
+        m_logFlushReasonsWidget->create(this, "Log flush reasons", Renderer2DSystem::isFlushReasonsLoggingEnabled());
+#endif
+
+        return true;
+    }
+
+    void Renderer2DDebugGUIWindow::setBudgets(const RenderStats2D& budgets)
+    {
+        m_budgets = budgets;
+        // If stats are not registered yet, budgets will be applied once they are, in init()
+        if (!m_statIndices.empty())
+        {
+            applyBudgets();
+        }
+    }
+
+    void Renderer2DDebugGUIWindow::applyBudgets()
+    {
+        m_statsWidget->clearBudgets();
+        int i = 0;
+        forEachStat(m_budgets, [this, &i](const char* name, double budget)
+        {
+            if (budget > 0.0)
+            {
+                m_statsWidget->setBudget(m_statIndices[i], budget);
+            }
+            i++;
+        });
+    }
+
+    void Renderer2DDebugGUIWindow::update(double deltaTime)
+    {
+        int i = 0;
+        forEachStat(Renderer2DSystem::getStats(), [this, &i](const char* name, double value)
+        {
+            // Stats that are not measured, like overdraw when its measuring is disabled, are negative
+            if (value >= 0.0)
+            {
+                m_statsWidget->addSample(m_statIndices[i], value);
+            }
+            i++;
+        });
+    }
+
+    void Renderer2DDebugGUIWindow::_render() const
+    {
+        Renderer2DSystem::setOverdrawMeasuringEnabled(m_measureOverdrawWidget->isChecked());
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+        const DebugVisualizationMode2D mode = DebugVisualizationMode2D(m_visualizationModeWidget->getIndex());
+        if (mode != Renderer2DSystem::getDebugVisualizationMode())
+        {
+            Renderer2DSystem::setDebugVisualizationMode(mode);
+        }
+        Renderer2DSystem::setFlushReasonsLoggingEnabled(m_logFlushReasonsWidget->isChecked());
+#endif
+    }
+
+    GUIWindowProperties Renderer2DDebugGUIWindow::getProperties() const
+    {
+        GUIWindowProperties props;
+        props.size = { 460, 620 };
+        props.name = "Renderer2D Debug";
+        return props;
+    }
+
+} // namespace Tools
+} // namespace Pekan
\ No newline at end of file
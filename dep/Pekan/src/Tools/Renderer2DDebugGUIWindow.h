@@ -0,0 +1,71 @@
+#pragma once
+
+#include "GUIWindow.h"
+#include "FPSDisplayWidget.h"
+#include "StatsDisplayWidget.h"
+#include "RenderStats2D.h"
+#include "CheckboxWidget.h"
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+#include "ComboBoxWidget.h"
+#endif
+
+namespace Pekan
+{
+namespace Tools
+{
+
+    // A GUI window for inspecting Renderer2D at runtime:
+    // - FPS
+    // - a table of Renderer2D's stats, see Renderer2DSystem::getStats(), with their min, avg and max over recent frames
+    // - a checkbox enabling measuring of overdraw, shown in the table of stats
+    // - a combo box picking the debug visualization mode - none, overdraw heatmap or batch IDs
+    // - a checkbox enabling logging of why the 2D batch has to be rendered early
+    //
+    // Push it to your application's layer stack, after your scenes, so that it's rendered on top of them.
+    //
+    // NOTE: Debug visualization widgets are available only if Renderer2D is built with PEKAN_ENABLE_2D_DEBUG_VISUALIZATION.
+    class Renderer2DDebugGUIWindow : public GUI::GUIWindow
+    {
+    public:
+
+        Renderer2DDebugGUIWindow(PekanApplication* application) : GUIWindow(application) {}
+
+        std::string getLayerName() const override { return "renderer2d_debug_gui_layer"; }
+
+        // Sets budgets for Renderer2D's stats, for example a different set of budgets for each level.
+        // Stats with a budget of 0 have no budget.
+        void setBudgets(const Renderer2D::RenderStats2D& budgets);
+
+    private: /* functions */
+
+        bool init() override;
+
+        // Sets current budgets to the stats widget
+        void applyBudgets();
+
+        // Adds a sample of each of Renderer2D's stats of the last frame to the stats widget
+        void update(double deltaTime) override;
+
+        // Applies current values of widgets to Renderer2D
+        void _render() const override;
+
+        GUI::GUIWindowProperties getProperties() const override;
+
+    private: /* variables */
+
+        GUI::FPSDisplayWidget_Ptr m_fpsWidget = std::make_shared<GUI::FPSDisplayWidget>();
+        GUI::StatsDisplayWidget_Ptr m_statsWidget = std::make_shared<GUI::StatsDisplayWidget>();
+        GUI::CheckboxWidget_Ptr m_measureOverdrawWidget = std::make_shared<GUI::CheckboxWidget>();
+
+        // Index of each of Renderer2D's stats in the stats widget, in the order they are listed in
+        std::vector<int> m_statIndices;
+        // Budgets for Renderer2D's stats
+        Renderer2D::RenderStats2D m_budgets;
+#if PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+        GUI::ComboBoxWidget_Ptr m_visualizationModeWidget = std::make_shared<GUI::ComboBoxWidget>();
+        GUI::CheckboxWidget_Ptr m_logFlushReasonsWidget = std::make_shared<GUI::CheckboxWidget>();
+#endif
+    };
+
+} // namespace Tools
+} // namespace Pekan
\ No newline at end of file
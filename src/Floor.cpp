@@ -1,6 +1,7 @@
 #include "Floor.h"
 
 #include "PekanLogger.h"
+#include "Layers.h"
 
 using namespace Pekan::Renderer2D;
 
@@ -20,6 +21,7 @@ namespace GleamHouse
 		m_bigWhiteRectangle.create(bigWhiteRectangleSize.x, bigWhiteRectangleSize.y);
 		m_bigWhiteRectangle.setPosition(glm::vec2(bottomLeftPosition) + bigWhiteRectangleSize / 2.0f);
 		m_bigWhiteRectangle.setColor(COLOR_WHITE);
+		m_bigWhiteRectangle.setLayer(LAYER_FLOOR);
 
 		// Create black squares
 		{
@@ -59,6 +61,7 @@ namespace GleamHouse
 					blackSquare.create(1.0f, 1.0f);
 					blackSquare.setPosition({ xCenter, yCenter });
 					blackSquare.setColor(COLOR_BLACK);
+					blackSquare.setLayer(LAYER_FLOOR_BLACK_SQUARES);
 				}
 			}
 			PK_ASSERT_QUICK(blackSquaresCreatedCount == m_blackSquares.size());
@@ -2,6 +2,9 @@
 
 #include "GleamHouse_Scene.h"
 #include "FinishedLevel_Scene.h"
+#if GLEAMHOUSE_WITH_DEBUG_GRAPHICS || PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+#include "Renderer2DDebugGUIWindow.h"
+#endif
 
 #include "PekanEngine.h"
 using Pekan::PekanEngine;
@@ -22,6 +25,18 @@ namespace GleamHouse
 
 		layerStack.pushLayer(mainScene);
 		layerStack.pushLayer(finishedLevelScene);
+#if GLEAMHOUSE_WITH_DEBUG_GRAPHICS || PEKAN_ENABLE_2D_DEBUG_VISUALIZATION
+		// Allow inspecting Renderer2D's stats, and toggling its debug visualizations, at runtime
+		std::shared_ptr<Pekan::Tools::Renderer2DDebugGUIWindow> renderer2DDebugWindow = std::make_shared<Pekan::Tools::Renderer2DDebugGUIWindow>(this);
+		layerStack.pushLayer(renderer2DDebugWindow);
+		// Budgets for the level, so that regressions in how much work it takes to render it stand out
+		Pekan::Renderer2D::RenderStats2D levelBudgets;
+		levelBudgets.drawCalls = 16;
+		levelBudgets.bytesUploaded = 512 * 1024;
+		levelBudgets.textureBinds = 32;
+		levelBudgets.postProcessPasses = 4;
+		renderer2DDebugWindow->setBudgets(levelBudgets);
+#endif
 
 		return true;
 	}
@@ -32,7 +47,6 @@ namespace GleamHouse
 		props.windowProperties.width = 1800;
 		props.windowProperties.height = 900;
 		props.fps = 60.0;
-		props.numberOfSamples = 16;
 		props.windowProperties.title = getName();
 		return props;
 	}
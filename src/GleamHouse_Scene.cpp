@@ -8,6 +8,7 @@
 #include "PostProcessor.h"
 #include "FinishedLevel_Scene.h"
 #include "LightProperties.h"
+#include "Layers.h"
 #include "Events/KeyEvents.h"
 
 using namespace Pekan::Graphics;
@@ -15,13 +16,22 @@ using namespace Pekan::Renderer2D;
 using namespace Pekan::Tools;
 using namespace Pekan;
 
-#define POST_PROCESSING_SHADER_FILEPATH "src/shaders/PostProcessingShader.glsl"
 #define PI 3.14159265f
 
 namespace GleamHouse
 {
 
 	static constexpr float CAMERA_SCALE = 10.0f;
+
+	// Divisor of the resolution at which lighting is rendered, for example 2 for half resolution, 4 for quarter resolution.
+	// Our lights have a smooth falloff, so they look the same at a reduced resolution, but are much cheaper to render.
+	// Set to 1 to render lighting at full resolution.
+	static constexpr int LIGHTING_RESOLUTION_DIVISOR = 2;
+	// GPU time of a frame that dynamic resolution tries to hold, in milliseconds.
+	// Leaves some room in a 60 FPS frame (16.6 ms) for everything that's not post-processed, like GUI.
+	static constexpr double TARGET_GPU_FRAME_TIME = 12.0;
+	// Lowest scale of the resolution at which the scene is rendered, relative to window's size
+	static constexpr float MIN_RESOLUTION_SCALE = 0.5f;
 	// Interpolation factor to be used for camera's movement
 	static constexpr float CAMERA_LERP_FACTOR = 0.05f;
 
@@ -53,6 +63,13 @@ namespace GleamHouse
 	static constexpr glm::vec2 STAR_POSITION = { 20.0f, -40.0f };
 	static constexpr float STAR_BASE_INTENSITY = 80.0f;
 	static constexpr glm::vec3 STAR_BASE_COLOR = { 0.5f, 0.3f, 1.0f };
+	// Radius of star's light, in world space
+	static constexpr float STAR_LIGHT_RADIUS = 5.7f;
+	static constexpr float STAR_LIGHT_SHARPNESS = 0.1f;
+
+	// ID of star's light in the static lightmap.
+	// Torches' lights use their index as ID, so star comes after them.
+	static constexpr int STAR_LIGHT_ID = GleamHouse_Scene::TORCHES_COUNT;
 
 	static constexpr float TARGET_DIST_TO_STAR = 18.0f;
 
@@ -72,6 +89,8 @@ namespace GleamHouse
 		// Enable and configure blending
 		RenderState::enableBlending();
 		RenderState::setBlendFunction(BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha);
+		// Draw opaque wall and floors front-to-back in a depth pass, so that hidden parts of them are not shaded
+		Renderer2DSystem::setOpaqueDepthPassEnabled(true);
 
 		createCamera();
 
@@ -112,10 +131,52 @@ namespace GleamHouse
 		{
 			m_centerSquare.create(0.2f, 0.2f);
 			m_centerSquare.setColor({ 1.0f, 0.0f, 0.0f, 1.0f });
+			m_centerSquare.setLayer(LAYER_DEBUG);
 		}
 #endif
 
-		if (!PostProcessor::init(POST_PROCESSING_SHADER_FILEPATH))
+		if (!m_lightVolumes.create())
+		{
+			PK_LOG_ERROR("Failed to create light volumes.", "GleamHouse");
+			return false;
+		}
+		if (!m_staticLightmap.create(MAP_BOTTOM_LEFT_POSITION, MAP_TOP_RIGHT_POSITION))
+		{
+			PK_LOG_ERROR("Failed to create static lightmap.", "GleamHouse");
+			return false;
+		}
+		m_lightVolumes.setStaticLightmap(&m_staticLightmap);
+
+		// Star never moves, so its light is always static.
+		// It's baked with a white color and an intensity of 1, and its current color and intensity are applied when rendering.
+		{
+			LightProperties starLight;
+			starLight.position = STAR_POSITION;
+			starLight.color = { 1.0f, 1.0f, 1.0f };
+			starLight.intensity = 1.0f;
+			starLight.radius = STAR_LIGHT_RADIUS;
+			starLight.sharpness = STAR_LIGHT_SHARPNESS;
+			starLight.isStar = true;
+			m_staticLightmap.setLight(STAR_LIGHT_ID, starLight);
+		}
+		// Torches start lying on the ground, so their lights are static at first
+		for (int i = 0; i < TORCHES_COUNT; i++)
+		{
+			m_staticLightmap.setLight(i, m_torches[i].getStaticLightProperties());
+			m_isTorchLightStatic[i] = true;
+		}
+		// FXAA is a single full-screen pass, much cheaper than rendering the whole scene with multiple samples
+		PostProcessor::setAntiAliasingMode(AntiAliasingMode::FXAA);
+		// Scale resolution down when GPU can't keep up, for example when there are many lights on screen
+		{
+			DynamicResolutionProperties dynamicResolutionProperties;
+			dynamicResolutionProperties.targetFrameTime = TARGET_GPU_FRAME_TIME;
+			dynamicResolutionProperties.minScale = MIN_RESOLUTION_SCALE;
+			dynamicResolutionProperties.maxScale = 1.0f;
+			PostProcessor::enableDynamicResolution(dynamicResolutionProperties);
+		}
+		// Lights are rendered as light volumes into PostProcessor's light buffer
+		if (!PostProcessor::init([this]() { m_lightVolumes.render(); }, LIGHTING_RESOLUTION_DIVISOR))
 		{
 			PK_LOG_ERROR("Failed to initialize PostProcessor", "Demo06");
 		}
@@ -170,6 +231,17 @@ namespace GleamHouse
 		t += float(dt);
 	}
 
+	void GleamHouse_Scene::lateUpdate()
+	{
+		m_player.updateFacing();
+		// Carried torch is rotated together with the player, so its light must follow only after player's facing is updated
+		for (int i = 0; i < TORCHES_COUNT; i++)
+		{
+			m_torches[i].lateUpdate();
+		}
+		updateDynamicLights();
+	}
+
 	void GleamHouse_Scene::render() const
 	{
 		PostProcessor::beginFrame();
@@ -209,6 +281,8 @@ namespace GleamHouse
 		}
 		m_player.destroy();
 		m_wall.destroy();
+		m_staticLightmap.destroy();
+		m_lightVolumes.destroy();
 		m_camera->destroy();
 	}
 
@@ -267,59 +341,54 @@ namespace GleamHouse
 		m_camera->setPosition(newCameraPos);
 	}
 
-	// Updates post-processing shader with given list of lights
-	static void updatePostProcessingShader(const LightProperties* lights, int lightsCount)
-	{
-		Shader* ppShader = PostProcessor::getShader();
-		ppShader->setUniform1i("uLightsCount", lightsCount);
-
-		std::vector<glm::vec2> positions(lightsCount, { 0.0f, 0.0f });
-		std::vector<glm::vec3> colors(lightsCount, { 1.0f, 1.0f, 1.0f });
-		std::vector<float> intensities(lightsCount, 1.0f);
-		std::vector<float> radii(lightsCount, 10.0f);
-		std::vector<float> sharpnesses(lightsCount, 0.5f);
-		std::vector<float> isStar(lightsCount, 0.0f);
-		for (int i = 0; i < lightsCount; i++)
-		{
-			positions[i] = lights[i].position;
-			colors[i] = lights[i].color;
-			intensities[i] = lights[i].intensity;
-			radii[i] = lights[i].radius;
-			sharpnesses[i] = lights[i].sharpness;
-			isStar[i] = (lights[i].isStar ? 1.0f : 0.0f);
-		}
-
-		ppShader->setUniform2fv("uLightPositions", positions.size(), positions.data());
-		ppShader->setUniform3fv("uLightColors", colors.size(), colors.data());
-		ppShader->setUniform1fv("uLightIntensities", intensities.size(), intensities.data());
-		ppShader->setUniform1fv("uLightRadii", radii.size(), radii.data());
-		ppShader->setUniform1fv("uLightSharpnesses", sharpnesses.size(), sharpnesses.data());
-		ppShader->setUniform1fv("uLightIsStarFlags", isStar.size(), isStar.data());
-
-		const glm::vec2 resolution = glm::vec2(PekanEngine::getWindow().getSize());
-		ppShader->setUniform2f("uResolution", resolution);
-	}
-
 	void GleamHouse_Scene::updateLights()
 	{
 		PK_ASSERT(m_camera != nullptr, "Cannot update lights because camera is null.", "Demo06");
 		PK_ASSERT_QUICK(TORCHES_COUNT >= 0);
 
-		static LightProperties lights[TORCHES_COUNT + 1];
+		updateStaticLights();
+		m_staticLightmap.setStarLight(getStarColor() * getStarIntensity());
+	}
 
-		lights[0].position = m_camera->worldToWindowPosition(STAR_POSITION);
-		lights[0].color = getStarColor();
-		lights[0].intensity = getStarIntensity();
-		lights[0].radius = m_camera->worldToWindowSize({5.7f, 5.7f}).x;
-		lights[0].sharpness = 0.1f;
-		lights[0].isStar = true;
+	void GleamHouse_Scene::updateDynamicLights()
+	{
+		// Only lights of carried torches are dynamic
+		static LightProperties lights[TORCHES_COUNT];
+		int lightsCount = 0;
+		for (int i = 0; i < TORCHES_COUNT; i++)
+		{
+			if (m_torches[i].isCarried())
+			{
+				lights[lightsCount++] = m_torches[i].getLightProperties();
+			}
+		}
+
+		m_lightVolumes.setLights(lights, lightsCount);
+	}
 
+	void GleamHouse_Scene::updateStaticLights()
+	{
 		for (int i = 0; i < TORCHES_COUNT; i++)
 		{
-			lights[i + 1] = m_torches[i].getLightProperties();
+			const bool isStatic = !m_torches[i].isCarried();
+			if (isStatic == m_isTorchLightStatic[i])
+			{
+				continue;
+			}
+			// Torch was just dropped or grabbed, so add its light to the lightmap or remove it from there
+			if (isStatic)
+			{
+				m_staticLightmap.setLight(i, m_torches[i].getStaticLightProperties());
+			}
+			else
+			{
+				m_staticLightmap.removeLight(i);
+			}
+			m_isTorchLightStatic[i] = isStatic;
 		}
 
-		updatePostProcessingShader(lights, TORCHES_COUNT + 1);
+		// Bake only the parts of the lightmap affected by the change
+		m_staticLightmap.bake();
 	}
 
 	void GleamHouse_Scene::updateDistToStar()
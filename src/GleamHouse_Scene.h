@@ -8,6 +8,8 @@
 #include "RectangleShape.h"
 #include "Camera2D.h"
 #include "Torch.h"
+#include "LightVolumes.h"
+#include "StaticLightmap.h"
 
 namespace GleamHouse
 {
@@ -24,6 +26,8 @@ namespace GleamHouse
 
 		void update(double deltaTime) override;
 
+		void lateUpdate() override;
+
 		void render() const override;
 
 		void exit() override;
@@ -49,6 +53,12 @@ namespace GleamHouse
 		void updateCamera();
 
 		void updateLights();
+		// Updates lights of carried torches, which follow player's transform,
+		// so they are updated after player's facing, right before rendering
+		void updateDynamicLights();
+
+		// Updates static lightmap with torches that were grabbed or dropped since last update
+		void updateStaticLights();
 
 		void updateDistToStar();
 
@@ -69,6 +79,13 @@ namespace GleamHouse
 
 		Torch m_torches[TORCHES_COUNT];
 
+		// Light volumes of dynamic lights in the scene, rendered into PostProcessor's light buffer
+		LightVolumes m_lightVolumes;
+		// Lightmap of static lights in the scene - the star and torches lying on the ground
+		StaticLightmap m_staticLightmap;
+		// Flags indicating if each torch's light is currently baked into the static lightmap
+		bool m_isTorchLightStatic[TORCHES_COUNT] = {};
+
 #if GLEAMHOUSE_WITH_DEBUG_GRAPHICS
 		// A small square to mark coordinate system's center
 		Pekan::Renderer2D::RectangleShape m_centerSquare;
@@ -0,0 +1,19 @@
+#pragma once
+
+namespace GleamHouse
+{
+
+	// Layers that game's primitives are drawn in.
+	// Primitives in higher layers are drawn over ones in lower layers.
+	// With Renderer2DSystem's opaque depth pass, opaque primitives in higher layers also hide ones in lower layers from the GPU,
+	// so that hidden parts of the wall and the floors are never shaded.
+	constexpr int LAYER_WALL = 0;
+	constexpr int LAYER_FLOOR = 1;
+	constexpr int LAYER_FLOOR_BLACK_SQUARES = 2;
+	constexpr int LAYER_PLAYER = 3;
+	constexpr int LAYER_TORCH_BASE = 4;
+	constexpr int LAYER_TORCH_FIRE = 5;
+	// Debug graphics are drawn over everything else
+	constexpr int LAYER_DEBUG = 6;
+
+} // namespace GleamHouse
\ No newline at end of file
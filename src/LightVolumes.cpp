@@ -0,0 +1,177 @@
+#include "LightVolumes.h"
+#include "StaticLightmap.h"
+
+#include "PekanLogger.h"
+#include "PekanEngine.h"
+#include "RenderState.h"
+#include "Utils/FileUtils.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Pekan::Graphics;
+using namespace Pekan;
+
+#define VERTEX_SHADER_FILEPATH "src/shaders/LightVolume_VertexShader.glsl"
+#define FRAGMENT_SHADER_FILEPATH "src/shaders/LightVolume_FragmentShader.glsl"
+
+namespace GleamHouse
+{
+
+	// Amount of light that is considered invisible.
+	// A light volume covers only the pixels where the light is brighter than that.
+	static constexpr float LIGHT_CUTOFF = 0.001f;
+
+	// Light that is always present, even where there are no lights
+	static constexpr float BASE_LIGHT = 0.004f;
+
+	// Number of vertices of a single light volume
+	static constexpr unsigned VERTICES_PER_LIGHT = 6;
+
+	bool LightVolumes::create()
+	{
+		m_renderObject.create
+		(
+			{
+				{ ShaderDataType::Float2, "position" },
+				{ ShaderDataType::Float2, "lightPosition" },
+				{ ShaderDataType::Float3, "color" },
+				{ ShaderDataType::Float, "intensity" },
+				{ ShaderDataType::Float, "radius" },
+				{ ShaderDataType::Float, "sharpness" }
+			},
+			FileUtils::readTextFileToString(VERTEX_SHADER_FILEPATH).c_str(),
+			FileUtils::readTextFileToString(FRAGMENT_SHADER_FILEPATH).c_str()
+		);
+		// Output light in all channels
+		m_renderObject.getShader().setUniform4f("uOutputMask", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+
+		return true;
+	}
+
+	void LightVolumes::destroy()
+	{
+		m_renderObject.destroy();
+	}
+
+	void LightVolumes::setLights(const LightProperties* lights, int lightsCount)
+	{
+		PK_ASSERT_QUICK(lightsCount >= 0);
+
+		m_vertices.clear();
+
+		// Non-star lights go first
+		for (int i = 0; i < lightsCount; i++)
+		{
+			if (!lights[i].isStar)
+			{
+				addLightVolume(m_vertices, lights[i], getLightExtent(lights[i]));
+			}
+		}
+		m_nonStarVerticesCount = unsigned(m_vertices.size());
+
+		// Non-star lightness caps at 100%,
+		// so cap it at 1.0 minus base light because we will always add base light after that.
+		// (This quad is blended with a Min equation, so intensity here is the cap)
+		addFullscreenLight(1.0f - BASE_LIGHT);
+
+		// Then base light and star lights, which are not capped
+		addFullscreenLight(BASE_LIGHT);
+		for (int i = 0; i < lightsCount; i++)
+		{
+			if (lights[i].isStar)
+			{
+				addLightVolume(m_vertices, lights[i], getLightExtent(lights[i]));
+			}
+		}
+
+		m_renderObject.setVertexData(m_vertices.data(), m_vertices.size() * sizeof(Vertex));
+
+		const glm::vec2 resolution = glm::vec2(PekanEngine::getWindow().getSize());
+		m_renderObject.getShader().setUniform2f("uResolution", resolution);
+	}
+
+	void LightVolumes::render() const
+	{
+		// Nothing to render if lights are not yet set
+		if (m_vertices.empty())
+		{
+			return;
+		}
+
+		// Light volumes accumulate additively
+		const BlendFactor previousBlendSourceFactor = RenderState::getBlendSourceFactor();
+		const BlendFactor previousBlendDestinationFactor = RenderState::getBlendDestinationFactor();
+		RenderState::setBlendFunction(BlendFactor::One, BlendFactor::One);
+
+		if (m_staticLightmap != nullptr)
+		{
+			m_staticLightmap->renderNonStarLights();
+		}
+		m_renderObject.renderRange(0, m_nonStarVerticesCount);
+
+		// Cap non-star lights by keeping the smaller of current light and the capping quad's light
+		RenderState::setBlendEquation(BlendEquation::Min);
+		m_renderObject.renderRange(m_nonStarVerticesCount, VERTICES_PER_LIGHT);
+		RenderState::setBlendEquation(BlendEquation::Add);
+
+		const unsigned firstUncappedVertex = m_nonStarVerticesCount + VERTICES_PER_LIGHT;
+		m_renderObject.renderRange(firstUncappedVertex, unsigned(m_vertices.size()) - firstUncappedVertex);
+		if (m_staticLightmap != nullptr)
+		{
+			m_staticLightmap->renderStarLights();
+		}
+
+		// Restore the blend function that was set before
+		RenderState::setBlendFunction(previousBlendSourceFactor, previousBlendDestinationFactor);
+	}
+
+	float LightVolumes::getLightExtent(const LightProperties& light)
+	{
+		// Find the distance at which light's falloff drops below the cutoff.
+		// Falloff is exp(-x*x)^sharpness where x = distance / radius, so
+		//     peak * exp(-x*x * sharpness) = cutoff  =>  x = sqrt(ln(peak / cutoff) / sharpness)
+		const float peak = light.intensity * std::max(light.color.r, std::max(light.color.g, light.color.b));
+		if (peak <= LIGHT_CUTOFF || light.radius <= 0.0f || light.sharpness <= 0.0f)
+		{
+			return 0.0f;
+		}
+		return light.radius * std::sqrt(std::log(peak / LIGHT_CUTOFF) / light.sharpness);
+	}
+
+	void LightVolumes::addLightVolume(std::vector<Vertex>& vertices, const LightProperties& light, float extent)
+	{
+		if (extent <= 0.0f)
+		{
+			return;
+		}
+
+		const glm::vec2 min = light.position - glm::vec2(extent, extent);
+		const glm::vec2 max = light.position + glm::vec2(extent, extent);
+		const glm::vec2 corners[VERTICES_PER_LIGHT] =
+		{
+			{ min.x, min.y }, { max.x, min.y }, { max.x, max.y },
+			{ min.x, min.y }, { max.x, max.y }, { min.x, max.y }
+		};
+		for (const glm::vec2& corner : corners)
+		{
+			vertices.push_back({ corner, light.position, light.color, light.intensity, light.radius, light.sharpness });
+		}
+	}
+
+	void LightVolumes::addFullscreenLight(float intensity)
+	{
+		const glm::vec2 windowSize = glm::vec2(PekanEngine::getWindow().getSize());
+		const glm::vec2 corners[VERTICES_PER_LIGHT] =
+		{
+			{ 0.0f, 0.0f }, { windowSize.x, 0.0f }, { windowSize.x, windowSize.y },
+			{ 0.0f, 0.0f }, { windowSize.x, windowSize.y }, { 0.0f, windowSize.y }
+		};
+		for (const glm::vec2& corner : corners)
+		{
+			// A sharpness of 0 means no falloff at all, so the light is uniform over the whole quad
+			m_vertices.push_back({ corner, windowSize / 2.0f, glm::vec3(1.0f, 1.0f, 1.0f), intensity, 1.0f, 0.0f });
+		}
+	}
+
+} // namespace GleamHouse
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "RenderObject.h"
+#include "LightProperties.h"
+
+#include <vector>
+
+namespace GleamHouse
+{
+
+	class StaticLightmap;
+
+	// A class for rendering lights as light volumes.
+	// Each light is drawn as a quad covering only the pixels where the light is visible,
+	// and quads are additively blended into PostProcessor's light buffer.
+	// This way each pixel pays only for the lights that actually touch it,
+	// and there is no limit on the number of lights.
+	class LightVolumes
+	{
+	public:
+
+		// A single vertex of a light volume
+		struct Vertex
+		{
+			// Vertex's position
+			glm::vec2 position;
+			// Position of light's center
+			glm::vec2 lightPosition;
+			glm::vec3 color;
+			float intensity;
+			float radius;
+			float sharpness;
+		};
+
+		bool create();
+		void destroy();
+
+		// Sets lights to be rendered on next render() call.
+		// Lights' positions and radii are expected in window space.
+		void setLights(const LightProperties* lights, int lightsCount);
+
+		// Sets a static lightmap to be rendered together with the lights.
+		// Static lights are then taken from the lightmap, and only dynamic lights need to be set with setLights().
+		void setStaticLightmap(StaticLightmap* staticLightmap) { m_staticLightmap = staticLightmap; }
+
+		// Renders lights into currently bound frame buffer.
+		// To be called by PostProcessor while its light buffer is bound.
+		void render() const;
+
+		// Returns the distance from a light's center at which light becomes invisible
+		static float getLightExtent(const LightProperties& light);
+
+		// Adds a quad of a given size (half of quad's side) for a given light to a given list of vertices.
+		// Light will be skipped if it's too dim to be visible anywhere.
+		static void addLightVolume(std::vector<Vertex>& vertices, const LightProperties& light, float extent);
+
+	private: /* functions */
+
+		// Adds a quad covering the whole window, adding a given amount of light to each pixel
+		void addFullscreenLight(float intensity);
+
+	private: /* variables */
+
+		// Vertices of all light volumes, 6 per light, grouped like this:
+		//   - non-star lights
+		//   - a full-screen quad capping non-star lights
+		//   - a full-screen quad of base light, and star lights
+		std::vector<Vertex> m_vertices;
+
+		// Number of vertices of non-star lights
+		unsigned m_nonStarVerticesCount = 0;
+
+		Pekan::Graphics::RenderObject m_renderObject;
+
+		// Lightmap containing static lights, or null if all lights are dynamic
+		StaticLightmap* m_staticLightmap = nullptr;
+	};
+
+} // namespace GleamHouse
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "BoundingCircle.h"
 #include "PekanLogger.h"
 #include "Torch.h"
+#include "Layers.h"
 
 using namespace Pekan;
 using namespace Pekan::Graphics;
@@ -42,6 +43,7 @@ namespace GleamHouse
 			texture->create(image);
 			// Create player's sprite using the texture
 			m_sprite.create(texture, SIZE, SIZE);
+			m_sprite.setLayer(LAYER_PLAYER);
 		}
 
 		// TEMP
@@ -114,18 +116,23 @@ namespace GleamHouse
 		{
 			dropTorch();
 		}
+	}
 
-		// Rotate sprite to point towards the mouse
+	void Player::updateFacing()
+	{
+		if (!m_isPlayable)
 		{
-			// Get mouse position, in world space
-			const glm::vec2 mousePosition = Renderer2DSystem::getMousePosition();
-			// Calculate vector from player to mouse
-			const glm::vec2 playerToMouseVec = mousePosition - getPosition();
-			// Calculate the angle that this vector makes with the positive X-axis
-			const float angle = std::atan2f(playerToMouseVec.x, playerToMouseVec.y);
-			// Set sprite's rotation to be that angle
-			m_sprite.setRotation(angle);
+			return;
 		}
+
+		// Get mouse position, in world space
+		const glm::vec2 mousePosition = Renderer2DSystem::getMousePosition();
+		// Calculate vector from player to mouse
+		const glm::vec2 playerToMouseVec = mousePosition - getPosition();
+		// Calculate the angle that this vector makes with the positive X-axis
+		const float angle = std::atan2f(playerToMouseVec.x, playerToMouseVec.y);
+		// Set sprite's rotation to be that angle
+		m_sprite.setRotation(angle);
 	}
 
 	glm::vec2 Player::getSize() const
@@ -195,7 +202,7 @@ namespace GleamHouse
 		    || (!isPointInFloor(downPoint, floors, floorsCount) && !isPointInFloor(upPoint, floors, floorsCount));
 	}
 
-	bool Player::canMoveBy(glm::vec2 delta, const Floor* floors, int floorsCount)
+	bool Player::canMoveBy(glm::vec2 delta, const Floor* floors, int floorsCount) const
 	{
 		// Calculate player's position after applying the delta vector
 		const glm::vec2 newPosition = getPosition() + delta;
@@ -25,6 +25,9 @@ namespace GleamHouse
 		void render() const;
 		// Updates player, given a list of floor pieces where player is allowed to move.
 		void update(const Floor* floors, int floorsCount);
+		// Rotates player to face the mouse.
+		// To be called right before rendering, after mouse position is late-latched, so that player follows the mouse with minimal lag.
+		void updateFacing();
 
 		// Returns player's position, in world space
 		glm::vec2 getPosition() const { return m_sprite.getPositionInWorld(); }
@@ -54,14 +57,14 @@ namespace GleamHouse
 		// Checks if player is currently in a narrow tunnel.
 		// A "narrow tunnel" is a horizontal/vertical tunnel that is 1 tile wide.
 		bool isInNarrowTunnel(const Floor* floors, int floorsCount) const;
+		// Checks if player can be moved by some delta vector,
+		// given a list of floor pieces where player is allowed to move.
+		bool canMoveBy(glm::vec2 delta, const Floor* floors, int floorsCount) const;
 
 		const Pekan::Renderer2D::Transformable2D* getTransformable2D() const { return static_cast<const Pekan::Renderer2D::Transformable2D*>(&m_sprite); }
 
 	private: /* functions */
 
-		// Checks if player can be moved by some delta vector,
-		// given a list of floor pieces where player is allowed to move.
-		bool canMoveBy(glm::vec2 delta, const Floor* floors, int floorsCount);
 		// Checks if a given point, in world space, is inside of the floor - inside one of the given floor pieces.
 		bool isPointInFloor(glm::vec2 point, const Floor* floors, int floorsCount) const;
 
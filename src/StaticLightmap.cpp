@@ -0,0 +1,313 @@
+#include "StaticLightmap.h"
+
+#include "PekanLogger.h"
+#include "PekanEngine.h"
+#include "RenderState.h"
+#include "Renderer2DSystem.h"
+#include "Utils/FileUtils.h"
+
+#include <cmath>
+
+using namespace Pekan::Graphics;
+using namespace Pekan::Renderer2D;
+using namespace Pekan;
+
+#define LIGHT_VOLUME_VERTEX_SHADER_FILEPATH "src/shaders/LightVolume_VertexShader.glsl"
+#define LIGHT_VOLUME_FRAGMENT_SHADER_FILEPATH "src/shaders/LightVolume_FragmentShader.glsl"
+#define VERTEX_SHADER_FILEPATH "src/shaders/StaticLightmap_VertexShader.glsl"
+#define FRAGMENT_SHADER_FILEPATH "src/shaders/StaticLightmap_FragmentShader.glsl"
+
+namespace GleamHouse
+{
+
+	// Number of lightmap texels per unit of world space.
+	// Static lights are smooth, and lightmap is sampled with linear filtering, so a low density is enough.
+	static constexpr float TEXELS_PER_UNIT = 4.0f;
+	// Size of a single tile, in texels
+	static constexpr int TILE_SIZE = 256;
+	// Size of a single tile, in world space
+	static constexpr float TILE_SIZE_WORLD = float(TILE_SIZE) / TEXELS_PER_UNIT;
+
+	// Number of vertices of a single tile's quad
+	static constexpr unsigned VERTICES_PER_TILE = 6;
+
+	// Checks if two rectangles, given by their bottom-left and top-right positions, overlap
+	static bool doRectanglesOverlap(glm::vec2 aMin, glm::vec2 aMax, glm::vec2 bMin, glm::vec2 bMax)
+	{
+		return aMin.x < bMax.x && bMin.x < aMax.x && aMin.y < bMax.y && bMin.y < aMax.y;
+	}
+
+	bool StaticLightmap::create(glm::vec2 bottomLeftPosition, glm::vec2 topRightPosition)
+	{
+		PK_ASSERT(m_tiles.empty(), "Trying to create a StaticLightmap that is already created.", "GleamHouse");
+
+		m_bottomLeftPosition = bottomLeftPosition;
+		m_topRightPosition = topRightPosition;
+
+		const glm::vec2 size = topRightPosition - bottomLeftPosition;
+		m_tilesCountX = int(std::ceil(size.x / TILE_SIZE_WORLD));
+		m_tilesCountY = int(std::ceil(size.y / TILE_SIZE_WORLD));
+		if (m_tilesCountX <= 0 || m_tilesCountY <= 0)
+		{
+			PK_LOG_ERROR("Trying to create a StaticLightmap with an empty rectangle.", "GleamHouse");
+			return false;
+		}
+
+		// Create tiles, and a quad for each tile
+		std::vector<float> tilesVertices;
+		tilesVertices.reserve(m_tilesCountX * m_tilesCountY * VERTICES_PER_TILE * 4);
+		m_tiles.resize(m_tilesCountX * m_tilesCountY);
+		m_tileFrameBuffers.resize(m_tiles.size());
+		for (int y = 0; y < m_tilesCountY; y++)
+		{
+			for (int x = 0; x < m_tilesCountX; x++)
+			{
+				const int tileIndex = y * m_tilesCountX + x;
+				Tile& tile = m_tiles[tileIndex];
+				tile.bottomLeftPosition = bottomLeftPosition + glm::vec2(float(x), float(y)) * TILE_SIZE_WORLD;
+				tile.topRightPosition = tile.bottomLeftPosition + glm::vec2(TILE_SIZE_WORLD, TILE_SIZE_WORLD);
+				tile.needBake = true;
+
+				FrameBuffer& frameBuffer = m_tileFrameBuffers[tileIndex];
+				frameBuffer.create(TILE_SIZE, TILE_SIZE, 1, true);
+				frameBuffer.setTextureMinifyFunction(TextureMinifyFunction::Linear);
+				frameBuffer.setTextureMagnifyFunction(TextureMagnifyFunction::Linear);
+
+				const glm::vec2 min = tile.bottomLeftPosition;
+				const glm::vec2 max = tile.topRightPosition;
+				const float quad[VERTICES_PER_TILE * 4] =
+				{
+					// position     // texture coordinate
+					min.x, min.y,    0.0f, 0.0f,
+					max.x, min.y,    1.0f, 0.0f,
+					max.x, max.y,    1.0f, 1.0f,
+					min.x, min.y,    0.0f, 0.0f,
+					max.x, max.y,    1.0f, 1.0f,
+					min.x, max.y,    0.0f, 1.0f
+				};
+				tilesVertices.insert(tilesVertices.end(), std::begin(quad), std::end(quad));
+			}
+		}
+		// Go back to the default frame buffer, since creating a frame buffer binds it.
+		// (It doesn't matter which one we unbind)
+		m_tileFrameBuffers.back().unbind();
+
+		m_renderObject.create
+		(
+			tilesVertices.data(), tilesVertices.size() * sizeof(float),
+			{ { ShaderDataType::Float2, "position" }, { ShaderDataType::Float2, "textureCoordinates" } },
+			BufferDataUsage::StaticDraw,
+			FileUtils::readTextFileToString(VERTEX_SHADER_FILEPATH).c_str(),
+			FileUtils::readTextFileToString(FRAGMENT_SHADER_FILEPATH).c_str()
+		);
+		// Lightmap tile will always be bound on slot 0
+		m_renderObject.getShader().setUniform1i("uLightmap", 0);
+
+		m_bakeRenderObject.create
+		(
+			{
+				{ ShaderDataType::Float2, "position" },
+				{ ShaderDataType::Float2, "lightPosition" },
+				{ ShaderDataType::Float3, "color" },
+				{ ShaderDataType::Float, "intensity" },
+				{ ShaderDataType::Float, "radius" },
+				{ ShaderDataType::Float, "sharpness" }
+			},
+			FileUtils::readTextFileToString(LIGHT_VOLUME_VERTEX_SHADER_FILEPATH).c_str(),
+			FileUtils::readTextFileToString(LIGHT_VOLUME_FRAGMENT_SHADER_FILEPATH).c_str()
+		);
+		// Lights are baked in tile's texel space
+		m_bakeRenderObject.getShader().setUniform2f("uResolution", glm::vec2(float(TILE_SIZE), float(TILE_SIZE)));
+
+		return true;
+	}
+
+	void StaticLightmap::destroy()
+	{
+		m_bakeRenderObject.destroy();
+		m_renderObject.destroy();
+		for (FrameBuffer& frameBuffer : m_tileFrameBuffers)
+		{
+			frameBuffer.destroy();
+		}
+		m_tileFrameBuffers.clear();
+		m_tiles.clear();
+		m_lights.clear();
+	}
+
+	void StaticLightmap::setLight(int id, const LightProperties& light)
+	{
+		auto it = m_lights.find(id);
+		if (it != m_lights.end())
+		{
+			// Tiles touched by the old light need to be baked without it
+			markTilesTouchedByLight(it->second);
+			it->second = light;
+		}
+		else
+		{
+			m_lights.emplace(id, light);
+		}
+		markTilesTouchedByLight(light);
+	}
+
+	void StaticLightmap::removeLight(int id)
+	{
+		auto it = m_lights.find(id);
+		if (it == m_lights.end())
+		{
+			PK_LOG_WARNING("Trying to remove a static light with ID " << id << " but there is no such light.", "GleamHouse");
+			return;
+		}
+		markTilesTouchedByLight(it->second);
+		m_lights.erase(it);
+	}
+
+	void StaticLightmap::bake()
+	{
+		bool hasBakedAnything = false;
+		BlendFactor previousBlendSourceFactor = BlendFactor::One;
+		BlendFactor previousBlendDestinationFactor = BlendFactor::Zero;
+		for (int i = 0; i < int(m_tiles.size()); i++)
+		{
+			if (m_tiles[i].needBake)
+			{
+				// Lights accumulate additively
+				if (!hasBakedAnything)
+				{
+					previousBlendSourceFactor = RenderState::getBlendSourceFactor();
+					previousBlendDestinationFactor = RenderState::getBlendDestinationFactor();
+					RenderState::setBlendFunction(BlendFactor::One, BlendFactor::One);
+					RenderState::setViewport(0, 0, TILE_SIZE, TILE_SIZE);
+					hasBakedAnything = true;
+				}
+				bakeTile(i);
+				m_tiles[i].needBake = false;
+			}
+		}
+
+		if (hasBakedAnything)
+		{
+			// Restore the frame buffer and viewport used by the scene, and the blend function that was set before.
+			// (It doesn't matter which frame buffer we unbind)
+			m_tileFrameBuffers.back().unbind();
+			const glm::ivec2 frameBufferSize = PekanEngine::getWindow().getFrameBufferSize();
+			RenderState::setViewport(0, 0, frameBufferSize.x, frameBufferSize.y);
+			RenderState::setBlendFunction(previousBlendSourceFactor, previousBlendDestinationFactor);
+		}
+	}
+
+	void StaticLightmap::renderNonStarLights()
+	{
+		render(glm::vec3(1.0f, 1.0f, 1.0f), glm::vec3(0.0f, 0.0f, 0.0f));
+	}
+
+	void StaticLightmap::renderStarLights()
+	{
+		render(glm::vec3(0.0f, 0.0f, 0.0f), m_starLight);
+	}
+
+	void StaticLightmap::markTilesTouchedByLight(const LightProperties& light)
+	{
+		const float extent = getLightExtent(light);
+		const glm::vec2 lightMin = light.position - glm::vec2(extent, extent);
+		const glm::vec2 lightMax = light.position + glm::vec2(extent, extent);
+		for (Tile& tile : m_tiles)
+		{
+			if (doRectanglesOverlap(lightMin, lightMax, tile.bottomLeftPosition, tile.topRightPosition))
+			{
+				tile.needBake = true;
+			}
+		}
+	}
+
+	void StaticLightmap::bakeTile(int tileIndex)
+	{
+		const Tile& tile = m_tiles[tileIndex];
+
+		m_tileFrameBuffers[tileIndex].bind();
+		RenderCommands::clear(true, false);
+
+		// Collect light volumes of all lights touching the tile, in tile's texel space.
+		// Non-star lights go first, then star lights.
+		m_bakeVertices.clear();
+		unsigned nonStarVerticesCount = 0;
+		for (int pass = 0; pass < 2; pass++)
+		{
+			const bool isStarPass = (pass == 1);
+			for (const auto& [id, light] : m_lights)
+			{
+				if (light.isStar != isStarPass)
+				{
+					continue;
+				}
+				const float extent = getLightExtent(light);
+				const glm::vec2 lightMin = light.position - glm::vec2(extent, extent);
+				const glm::vec2 lightMax = light.position + glm::vec2(extent, extent);
+				if (!doRectanglesOverlap(lightMin, lightMax, tile.bottomLeftPosition, tile.topRightPosition))
+				{
+					continue;
+				}
+
+				LightProperties lightInTile = light;
+				lightInTile.position = (light.position - tile.bottomLeftPosition) * TEXELS_PER_UNIT;
+				lightInTile.radius = light.radius * TEXELS_PER_UNIT;
+				LightVolumes::addLightVolume(m_bakeVertices, lightInTile, extent * TEXELS_PER_UNIT);
+			}
+			if (!isStarPass)
+			{
+				nonStarVerticesCount = unsigned(m_bakeVertices.size());
+			}
+		}
+		if (m_bakeVertices.empty())
+		{
+			return;
+		}
+
+		m_bakeRenderObject.setVertexData(m_bakeVertices.data(), m_bakeVertices.size() * sizeof(LightVolumes::Vertex));
+
+		// Non-star lights go to RGB
+		Shader& shader = m_bakeRenderObject.getShader();
+		shader.setUniform4f("uOutputMask", glm::vec4(1.0f, 1.0f, 1.0f, 0.0f));
+		m_bakeRenderObject.renderRange(0, nonStarVerticesCount);
+		// Star lights go to A
+		shader.setUniform4f("uOutputMask", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+		m_bakeRenderObject.renderRange(nonStarVerticesCount, unsigned(m_bakeVertices.size()) - nonStarVerticesCount);
+	}
+
+	float StaticLightmap::getLightExtent(const LightProperties& light) const
+	{
+		// Star's intensity is applied after baking, and can be very high,
+		// so star lights are baked over the whole lightmap
+		if (light.isStar)
+		{
+			return glm::length(m_topRightPosition - m_bottomLeftPosition);
+		}
+		return LightVolumes::getLightExtent(light);
+	}
+
+	void StaticLightmap::render(glm::vec3 nonStarFactor, glm::vec3 starFactor)
+	{
+		Camera2D_ConstPtr camera = Renderer2DSystem::getCamera();
+		PK_ASSERT(camera != nullptr, "Cannot render StaticLightmap because there is no camera.", "GleamHouse");
+
+		Shader& shader = m_renderObject.getShader();
+		shader.setUniformMatrix4fv("uViewProjectionMatrix", camera->getViewProjectionMatrix());
+		shader.setUniform3f("uNonStarFactor", nonStarFactor);
+		shader.setUniform3f("uStarFactor", starFactor);
+
+		// Render only tiles that are visible by the camera
+		const glm::vec2 cameraMin = camera->ndcToWorldPosition({ -1.0f, -1.0f });
+		const glm::vec2 cameraMax = camera->ndcToWorldPosition({ 1.0f, 1.0f });
+		for (int i = 0; i < int(m_tiles.size()); i++)
+		{
+			if (!doRectanglesOverlap(cameraMin, cameraMax, m_tiles[i].bottomLeftPosition, m_tiles[i].topRightPosition))
+			{
+				continue;
+			}
+			m_tileFrameBuffers[i].bindTexture(0);
+			m_renderObject.renderRange(i * VERTICES_PER_TILE, VERTICES_PER_TILE);
+		}
+	}
+
+} // namespace GleamHouse
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "RenderObject.h"
+#include "FrameBuffer.h"
+#include "LightVolumes.h"
+#include "LightProperties.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace GleamHouse
+{
+
+	// A class representing a world-space lightmap of static lights - lights that don't move.
+	// Static lights are rendered (baked) once into the lightmap, and then each frame the lightmap is just sampled,
+	// instead of evaluating the static lights per pixel again.
+	// The lightmap is split into tiles, and when a static light is added or removed
+	// only the tiles that the light touches are baked again.
+	//
+	// RGB of the lightmap contain the light of non-star lights.
+	// A of the lightmap contains the attenuation of star lights,
+	// which is multiplied by star's current color and intensity when sampled,
+	// so that star's color and intensity can change without re-baking.
+	class StaticLightmap
+	{
+	public:
+
+		// Creates a lightmap covering a given rectangle in world space
+		bool create(glm::vec2 bottomLeftPosition, glm::vec2 topRightPosition);
+		void destroy();
+
+		// Adds a static light with a given ID, or replaces the static light with that ID if there is one.
+		// Light's position and radius are expected in world space.
+		//
+		// NOTE: Star lights should have intensity 1.0 and white color.
+		//       Their actual color and intensity are set with setStarLight().
+		void setLight(int id, const LightProperties& light);
+		// Removes the static light with a given ID
+		void removeLight(int id);
+
+		// Sets current color of star lights, multiplied by their intensity
+		void setStarLight(glm::vec3 starLight) { m_starLight = starLight; }
+
+		// Bakes all tiles affected by static lights that were added or removed since last bake.
+		// Should be called before rendering, while no frame buffer is bound.
+		void bake();
+
+		// Render lightmap's non-star lights and star lights into currently bound frame buffer, using current camera.
+		// To be called by LightVolumes.
+		void renderNonStarLights();
+		void renderStarLights();
+
+	private: /* functions */
+
+		// Marks all tiles touched by a given light as needing a bake
+		void markTilesTouchedByLight(const LightProperties& light);
+
+		// Bakes a single tile
+		void bakeTile(int tileIndex);
+
+		// Returns the distance from a light's center at which light becomes invisible, in world space
+		float getLightExtent(const LightProperties& light) const;
+
+		// Renders all tiles into currently bound frame buffer, multiplying RGB and A of the lightmap with given factors
+		void render(glm::vec3 nonStarFactor, glm::vec3 starFactor);
+
+	private: /* variables */
+
+		// A single tile of the lightmap
+		struct Tile
+		{
+			// Tile's rectangle in world space
+			glm::vec2 bottomLeftPosition = { 0.0f, 0.0f };
+			glm::vec2 topRightPosition = { 0.0f, 0.0f };
+
+			// Flag indicating if tile needs to be baked again
+			bool needBake = true;
+		};
+
+		// Lightmap's rectangle in world space
+		glm::vec2 m_bottomLeftPosition = { 0.0f, 0.0f };
+		glm::vec2 m_topRightPosition = { 0.0f, 0.0f };
+
+		// Number of tiles in X and Y direction
+		int m_tilesCountX = 0;
+		int m_tilesCountY = 0;
+
+		std::vector<Tile> m_tiles;
+		// Frame buffers where tiles are baked, one for each tile.
+		// Kept separately from tiles because frame buffers cannot be copied.
+		std::vector<Pekan::Graphics::FrameBuffer> m_tileFrameBuffers;
+
+		// Static lights, by their IDs, in world space
+		std::unordered_map<int, LightProperties> m_lights;
+
+		// Current color of star lights, multiplied by their intensity
+		glm::vec3 m_starLight = { 1.0f, 1.0f, 1.0f };
+
+		// Render object used to bake lights into tiles
+		Pekan::Graphics::RenderObject m_bakeRenderObject;
+		// Vertices of lights being baked into a tile
+		std::vector<LightVolumes::Vertex> m_bakeVertices;
+
+		// Render object used to render tiles into the light buffer, with one quad per tile
+		Pekan::Graphics::RenderObject m_renderObject;
+	};
+
+} // namespace GleamHouse
\ No newline at end of file
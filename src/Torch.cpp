@@ -4,6 +4,7 @@
 #include "Utils/PekanUtils.h"
 #include "Renderer2DSystem.h"
 #include "Player.h"
+#include "Layers.h"
 
 using namespace Pekan::Renderer2D;
 using namespace Pekan::Utils;
@@ -106,6 +107,7 @@ namespace GleamHouse
 		m_base.create(SIZE_BASE.x, SIZE_BASE.y);
 		m_base.setColor(COLOR_BASE);
 		m_base.setPosition(position);
+		m_base.setLayer(LAYER_TORCH_BASE);
 
 		// Create fire
 		{
@@ -123,6 +125,7 @@ namespace GleamHouse
 				m_fire[i].setThickness(THICKNESS_FIRE_LINE);
 				m_fire[i].setParent(&m_base);
 				m_fire[i].setPosition(FIRE_LOCAL_POSITION);
+				m_fire[i].setLayer(LAYER_TORCH_FIRE);
 			}
 		}
 
@@ -173,6 +176,18 @@ namespace GleamHouse
 		tSinceLastFireColorsUpdate += dt;
 	}
 
+	void Torch::lateUpdate()
+	{
+		// Light of a torch lying on the ground is baked into a static lightmap,
+		// so we need to update its position only while torch is carried
+		if (isCarried())
+		{
+			Camera2D_ConstPtr camera = Renderer2DSystem::getCamera();
+			PK_ASSERT_QUICK(camera != nullptr);
+			m_lightProperties.position = camera->worldToWindowPosition(getFirePosition());
+		}
+	}
+
 	void Torch::onGrabbedByPlayer(const Player* player)
 	{
 		PK_ASSERT_QUICK(m_player == nullptr);
@@ -215,16 +230,29 @@ namespace GleamHouse
 		return m_fire[0].getPositionInWorld();
 	}
 
+	LightProperties Torch::getStaticLightProperties() const
+	{
+		LightProperties lightProperties;
+		lightProperties.position = getFirePosition();
+		lightProperties.color = LIGHT_COLOR;
+		lightProperties.intensity = LIGHT_INTENSITY;
+		lightProperties.radius = LIGHT_RADIUS;
+		lightProperties.sharpness = LIGHT_SHARPNESS;
+		lightProperties.isStar = false;
+		return lightProperties;
+	}
+
 	void Torch::updateFire()
 	{
 		Camera2D_ConstPtr camera = Renderer2DSystem::getCamera();
 		PK_ASSERT_QUICK(camera != nullptr);
 
-		m_lightProperties.position = camera->worldToWindowPosition(getFirePosition());
-
 		if (tSinceLastFireColorsUpdate > TIME_BETWEEN_FIRE_COLORS_UPDATES)
 		{
-			// Update light properties with new random values
+			// Update light properties with new random values.
+			// Light of a torch lying on the ground is baked into a static lightmap,
+			// so we need to update light properties only while torch is carried.
+			if (isCarried())
 			{
 				m_lightProperties.color = LIGHT_COLOR + getRandomFloat(-1.0f, 1.0f) * LIGHT_COLOR_AMPL;
 				m_lightProperties.intensity = LIGHT_INTENSITY + getRandomFloat(-1.0f, 1.0f) * LIGHT_INTENSITY_AMPL;
@@ -23,6 +23,10 @@ namespace GleamHouse
 		void render() const;
 
 		void update(float dt);
+		// Updates everything that depends on the transform of the player carrying the torch, like the position of torch's light.
+		// To be called after player's facing is updated, right before rendering,
+		// so that torch's light is in the same place as the torch that is drawn.
+		void lateUpdate();
 
 		void onGrabbedByPlayer(const Player* player);
 		void onDroppedByPlayer();
@@ -32,9 +36,19 @@ namespace GleamHouse
 		// Returns position of the center of torch's fire, in world space
 		glm::vec2 getFirePosition() const;
 
-		// Returns light properties of torch's fire in current moment
+		// Returns light properties of torch's fire in current moment, in window space.
+		//
+		// NOTE: Updated only while torch is carried.
+		//       A torch lying on the ground is a static light, see getStaticLightProperties().
 		LightProperties getLightProperties() const { return m_lightProperties; }
 
+		// Returns light properties of torch's fire without flickering, in world space.
+		// Used for baking torch's light into a static lightmap while torch is lying on the ground.
+		LightProperties getStaticLightProperties() const;
+
+		// Checks if torch is currently carried by the player
+		bool isCarried() const { return m_player != nullptr; }
+
 	private: /* functions */
 
 		void updateFire();
@@ -1,7 +1,9 @@
 #include "Wall.h"
 
 #include "Image.h"
+#include "CookedTexture.h"
 #include "Texture2D.h"
+#include "Layers.h"
 
 using namespace Pekan::Graphics;
 using namespace Pekan::Renderer2D;
@@ -11,6 +13,8 @@ namespace GleamHouse
 
 	// Filepath of the image to be used for wall's sprite
 	static constexpr char* IMAGE_FILEPATH = GLEAMHOUSE_ROOT_DIR "/src/resources/GleamHouse_wall.png";
+	// Filepath of the cooked texture made from wall's image, cooked on first run
+	static constexpr char* COOKED_TEXTURE_FILEPATH = GLEAMHOUSE_ROOT_DIR "/src/resources/GleamHouse_wall.pktex";
 	// Texture scale of a wall, determining how many times the brick texture
 	// will be repeated on a unit of distance.
 	static constexpr float TEXTURE_SCALE = 2.5f;
@@ -21,17 +25,31 @@ namespace GleamHouse
 		const glm::vec2 centerPosition = bottomLeftPosition + size / 2.0f;
 		// Create sprite
 		{
-			// Load wall's image
-			static Image image(IMAGE_FILEPATH);
-			// Create a texture from wall's image
+			// Load wall's cooked texture, with a pre-generated mip chain, because wall's texture is heavily minified.
+			// It's block-compressed, if supported, to cut sampling bandwidth.
+			static CookedTexture cookedTexture;
+			static const bool isCookedTextureLoaded = cookedTexture.loadOrCook(IMAGE_FILEPATH, COOKED_TEXTURE_FILEPATH, RenderState::isSupportedTextureCompressionS3TC());
+			// Create a texture from wall's cooked texture
 			std::shared_ptr<Texture2D> texture = std::make_shared<Texture2D>();
-			texture->create(image);
+			if (isCookedTextureLoaded)
+			{
+				texture->create(cookedTexture);
+			}
+			// If texture couldn't be cooked, fall back to decoding wall's image
+			else
+			{
+				static Image image(IMAGE_FILEPATH);
+				texture->create(image);
+			}
 			texture->setWrapModeX(TextureWrapMode::MirroredRepeat);
 			texture->setWrapModeY(TextureWrapMode::MirroredRepeat);
 			// Create wall's sprite using the texture
 			m_sprite.create(texture, size.x, size.y);
 			m_sprite.setTextureCoordinatesMax({ size.x * TEXTURE_SCALE, size.y * TEXTURE_SCALE });
 			m_sprite.setPosition(centerPosition);
+			// Wall's texture has no transparent parts, so wall can hide what's behind it in the opaque depth pass
+			m_sprite.setOpaque(true);
+			m_sprite.setLayer(LAYER_WALL);
 		}
 
 		return true;
@@ -0,0 +1,25 @@
+#version 330 core
+
+in vec2 vOffset;
+in vec3 vColor;
+in float vIntensity;
+in float vRadius;
+in float vSharpness;
+
+out vec4 FragColor;
+
+// Mask selecting which channels receive light.
+// RGB receive colored light, A receives light's attenuation scaled by its intensity.
+uniform vec4 uOutputMask;
+
+float gaussianFalloff(float distance, float radius, float sharpness)
+{
+    float x = distance / radius;
+    return pow(exp(-x * x), sharpness);
+}
+
+void main()
+{
+    float attenuation = gaussianFalloff(length(vOffset), vRadius, vSharpness);
+    FragColor = vec4(vColor * vIntensity * attenuation, vIntensity * attenuation) * uOutputMask;
+}
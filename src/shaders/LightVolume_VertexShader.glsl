@@ -0,0 +1,29 @@
+#version 330 core
+
+layout (location = 0) in vec2 position;
+layout (location = 1) in vec2 lightPosition;
+layout (location = 2) in vec3 color;
+layout (location = 3) in float intensity;
+layout (location = 4) in float radius;
+layout (location = 5) in float sharpness;
+
+// Offset from light's center to current vertex
+out vec2 vOffset;
+out vec3 vColor;
+out float vIntensity;
+out float vRadius;
+out float vSharpness;
+
+// Resolution of the frame buffer that lights are rendered into,
+// matching the space of vertex positions
+uniform vec2 uResolution;
+
+void main()
+{
+    gl_Position = vec4(position / uResolution * 2.0 - 1.0, 0.0, 1.0);
+    vOffset = position - lightPosition;
+    vColor = color;
+    vIntensity = intensity;
+    vRadius = radius;
+    vSharpness = sharpness;
+}
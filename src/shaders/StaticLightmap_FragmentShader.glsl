@@ -0,0 +1,20 @@
+#version 330 core
+
+in vec2 vTexCoords;
+
+out vec4 FragColor;
+
+// A tile of the lightmap.
+// RGB contain light of non-star lights, A contains attenuation of star lights.
+uniform sampler2D uLightmap;
+
+// Factor multiplying lightmap's non-star light
+uniform vec3 uNonStarFactor;
+// Factor multiplying lightmap's star attenuation, usually star's color multiplied by its intensity
+uniform vec3 uStarFactor;
+
+void main()
+{
+    vec4 lightmap = texture(uLightmap, vTexCoords);
+    FragColor = vec4(lightmap.rgb * uNonStarFactor + lightmap.a * uStarFactor, 1.0);
+}
@@ -0,0 +1,14 @@
+#version 330 core
+
+layout (location = 0) in vec2 position;
+layout (location = 1) in vec2 textureCoordinates;
+
+out vec2 vTexCoords;
+
+uniform mat4 uViewProjectionMatrix;
+
+void main()
+{
+    gl_Position = uViewProjectionMatrix * vec4(position, 0.0, 1.0);
+    vTexCoords = textureCoordinates;
+}